@@ -0,0 +1,487 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/alloc_bench.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdatomic.h> // _Atomic, atomic_load_explicit, atomic_store_explicit
+#include <stdio.h> // printf
+#include <string.h> // memset
+#include "qutils.h"
+#include "bench.h"
+
+#define BENCH_STRING(x) #x
+#define BENCH_EXPAND(x) BENCH_STRING(x)
+
+// Largest size in the small object patterns
+#define BENCH_SMALL_SIZE 256
+
+// Pointers in flight between a producer and its consumer
+#define BENCH_CHANNEL_SIZE 1024
+
+//// Allocators ////
+
+// Allocator under test, release receives the size it was acquired with
+typedef struct bench_allocator
+{
+	q_str name;
+	q_handle (*acquire)(q_handle state, q_ulong size);
+	q_void (*release)(q_handle state, q_handle handle, q_ulong size);
+	q_handle state;
+} bench_allocator;
+
+static q_handle benchQuAlloc(q_handle state, q_ulong size)
+{
+	(q_void)state;
+	return quAlloc(size);
+}
+
+static q_void benchQuFree(q_handle state, q_handle handle, q_ulong size)
+{
+	(q_void)state;
+	(q_void)size;
+	quFree(handle);
+}
+
+static q_handle benchMalloc(q_handle state, q_ulong size)
+{
+	(q_void)state;
+	return Q_MALLOC(size);
+}
+
+static q_void benchFree(q_handle state, q_handle handle, q_ulong size)
+{
+	(q_void)state;
+	(q_void)size;
+	Q_FREE(handle);
+}
+
+// Pools only serve the small object patterns
+static q_handle benchPoolAcquire(q_handle state, q_ulong size)
+{
+	(q_void)size;
+	return quPoolAcquire(state);
+}
+
+static q_void benchPoolRelease(q_handle state, q_handle handle, q_ulong size)
+{
+	(q_void)size;
+	quPoolRelease(state, handle);
+}
+
+//// Small objects ////
+
+typedef struct bench_churn
+{
+	const bench_allocator *allocator;
+	q_ulong slotCount;
+	q_ulong operations;
+	q_double *samples;
+	q_ulong elapsed[256];
+} bench_churn;
+
+// Allocate or free a random slot of a live set, timing each call when sampling
+static q_void benchChurn(const bench_churn *churn, q_uint seed, q_double *samples, q_ulong *elapsed)
+{
+	const bench_allocator *allocator = churn->allocator;
+	q_handle *slots = quAlloc(churn->slotCount * sizeof(q_handle));
+	q_ushort *sizes = quAlloc(churn->slotCount * sizeof(q_ushort));
+	if (slots == q_null || sizes == q_null)
+	{
+		quFree(slots);
+		quFree(sizes);
+		return;
+	}
+
+	q_ulong start = benchNow();
+	for (q_ulong i = 0; i < churn->operations; i++)
+	{
+		q_uint random = benchRandom(&seed);
+		q_ulong slot = random % churn->slotCount;
+		q_ulong before = samples ? benchNow() : 0;
+
+		if (slots[slot] != q_null)
+		{
+			allocator->release(allocator->state, slots[slot], sizes[slot]);
+			slots[slot] = q_null;
+		}
+		else
+		{
+			sizes[slot] = (q_ushort)(16 + (random >> 16) % (BENCH_SMALL_SIZE - 15));
+			slots[slot] = allocator->acquire(allocator->state, sizes[slot]);
+			if (slots[slot] != q_null)
+			{
+				*(q_ucharp)slots[slot] = (q_uchar)i;
+			}
+		}
+
+		if (samples)
+		{
+			samples[i] = (q_double)(benchNow() - before);
+		}
+	}
+	*elapsed = benchNow() - start;
+
+	for (q_ulong i = 0; i < churn->slotCount; i++)
+	{
+		if (slots[i] != q_null)
+		{
+			allocator->release(allocator->state, slots[i], sizes[i]);
+		}
+	}
+	quFree(slots);
+	quFree(sizes);
+}
+
+// Churn on one thread of a group
+static q_void benchChurnThread(q_handle context, q_uint index)
+{
+	bench_churn *churn = context;
+	benchChurn(churn, 0x9e3779b9u * (index + 1), q_null, &churn->elapsed[index]);
+}
+
+// Report latency percentiles of samples
+static q_void benchLatency(q_str name, q_double *samples, q_ulong count, q_double timer)
+{
+	benchSort(samples, count);
+	q_double sum = 0.0;
+	for (q_ulong i = 0; i < count; i++)
+	{
+		sum += samples[i];
+	}
+
+	benchRecordBegin("Alloc", name, "latency");
+	benchRecordNumber("p50_ns", benchPercentile(samples, count, 50.0));
+	benchRecordNumber("p99_ns", benchPercentile(samples, count, 99.0));
+	benchRecordNumber("p999_ns", benchPercentile(samples, count, 99.9));
+	benchRecordNumber("max_ns", samples[count - 1]);
+	benchRecordNumber("mean_ns", sum / (q_double)count);
+	benchRecordNumber("timer_ns", timer);
+	benchRecordEnd();
+}
+
+// Many short-lived small objects, single-threaded latency then threaded throughput
+static q_void benchSmallObjects(const bench_allocator *allocator, q_double *samples, q_double timer)
+{
+	char name[64];
+	bench_churn churn = { allocator, bench_config.size, bench_config.size * 256, q_null, { 0 } };
+
+	snprintf(name, sizeof(name), "SmallObjects/%s", allocator->name);
+	if (!benchSelected("Alloc", name))
+	{
+		return;
+	}
+
+	q_ulong elapsed;
+	benchChurn(&churn, 1, samples, &elapsed);
+	benchLatency(name, samples, churn.operations, timer);
+
+	for (q_uint threads = 1; threads <= bench_config.threads; threads *= 2)
+	{
+		if (!benchThreads(threads, benchChurnThread, &churn))
+		{
+			break;
+		}
+
+		q_ulong slowest = 0;
+		for (q_uint i = 0; i < threads; i++)
+		{
+			slowest = churn.elapsed[i] > slowest ? churn.elapsed[i] : slowest;
+		}
+
+		q_double total = (q_double)churn.operations * threads / ((q_double)slowest * 1e-9);
+		benchRecordBegin("Alloc", name, "throughput");
+		benchRecordNumber("threads", threads);
+		benchRecordNumber("ops_per_sec", total);
+		benchRecordNumber("ops_per_sec_per_thread", total / threads);
+		benchRecordEnd();
+	}
+}
+
+//// Producer and consumer ////
+
+// Single producer, single consumer ring of pointers
+typedef struct bench_channel
+{
+	_Atomic q_ulong head;
+	q_char headPad[64 - sizeof(q_ulong)];
+	_Atomic q_ulong tail;
+	q_char tailPad[64 - sizeof(q_ulong)];
+	q_handle items[BENCH_CHANNEL_SIZE];
+} bench_channel;
+
+typedef struct bench_transfer
+{
+	const bench_allocator *allocator;
+	bench_channel *channels;
+	q_ulong messages;
+} bench_transfer;
+
+// Even threads allocate and send, odd threads receive and free
+static q_void benchTransferThread(q_handle context, q_uint index)
+{
+	bench_transfer *transfer = context;
+	const bench_allocator *allocator = transfer->allocator;
+	bench_channel *channel = &transfer->channels[index / 2];
+	q_uint seed = 0x85ebca6bu * (index + 1);
+
+	for (q_ulong i = 0; i < transfer->messages; i++)
+	{
+		if (index % 2 == 0)
+		{
+			q_ulong size = 16 + benchRandom(&seed) % (BENCH_SMALL_SIZE - 15);
+			q_handle handle = allocator->acquire(allocator->state, size);
+			if (handle != q_null)
+			{
+				*(q_ucharp)handle = (q_uchar)i;
+			}
+
+			q_ulong tail = atomic_load_explicit(&channel->tail, memory_order_relaxed);
+			while (tail - atomic_load_explicit(&channel->head, memory_order_acquire) == BENCH_CHANNEL_SIZE)
+			{
+				benchYield();
+			}
+			channel->items[tail % BENCH_CHANNEL_SIZE] = handle;
+			atomic_store_explicit(&channel->tail, tail + 1, memory_order_release);
+		}
+		else
+		{
+			q_ulong head = atomic_load_explicit(&channel->head, memory_order_relaxed);
+			while (atomic_load_explicit(&channel->tail, memory_order_acquire) == head)
+			{
+				benchYield();
+			}
+			q_handle handle = channel->items[head % BENCH_CHANNEL_SIZE];
+			atomic_store_explicit(&channel->head, head + 1, memory_order_release);
+
+			if (handle != q_null)
+			{
+				benchEscape(*(q_ucharp)handle);
+				allocator->release(allocator->state, handle, 0);
+			}
+		}
+	}
+}
+
+// Objects allocated on one thread and freed on another
+static q_void benchProducerConsumer(const bench_allocator *allocator)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "ProducerConsumer/%s", allocator->name);
+	if (!benchSelected("Alloc", name))
+	{
+		return;
+	}
+
+	for (q_uint pairs = 1; pairs * 2 <= bench_config.threads || pairs == 1; pairs *= 2)
+	{
+		bench_channel *channels = quAllocAligned(sizeof(bench_channel) * pairs, 64);
+		bench_transfer transfer = { allocator, channels, bench_config.size * 64 };
+		if (channels == q_null)
+		{
+			return;
+		}
+
+		q_ulong start = benchNow();
+		q_bool finished = benchThreads(pairs * 2, benchTransferThread, &transfer);
+		q_ulong elapsed = benchNow() - start;
+		quFreeAligned(channels);
+		if (!finished)
+		{
+			return;
+		}
+
+		q_double total = (q_double)transfer.messages * pairs / ((q_double)elapsed * 1e-9);
+		benchRecordBegin("Alloc", name, "throughput");
+		benchRecordNumber("threads", pairs * 2);
+		benchRecordNumber("objects_per_sec", total);
+		benchRecordNumber("objects_per_sec_per_thread", total / (pairs * 2));
+		benchRecordEnd();
+	}
+}
+
+//// Growing buffers ////
+
+// Grow interleaved buffers with quRealloc so neighbours get in the way of growing in place
+static q_void benchGrow(q_str name, q_bool doubling, q_double *samples, q_double timer)
+{
+	if (!benchSelected("Alloc", name))
+	{
+		return;
+	}
+
+	enum { buffers = 64 };
+	q_ulong limit = doubling ? (1ull << 20) : (256ull << 10);
+	q_ulong count = 0;
+	q_ulong capacity = bench_config.size * 16;
+
+	while (count < capacity)
+	{
+		q_handle handles[buffers] = { q_null };
+		q_ulong size = 0;
+		while (size < limit && count + buffers <= capacity)
+		{
+			size = doubling ? (size ? size * 2 : 64) : size + 4096;
+			for (q_uint i = 0; i < buffers; i++)
+			{
+				q_ulong before = benchNow();
+				q_handle handle = quRealloc(handles[i], size);
+				samples[count++] = (q_double)(benchNow() - before);
+				if (handle == q_null)
+				{
+					break;
+				}
+				handles[i] = handle;
+				((q_ucharp)handle)[size - 1] = (q_uchar)i;
+			}
+		}
+
+		for (q_uint i = 0; i < buffers; i++)
+		{
+			quFree(handles[i]);
+		}
+		if (size < limit)
+		{
+			break;
+		}
+	}
+
+	benchLatency(name, samples, count, timer);
+}
+
+//// Fragmentation ////
+
+// Mixed lifetimes and sizes over many phases, tracking how far resident memory drifts from live bytes
+static q_void benchFragmentation(q_void)
+{
+	if (!benchSelected("Alloc", "Fragmentation/quAlloc"))
+	{
+		return;
+	}
+
+	q_ulong slotCount = bench_config.size * 4;
+	q_handle *slots = quAlloc(slotCount * sizeof(q_handle));
+	q_ulong *sizes = quAlloc(slotCount * sizeof(q_ulong));
+	if (slots == q_null || sizes == q_null)
+	{
+		quFree(slots);
+		quFree(sizes);
+		return;
+	}
+
+	q_uint seed = 7;
+	q_ulong live = 0;
+	q_ulong baseline = benchRss();
+	q_double worst = 0.0;
+	for (q_uint phase = 0; phase < 16; phase++)
+	{
+		for (q_ulong i = 0; i < bench_config.size * 64; i++)
+		{
+			q_uint random = benchRandom(&seed);
+			q_ulong slot = random % slotCount;
+			if (slots[slot] != q_null)
+			{
+				quFree(slots[slot]);
+				live -= sizes[slot];
+			}
+
+			// One in sixteen objects is large, and later phases favour larger small objects
+			q_uint shape = random >> 16;
+			sizes[slot] = shape % 16 == 0 ? 4096 + (shape >> 4) % 61440 : 16 + (shape >> 4) % (64 + 32 * phase);
+			slots[slot] = quAlloc(sizes[slot]);
+			live += slots[slot] != q_null ? sizes[slot] : 0;
+			sizes[slot] = slots[slot] != q_null ? sizes[slot] : 0;
+		}
+
+		q_ulong rss = benchRss();
+		q_double ratio = live ? (q_double)(rss > baseline ? rss - baseline : 0) / (q_double)live : 0.0;
+		worst = ratio > worst ? ratio : worst;
+	}
+
+	q_ulong rss = benchRss();
+	for (q_ulong i = 0; i < slotCount; i++)
+	{
+		quFree(slots[i]);
+	}
+	quFree(slots);
+	quFree(sizes);
+
+	benchRecordBegin("Alloc", "Fragmentation/quAlloc", "memory");
+	benchRecordNumber("live_bytes", (q_double)live);
+	benchRecordNumber("rss_bytes", (q_double)rss);
+	benchRecordNumber("rss_over_live_max", worst);
+	benchRecordNumber("rss_after_free_bytes", (q_double)benchRss());
+	benchRecordEnd();
+}
+
+//// Main ////
+
+int main(int argc, char **argv)
+{
+	if (!benchInit(argc, argv, "alloc"))
+	{
+		return 1;
+	}
+	printf("alloc: backend %s, %llu live slots\n", BENCH_EXPAND(Q_MALLOC(size)), bench_config.size);
+
+	// Latency samples for the largest pattern, allocated before anything is measured
+	q_ulong sampleCount = bench_config.size * 256;
+	q_double *samples = quAlloc(sampleCount * sizeof(q_double));
+	if (samples == q_null)
+	{
+		fprintf(stderr, "%s: cannot allocate %llu samples\n", argv[0], sampleCount);
+		return 1;
+	}
+	memset(samples, 0, sampleCount * sizeof(q_double));
+
+	// Cost of the clock reads around each timed call
+	q_ulong before = benchNow();
+	for (q_uint i = 0; i < 1000; i++)
+	{
+		benchEscape(benchNow());
+	}
+	q_double timer = (q_double)(benchNow() - before) / 1000.0;
+
+	q_pool *pool = quPoolCreate(BENCH_SMALL_SIZE, Q_POOL_SLAB_COUNT, q_true);
+	bench_allocator allocators[] =
+	{
+		{ "quAlloc", benchQuAlloc, benchQuFree, q_null },
+		{ "Q_MALLOC", benchMalloc, benchFree, q_null },
+		{ "quPool", benchPoolAcquire, benchPoolRelease, pool }
+	};
+
+	// Runs first so earlier patterns have not already grown the heap
+	benchFragmentation();
+
+	for (q_uint i = 0; i < sizeof(allocators) / sizeof(allocators[0]); i++)
+	{
+		benchSmallObjects(&allocators[i], samples, timer);
+	}
+	for (q_uint i = 0; i < sizeof(allocators) / sizeof(allocators[0]); i++)
+	{
+		benchProducerConsumer(&allocators[i]);
+	}
+
+	benchGrow("GrowDouble/quRealloc", q_true, samples, timer);
+	benchGrow("GrowLinear/quRealloc", q_false, samples, timer);
+
+	benchRecordBegin("Process", "PeakRss", "memory");
+	benchRecordNumber("peak_rss_bytes", (q_double)benchPeakRss());
+	benchRecordEnd();
+
+	quPoolDestroy(pool);
+	quFree(samples);
+	return benchFinish();
+}
@@ -0,0 +1,515 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/bench.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Affinity calls are GNU extensions
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE
+#endif /* !defined(_WIN32) && !defined(_GNU_SOURCE) */
+
+#include <stdio.h> // printf, fprintf, fopen, fclose
+#include <stdlib.h> // strtol, strtoul, strtod
+#include <string.h> // strcmp, strstr
+
+#if defined(_WIN32)
+	#include <windows.h> // QueryPerformanceCounter, SetThreadAffinityMask, CreateThread
+	#include <psapi.h> // GetProcessMemoryInfo
+#else
+	#include <pthread.h> // pthread_create, pthread_join
+	#include <sched.h> // sched_setaffinity, sched_yield
+	#include <sys/resource.h> // getrusage
+	#include <time.h> // clock_gettime
+	#include <unistd.h> // sysconf
+#endif /* defined(_WIN32) */
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h> // __rdtsc
+#elif defined(_M_X64) || defined(_M_IX86)
+	#include <intrin.h> // __rdtsc
+#endif /* defined(__x86_64__) || defined(__i386__) */
+
+#include "bench.h"
+
+//// Globals ////
+
+bench_options bench_config = { 0, 1, 7, 0.05, 4096, 4, q_null, q_null };
+
+#if !defined(__GNUC__) && !defined(__clang__)
+	volatile q_handle bench_sink;
+#endif /* !defined(__GNUC__) && !defined(__clang__) */
+
+static FILE *bench_json;
+static q_uint bench_records;
+
+//// Clocks ////
+
+// Get monotonic time in nanoseconds
+q_ulong benchNow(q_void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (q_ulong)((q_double)counter.QuadPart * 1e9 / (q_double)frequency.QuadPart);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (q_ulong)now.tv_sec * 1000000000ull + (q_ulong)now.tv_nsec;
+#endif /* defined(_WIN32) */
+}
+
+// Get cycle counter, which counts reference cycles on x86
+q_ulong benchCycles(q_void)
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	return __rdtsc();
+#else
+	return 0;
+#endif /* x86 */
+}
+
+// Check if cycle counter is available
+q_bool benchHasCycles(q_void)
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	return q_true;
+#else
+	return q_false;
+#endif /* x86 */
+}
+
+//// Harness management ////
+
+// Pin calling thread to cpu
+static q_bool benchPin(q_int cpu)
+{
+#if defined(_WIN32)
+	return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0;
+#elif defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+	(q_void)cpu;
+	return q_false;
+#endif /* defined(_WIN32) */
+}
+
+// Print usage
+static q_void benchUsage(q_str program)
+{
+	printf("usage: %s [options]\n", program);
+	printf("  --cpu N          pin to cpu N, -1 to leave unpinned (default %d)\n", bench_config.cpu);
+	printf("  --warmup N       warmup repetitions (default %u)\n", bench_config.warmup);
+	printf("  --repetitions N  measured repetitions (default %u)\n", bench_config.repetitions);
+	printf("  --time S         minimum seconds per repetition (default %g)\n", bench_config.time);
+	printf("  --size N         elements in array benchmarks, power of two (default %llu)\n", bench_config.size);
+	printf("  --threads N      maximum threads in threaded benchmarks (default %u)\n", bench_config.threads);
+	printf("  --filter TEXT    only run benchmarks whose family/name contains TEXT\n");
+	printf("  --json PATH      write results as JSON (default <suite>.json, - to disable)\n");
+}
+
+// Parse options, pin to cpu and open JSON output
+q_bool benchInit(int argc, char **argv, q_str suite)
+{
+	static char json[256];
+	snprintf(json, sizeof(json), "%s.json", suite);
+	bench_config.json = json;
+
+	for (int i = 1; i < argc; i++)
+	{
+		q_str option = argv[i];
+		q_str value = i + 1 < argc ? argv[i + 1] : q_null;
+		if (strcmp(option, "--help") == 0 || value == q_null)
+		{
+			benchUsage(argv[0]);
+			return q_false;
+		}
+
+		if (strcmp(option, "--cpu") == 0)
+		{
+			bench_config.cpu = (q_int)strtol(value, q_null, 10);
+		}
+		else if (strcmp(option, "--warmup") == 0)
+		{
+			bench_config.warmup = (q_uint)strtoul(value, q_null, 10);
+		}
+		else if (strcmp(option, "--repetitions") == 0)
+		{
+			bench_config.repetitions = (q_uint)strtoul(value, q_null, 10);
+		}
+		else if (strcmp(option, "--time") == 0)
+		{
+			bench_config.time = strtod(value, q_null);
+		}
+		else if (strcmp(option, "--size") == 0)
+		{
+			bench_config.size = strtoull(value, q_null, 10);
+		}
+		else if (strcmp(option, "--threads") == 0)
+		{
+			bench_config.threads = (q_uint)strtoul(value, q_null, 10);
+		}
+		else if (strcmp(option, "--filter") == 0)
+		{
+			bench_config.filter = value;
+		}
+		else if (strcmp(option, "--json") == 0)
+		{
+			bench_config.json = strcmp(value, "-") == 0 ? q_null : value;
+		}
+		else
+		{
+			benchUsage(argv[0]);
+			return q_false;
+		}
+		i++;
+	}
+
+	// Array benchmarks index with a mask
+	if (bench_config.repetitions == 0 || bench_config.threads == 0 || bench_config.size == 0 || (bench_config.size & (bench_config.size - 1)) != 0)
+	{
+		fprintf(stderr, "%s: repetitions and threads must be positive and size a power of two\n", argv[0]);
+		return q_false;
+	}
+
+	q_bool pinned = bench_config.cpu >= 0 && benchPin(bench_config.cpu);
+	if (bench_config.cpu >= 0 && !pinned)
+	{
+		fprintf(stderr, "%s: cannot pin to cpu %d, running unpinned\n", argv[0], bench_config.cpu);
+	}
+
+	if (bench_config.json != q_null)
+	{
+		bench_json = fopen(bench_config.json, "w");
+		if (bench_json == q_null)
+		{
+			fprintf(stderr, "%s: cannot open %s\n", argv[0], bench_config.json);
+			return q_false;
+		}
+		fprintf(bench_json, "{\n\t\"suite\": \"%s\",\n\t\"cpu\": %d,\n\t\"warmup\": %u,\n\t\"repetitions\": %u,\n\t\"size\": %llu,\n\t\"cycles\": %s,\n\t\"results\": [",
+			suite, pinned ? bench_config.cpu : -1, bench_config.warmup, bench_config.repetitions, bench_config.size, benchHasCycles() ? "\"tsc\"" : "null");
+	}
+
+	printf("%s: cpu %d, %u warmup, %u repetitions, %g s each\n", suite, pinned ? bench_config.cpu : -1,
+		bench_config.warmup, bench_config.repetitions, bench_config.time);
+	return q_true;
+}
+
+// Close JSON output
+q_int benchFinish(q_void)
+{
+	if (bench_json != q_null)
+	{
+		fprintf(bench_json, "\n\t]\n}\n");
+		fclose(bench_json);
+		bench_json = q_null;
+		printf("results written to %s\n", bench_config.json);
+	}
+	return 0;
+}
+
+// Check benchmark against filter
+q_bool benchSelected(q_str family, q_str name)
+{
+	if (bench_config.filter == q_null)
+	{
+		return q_true;
+	}
+
+	char label[128];
+	snprintf(label, sizeof(label), "%s/%s", family, name);
+	return strstr(label, bench_config.filter) != q_null;
+}
+
+//// Measurement ////
+
+// Time count operations in nanoseconds and cycles
+static q_void benchTime(bench_function function, q_handle context, q_ulong count, q_ulong *ns, q_ulong *cycles)
+{
+	q_ulong start = benchNow();
+	q_ulong startCycles = benchCycles();
+	function(context, count);
+	*cycles = benchCycles() - startCycles;
+	*ns = benchNow() - start;
+}
+
+// Compare doubles ascending
+static int benchCompare(const void *left, const void *right)
+{
+	q_double l = *(const q_double *)left;
+	q_double r = *(const q_double *)right;
+	return (l > r) - (l < r);
+}
+
+// Measure function, taking the median of repetitions sized to the minimum time
+bench_result benchRun(q_str family, q_str name, q_str kind, bench_function function, q_handle context)
+{
+	bench_result result = { 0.0, 0.0, 0.0, 0.0 };
+	if (!benchSelected(family, name))
+	{
+		return result;
+	}
+
+	// Grow operation count until one repetition takes long enough to time
+	q_ulong target = (q_ulong)(bench_config.time * 1e9);
+	q_ulong count = 1;
+	q_ulong ns, cycles;
+	for (;;)
+	{
+		benchTime(function, context, count, &ns, &cycles);
+		if (ns >= target || count >= (1ull << 40))
+		{
+			break;
+		}
+		count = ns < target / 10 ? count * 10 : (q_ulong)((q_double)count * (q_double)target / (q_double)ns * 1.1) + 1;
+	}
+
+	for (q_uint i = 0; i < bench_config.warmup; i++)
+	{
+		benchTime(function, context, count, &ns, &cycles);
+	}
+
+	q_double samples[64];
+	q_double cycleSamples[64];
+	q_uint repetitions = bench_config.repetitions < 64 ? bench_config.repetitions : 64;
+	for (q_uint i = 0; i < repetitions; i++)
+	{
+		benchTime(function, context, count, &ns, &cycles);
+		samples[i] = (q_double)ns / (q_double)count;
+		cycleSamples[i] = (q_double)cycles / (q_double)count;
+	}
+	benchSort(samples, repetitions);
+	benchSort(cycleSamples, repetitions);
+
+	result.nsPerOp = samples[repetitions / 2];
+	result.nsPerOpMin = samples[0];
+	result.opsPerSec = result.nsPerOp > 0.0 ? 1e9 / result.nsPerOp : 0.0;
+	result.cyclesPerOp = benchHasCycles() ? cycleSamples[repetitions / 2] : 0.0;
+
+	benchReport(family, name, kind, result);
+	return result;
+}
+
+// Report result to stdout and JSON
+q_void benchReport(q_str family, q_str name, q_str kind, bench_result result)
+{
+	printf("%-12s %-28s %-10s %10.3f ns/op %14.0f ops/s", family, name, kind, result.nsPerOp, result.opsPerSec);
+	if (benchHasCycles())
+	{
+		printf(" %9.2f cycles/op", result.cyclesPerOp);
+	}
+	printf("\n");
+
+	if (bench_json != q_null)
+	{
+		fprintf(bench_json, "%s\n\t\t{ \"family\": \"%s\", \"name\": \"%s\", \"kind\": \"%s\", \"ns_per_op\": %.4f, \"ns_per_op_min\": %.4f, \"ops_per_sec\": %.1f, \"cycles_per_op\": ",
+			bench_records++ ? "," : "", family, name, kind, result.nsPerOp, result.nsPerOpMin, result.opsPerSec);
+		if (benchHasCycles())
+		{
+			fprintf(bench_json, "%.3f }", result.cyclesPerOp);
+		}
+		else
+		{
+			fprintf(bench_json, "null }");
+		}
+	}
+}
+
+//// Statistics ////
+
+// Sort samples ascending
+q_void benchSort(q_double *samples, q_ulong count)
+{
+	qsort(samples, count, sizeof(q_double), benchCompare);
+}
+
+// Get nearest-rank percentile of sorted samples
+q_double benchPercentile(const q_double *sorted, q_ulong count, q_double percentile)
+{
+	if (count == 0)
+	{
+		return 0.0;
+	}
+
+	q_ulong rank = (q_ulong)(percentile / 100.0 * (q_double)count);
+	return sorted[rank < count ? rank : count - 1];
+}
+
+// Get next pseudo-random number, reproducible for a given seed
+q_uint benchRandom(q_uint *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+//// Process ////
+
+typedef struct bench_thread_start
+{
+	bench_thread function;
+	q_handle context;
+	q_uint index;
+} bench_thread_start;
+
+// Thread entry point
+#if defined(_WIN32)
+static DWORD WINAPI benchThreadMain(LPVOID argument)
+#else
+static q_void *benchThreadMain(q_void *argument)
+#endif /* defined(_WIN32) */
+{
+	bench_thread_start *start = argument;
+	start->function(start->context, start->index);
+	return 0;
+}
+
+// Run function on count threads and wait for all of them
+q_bool benchThreads(q_uint count, bench_thread function, q_handle context)
+{
+	bench_thread_start starts[256];
+	if (count > 256)
+	{
+		return q_false;
+	}
+
+#if defined(_WIN32)
+	HANDLE threads[256];
+#else
+	pthread_t threads[256];
+#endif /* defined(_WIN32) */
+
+	q_uint started = 0;
+	for (; started < count; started++)
+	{
+		starts[started].function = function;
+		starts[started].context = context;
+		starts[started].index = started;
+#if defined(_WIN32)
+		threads[started] = CreateThread(q_null, 0, benchThreadMain, &starts[started], 0, q_null);
+		if (threads[started] == q_null)
+		{
+			break;
+		}
+#else
+		if (pthread_create(&threads[started], q_null, benchThreadMain, &starts[started]) != 0)
+		{
+			break;
+		}
+#endif /* defined(_WIN32) */
+	}
+
+	for (q_uint i = 0; i < started; i++)
+	{
+#if defined(_WIN32)
+		WaitForSingleObject(threads[i], INFINITE);
+		CloseHandle(threads[i]);
+#else
+		pthread_join(threads[i], q_null);
+#endif /* defined(_WIN32) */
+	}
+	return started == count;
+}
+
+// Give up the rest of the time slice
+q_void benchYield(q_void)
+{
+#if defined(_WIN32)
+	SwitchToThread();
+#else
+	sched_yield();
+#endif /* defined(_WIN32) */
+}
+
+// Get resident set size in bytes, or zero when unknown
+q_ulong benchRss(q_void)
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+	return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.WorkingSetSize : 0;
+#elif defined(__linux__)
+	FILE *file = fopen("/proc/self/statm", "r");
+	unsigned long long total = 0, resident = 0;
+	if (file == q_null)
+	{
+		return 0;
+	}
+	if (fscanf(file, "%llu %llu", &total, &resident) != 2)
+	{
+		resident = 0;
+	}
+	fclose(file);
+	return resident * (q_ulong)sysconf(_SC_PAGESIZE);
+#else
+	return 0;
+#endif /* defined(_WIN32) */
+}
+
+// Get peak resident set size in bytes, or zero when unknown
+q_ulong benchPeakRss(q_void)
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+	return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return 0;
+	}
+#if defined(__APPLE__)
+	return (q_ulong)usage.ru_maxrss;
+#else
+	return (q_ulong)usage.ru_maxrss * 1024;
+#endif /* defined(__APPLE__) */
+#endif /* defined(_WIN32) */
+}
+
+//// Custom records ////
+
+// Start record with free-form numeric fields
+q_void benchRecordBegin(q_str family, q_str name, q_str kind)
+{
+	printf("%-12s %-28s %-10s", family, name, kind);
+	if (bench_json != q_null)
+	{
+		fprintf(bench_json, "%s\n\t\t{ \"family\": \"%s\", \"name\": \"%s\", \"kind\": \"%s\"", bench_records++ ? "," : "", family, name, kind);
+	}
+}
+
+// Add numeric field to record
+q_void benchRecordNumber(q_str key, q_double value)
+{
+	printf(" %s=%.6g", key, value);
+	if (bench_json != q_null)
+	{
+		fprintf(bench_json, ", \"%s\": %.6g", key, value);
+	}
+}
+
+// End record
+q_void benchRecordEnd(q_void)
+{
+	printf("\n");
+	if (bench_json != q_null)
+	{
+		fprintf(bench_json, " }");
+	}
+}
@@ -0,0 +1,97 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/bench.h
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Include guard
+#ifndef Q_BENCH_H
+#define Q_BENCH_H
+
+#include "quite.h"
+
+//// Options ////
+
+typedef struct bench_options
+{
+	q_int cpu;
+	q_uint warmup;
+	q_uint repetitions;
+	q_double time;
+	q_ulong size;
+	q_uint threads;
+	q_str filter;
+	q_str json;
+} bench_options;
+
+extern bench_options bench_config;
+
+//// Results ////
+
+typedef struct bench_result
+{
+	q_double nsPerOp;
+	q_double nsPerOpMin;
+	q_double opsPerSec;
+	q_double cyclesPerOp;
+} bench_result;
+
+// Runs count operations on context
+typedef q_void (*bench_function)(q_handle context, q_ulong count);
+
+// Runs as thread index of a group
+typedef q_void (*bench_thread)(q_handle context, q_uint index);
+
+//// Functions ////
+
+// Keep value alive without letting the compiler see how it is used
+#if defined(__GNUC__) || defined(__clang__)
+	#define benchEscape(p) __asm__ volatile("" : : "g"(p) : "memory")
+#else
+	#define benchEscape(p) (bench_sink = (q_handle)(p))
+	extern volatile q_handle bench_sink;
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+// Harness management
+q_bool benchInit(int argc, char **argv, q_str suite);
+q_int benchFinish(q_void);
+q_bool benchSelected(q_str family, q_str name);
+
+// Clocks
+q_ulong benchNow(q_void);
+q_ulong benchCycles(q_void);
+q_bool benchHasCycles(q_void);
+
+// Measurement
+bench_result benchRun(q_str family, q_str name, q_str kind, bench_function function, q_handle context);
+q_void benchReport(q_str family, q_str name, q_str kind, bench_result result);
+
+// Statistics
+q_void benchSort(q_double *samples, q_ulong count);
+q_double benchPercentile(const q_double *sorted, q_ulong count, q_double percentile);
+q_uint benchRandom(q_uint *state);
+
+// Process
+q_bool benchThreads(q_uint count, bench_thread function, q_handle context);
+q_void benchYield(q_void);
+q_ulong benchRss(q_void);
+q_ulong benchPeakRss(q_void);
+
+// Custom records
+q_void benchRecordBegin(q_str family, q_str name, q_str kind);
+q_void benchRecordNumber(q_str key, q_double value);
+q_void benchRecordEnd(q_void);
+
+#endif /* Q_BENCH_H */
@@ -0,0 +1,348 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/bvh_bench.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Keep private copies of the inline math functions, which the library does not export
+#if !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE)
+	#define Q_MATH_STATIC_INLINE
+#endif /* !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE) */
+
+#include <math.h> // fabsf, sinf
+#include <stdio.h> // printf, fprintf, snprintf
+
+#include "qbvh.h"
+#include "qutils.h"
+#include "bench.h"
+
+//// Data ////
+
+// Primitives per element of --size, so the default hierarchy has 64k
+#define BENCH_BVH_SCALE 16
+
+// Side of the cube the primitives are scattered in, and the largest half extent of a box
+#define BENCH_BVH_WORLD 1000.0f
+#define BENCH_BVH_EXTENT 2.0f
+
+// Half extent of the overlap query boxes
+#define BENCH_BVH_QUERY 10.0f
+
+// Queries prepared ahead, cycled through by the query cases
+#define BENCH_BVH_QUERIES 1024
+
+// One triangle in this many repeats a vertex, as welded or decimated meshes do
+#define BENCH_BVH_DEGENERATE 8
+
+typedef struct bench_bvh
+{
+	q_bvh *bvh;
+	q_bvh *points;
+	q_bvh *triangles;
+	q_aabb *boxes;
+	q_vector3 *centers;
+	q_vector3 *vertices;
+	q_uint *indices;
+	q_vector3 *probe;
+	q_ray *rays;
+	q_uint *result;
+	q_uint count;
+	q_uint query;
+	q_uint threads;
+	q_bvh_build build;
+	q_float angle;
+} bench_bvh;
+
+static q_float benchUniform(q_uint *state)
+{
+	return (q_float)(benchRandom(state) & 0xFFFFFF) / 16777216.0f;
+}
+
+//// Cases ////
+
+// Whole builds of the box hierarchy
+static q_void BvhBuild(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		benchEscape(qbBuild(data->bvh, data->boxes, data->count, data->build, data->threads));
+	}
+}
+
+// Every box moved a little, then the hierarchy refit around them
+static q_void BvhRefit(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		data->angle += 0.01f;
+		q_float offset = sinf(data->angle) * 0.01f;
+		for (q_uint i = 0; i < data->count; i++)
+		{
+			data->boxes[i].min.y += offset;
+			data->boxes[i].max.y += offset;
+		}
+		qbRefit(data->bvh, data->boxes);
+		benchEscape(data->bvh);
+	}
+}
+
+// Closest point by the linear scan of qmVector3Distance the hierarchy replaces
+static q_void BvhNearestLoop(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_vector3 probe = data->probe[data->query++ % BENCH_BVH_QUERIES];
+		q_float best = INFINITY;
+		q_uint found = Q_BVH_NONE;
+		for (q_uint i = 0; i < data->count; i++)
+		{
+			q_float d = qmVector3Distance(probe, data->centers[i]);
+			if (d < best)
+			{
+				best = d;
+				found = i;
+			}
+		}
+		benchEscape(found);
+	}
+}
+
+static q_void BvhNearest(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_bvh_hit hit;
+		benchEscape(qbNearest(data->points, data->probe[data->query++ % BENCH_BVH_QUERIES], INFINITY, &hit));
+		benchEscape(hit.primitive);
+	}
+}
+
+// Closest triangle of a mesh with degenerate triangles among the rest
+static q_void BvhNearestTriangles(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_bvh_hit hit;
+		benchEscape(qbNearest(data->triangles, data->probe[data->query++ % BENCH_BVH_QUERIES], INFINITY, &hit));
+		benchEscape(hit.primitive);
+	}
+}
+
+// Closest box along a ray by a linear scan of slab tests
+static q_void BvhRayCastLoop(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_ray ray = data->rays[data->query++ % BENCH_BVH_QUERIES];
+		q_float best = INFINITY;
+		q_uint found = Q_BVH_NONE;
+		for (q_uint i = 0; i < data->count; i++)
+		{
+			q_float t;
+			if (qmRayIntersectsAabb(ray, data->boxes[i], &t) && t < best)
+			{
+				best = t;
+				found = i;
+			}
+		}
+		benchEscape(found);
+	}
+}
+
+static q_void BvhRayCast(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_bvh_hit hit;
+		benchEscape(qbRayCast(data->bvh, data->rays[data->query++ % BENCH_BVH_QUERIES], INFINITY, &hit));
+		benchEscape(hit.primitive);
+	}
+}
+
+// Boxes overlapping a query box by a linear scan
+static q_void BvhOverlapLoop(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	q_vector3 extent = { BENCH_BVH_QUERY, BENCH_BVH_QUERY, BENCH_BVH_QUERY };
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_aabb query = qmAabbFromCenterExtent(data->probe[data->query++ % BENCH_BVH_QUERIES], extent);
+		q_uint total = 0;
+		for (q_uint i = 0; i < data->count; i++)
+		{
+			if (qmAabbIntersectsAabb(data->boxes[i], query))
+			{
+				data->result[total++] = i;
+			}
+		}
+		benchEscape(total);
+	}
+}
+
+static q_void BvhOverlap(q_handle context, q_ulong count)
+{
+	bench_bvh *data = context;
+	q_vector3 extent = { BENCH_BVH_QUERY, BENCH_BVH_QUERY, BENCH_BVH_QUERY };
+	for (q_ulong n = 0; n < count; n++)
+	{
+		q_aabb query = qmAabbFromCenterExtent(data->probe[data->query++ % BENCH_BVH_QUERIES], extent);
+		benchEscape(qbOverlapAabb(data->bvh, query, data->result, data->count));
+	}
+}
+
+//// Main ////
+
+int main(int argc, char **argv)
+{
+	if (!benchInit(argc, argv, "bvh"))
+	{
+		return 1;
+	}
+
+	bench_bvh data = { 0 };
+	data.count = (q_uint)bench_config.size * BENCH_BVH_SCALE;
+	data.boxes = quAlloc(data.count * sizeof(q_aabb));
+	data.centers = quAlloc(data.count * sizeof(q_vector3));
+	data.result = quAlloc(data.count * sizeof(q_uint));
+	data.probe = quAlloc(BENCH_BVH_QUERIES * sizeof(q_vector3));
+	data.rays = quAlloc(BENCH_BVH_QUERIES * sizeof(q_ray));
+	data.vertices = quAlloc(3 * data.count * sizeof(q_vector3));
+	data.indices = quAlloc(3 * data.count * sizeof(q_uint));
+	q_aabb *points = quAlloc(data.count * sizeof(q_aabb));
+	if (data.boxes == q_null || data.centers == q_null || data.result == q_null || data.probe == q_null || data.rays == q_null || data.vertices == q_null || data.indices == q_null || points == q_null)
+	{
+		fprintf(stderr, "%s: cannot allocate %u primitives\n", argv[0], data.count);
+		return 1;
+	}
+
+	// Boxes of random size scattered through the world, and the same centers as points
+	q_uint random = 1;
+	for (q_uint i = 0; i < data.count; i++)
+	{
+		q_vector3 center = { benchUniform(&random) * BENCH_BVH_WORLD, benchUniform(&random) * BENCH_BVH_WORLD, benchUniform(&random) * BENCH_BVH_WORLD };
+		q_vector3 extent = { benchUniform(&random) * BENCH_BVH_EXTENT, benchUniform(&random) * BENCH_BVH_EXTENT, benchUniform(&random) * BENCH_BVH_EXTENT };
+		data.boxes[i] = qmAabbFromCenterExtent(center, extent);
+		data.centers[i] = center;
+		points[i] = (q_aabb){ center, center };
+
+		// A triangle inside each box, where some collapse onto an edge
+		for (q_uint k = 0; k < 3; k++)
+		{
+			q_vector3 corner = { (benchUniform(&random) - 0.5f) * extent.x, (benchUniform(&random) - 0.5f) * extent.y, (benchUniform(&random) - 0.5f) * extent.z };
+			data.vertices[3 * i + k] = qmVector3Add(center, qmVector3Scale(corner, 2.0f));
+			data.indices[3 * i + k] = 3 * i + k;
+		}
+		if (i % BENCH_BVH_DEGENERATE == 0)
+		{
+			data.indices[3 * i + 1] = 3 * i;
+		}
+	}
+
+	// A triangle with a repeated vertex lies along its remaining edge, here one unit below the probe
+	q_vector3 degenerate[3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 2.0f, 0.0f, 0.0f } };
+	q_uint corners[3] = { 0, 1, 2 };
+	q_bvh_hit check;
+	data.triangles = qbCreate(0);
+	q_bool found = data.triangles != q_null && qbBuildTriangles(data.triangles, degenerate, corners, 1, Q_BVH_BUILD_BINNED, 1);
+	found = found && qbNearest(data.triangles, (q_vector3){ 1.0f, 1.0f, 0.0f }, INFINITY, &check);
+	if (!found || fabsf(check.distance - 1.0f) > Q_EPSILON)
+	{
+		fprintf(stderr, "%s: nearest point of a degenerate triangle is wrong\n", argv[0]);
+		return 1;
+	}
+	qbDestroy(data.triangles);
+
+	// Rays start inside the world in random directions, so most cross many boxes
+	for (q_uint i = 0; i < BENCH_BVH_QUERIES; i++)
+	{
+		data.probe[i] = (q_vector3){ benchUniform(&random) * BENCH_BVH_WORLD, benchUniform(&random) * BENCH_BVH_WORLD, benchUniform(&random) * BENCH_BVH_WORLD };
+		q_vector3 direction = { benchUniform(&random) - 0.5f, benchUniform(&random) - 0.5f, benchUniform(&random) - 0.5f };
+		data.rays[i] = (q_ray){ data.probe[i], qmVector3Normalize(direction) };
+	}
+	printf("bvh: %u primitives\n", data.count);
+
+	char name[32];
+	q_uint width[3] = { 2, 4, 8 };
+	data.threads = 1;
+	for (q_uint w = 0; w < 3; w++)
+	{
+		data.bvh = qbCreate(width[w]);
+		data.points = qbCreate(width[w]);
+		data.triangles = qbCreate(width[w]);
+		q_bool built = data.bvh != q_null && data.points != q_null && data.triangles != q_null;
+		built = built && qbBuild(data.points, points, data.count, Q_BVH_BUILD_BINNED, 1);
+		built = built && qbBuildTriangles(data.triangles, data.vertices, data.indices, data.count, Q_BVH_BUILD_BINNED, 1);
+		if (!built)
+		{
+			fprintf(stderr, "%s: cannot build %u primitives\n", argv[0], data.count);
+			return 1;
+		}
+
+		data.build = Q_BVH_BUILD_BINNED;
+		snprintf(name, sizeof(name), "BuildBinned/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhBuild, &data);
+		data.build = Q_BVH_BUILD_SAH;
+		snprintf(name, sizeof(name), "BuildSah/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhBuild, &data);
+
+		// Queries run on a binned build whichever build cases were selected
+		qbBuild(data.bvh, data.boxes, data.count, Q_BVH_BUILD_BINNED, 1);
+		snprintf(name, sizeof(name), "Nearest/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhNearest, &data);
+		snprintf(name, sizeof(name), "NearestTriangles/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhNearestTriangles, &data);
+		snprintf(name, sizeof(name), "RayCast/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhRayCast, &data);
+		snprintf(name, sizeof(name), "Overlap/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhOverlap, &data);
+		snprintf(name, sizeof(name), "Refit/%u", width[w]);
+		benchRun("Bvh", name, "latency", BvhRefit, &data);
+
+		qbDestroy(data.triangles);
+		qbDestroy(data.points);
+		qbDestroy(data.bvh);
+	}
+
+	// Thread scaling of the default width
+	data.bvh = qbCreate(0);
+	data.build = Q_BVH_BUILD_BINNED;
+	for (data.threads = 2; data.threads <= bench_config.threads; data.threads *= 2)
+	{
+		snprintf(name, sizeof(name), "BuildThreaded/%u", data.threads);
+		benchRun("Bvh", name, "latency", BvhBuild, &data);
+	}
+	qbDestroy(data.bvh);
+
+	benchRun("Bvh", "NearestLoop", "latency", BvhNearestLoop, &data);
+	benchRun("Bvh", "RayCastLoop", "latency", BvhRayCastLoop, &data);
+	benchRun("Bvh", "OverlapLoop", "latency", BvhOverlapLoop, &data);
+
+	quFree(points);
+	quFree(data.indices);
+	quFree(data.vertices);
+	quFree(data.rays);
+	quFree(data.probe);
+	quFree(data.result);
+	quFree(data.centers);
+	quFree(data.boxes);
+	return benchFinish();
+}
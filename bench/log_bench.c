@@ -0,0 +1,289 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/log_bench.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Filtered cases compare the inline Q_LOG check with calling quLog
+#ifndef Q_ENABLE_LOGGING
+	#define Q_ENABLE_LOGGING
+#endif /* Q_ENABLE_LOGGING */
+
+#include <stdatomic.h> // _Atomic, atomic_fetch_sub
+#include <stdio.h> // printf, fflush, tmpfile
+
+#if defined(_WIN32)
+	#include <fcntl.h> // _O_BINARY, _O_WRONLY
+	#include <io.h> // _open, _dup, _dup2, _pipe, _read, _close
+	#define open _open
+	#define O_WRONLY _O_WRONLY
+	#define dup _dup
+	#define dup2 _dup2
+	#define read _read
+	#define close _close
+	#define fileno _fileno
+	#define BENCH_NULL_DEVICE "NUL"
+#else
+	#include <fcntl.h> // open
+	#include <unistd.h> // dup, dup2, pipe, read, close
+	#define BENCH_NULL_DEVICE "/dev/null"
+#endif /* defined(_WIN32) */
+
+#include "qutils.h"
+#include "bench.h"
+
+//// Cases ////
+
+typedef enum
+{
+	BENCH_SINK_NULL,
+	BENCH_SINK_FILE,
+	BENCH_SINK_PIPE,
+	BENCH_SINK_COUNT
+} bench_sink;
+
+static const q_str bench_sink_names[] = { "devnull", "file", "pipe" };
+
+// Synchronous logging is one more mode after the asynchronous ones
+#define BENCH_MODE_SYNC 3
+#define BENCH_MODE_FILTERED_CALL 4
+#define BENCH_MODE_FILTERED_MACRO 5
+
+static const q_str bench_mode_names[] = { "async-text", "async-deferred", "async-binary", "sync", "filtered-call", "filtered-macro" };
+
+typedef struct bench_log
+{
+	bench_sink sink;
+	q_int mode;
+	q_uint producers;
+	q_ulong messages;
+	q_double *samples;
+	_Atomic q_uint remaining;
+	int saved;
+	int drain;
+	q_ulong start;
+	q_ulong end;
+} bench_log;
+
+//// Sinks ////
+
+// Point stdout at sink, keeping the original descriptor in saved
+static q_bool benchRedirect(bench_log *log)
+{
+	int sink = -1;
+	log->drain = -1;
+	fflush(stdout);
+
+	switch (log->sink)
+	{
+	case BENCH_SINK_NULL:
+		sink = open(BENCH_NULL_DEVICE, O_WRONLY);
+		break;
+	case BENCH_SINK_FILE:
+	{
+		// Removed by the C library when closed
+		static FILE *file;
+		file = file ? file : tmpfile();
+		sink = file ? dup(fileno(file)) : -1;
+		break;
+	}
+	case BENCH_SINK_PIPE:
+	{
+		int ends[2];
+#if defined(_WIN32)
+		if (_pipe(ends, 1 << 16, _O_BINARY) == 0)
+#else
+		if (pipe(ends) == 0)
+#endif /* defined(_WIN32) */
+		{
+			log->drain = ends[0];
+			sink = ends[1];
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	log->saved = dup(1);
+	if (sink < 0 || log->saved < 0 || dup2(sink, 1) < 0)
+	{
+		return q_false;
+	}
+	close(sink);
+	return q_true;
+}
+
+// Restore stdout, which also closes the write end a pipe drain is waiting on
+static q_void benchRestore(bench_log *log)
+{
+	fflush(stdout);
+	dup2(log->saved, 1);
+	close(log->saved);
+}
+
+//// Threads ////
+
+// Thread 0 drains the pipe sink, the rest produce messages
+static q_void benchLogThread(q_handle context, q_uint index)
+{
+	bench_log *log = context;
+	if (index == 0)
+	{
+		if (log->drain >= 0)
+		{
+			char buffer[1 << 16];
+			while (read(log->drain, buffer, sizeof(buffer)) > 0)
+			{
+			}
+			close(log->drain);
+		}
+		return;
+	}
+
+	q_uint producer = index - 1;
+	q_double *samples = log->samples + producer * log->messages;
+	q_float position = (q_float)producer;
+	for (q_ulong i = 0; i < log->messages; i++)
+	{
+		q_ulong before = benchNow();
+		switch (log->mode)
+		{
+		case BENCH_MODE_FILTERED_CALL:
+			quLog(Q_LOG_DEBUG, "frame %llu entity %u position %f %f %f name %s", i, producer, position, position * 2.0f, position * 3.0f, "player");
+			break;
+		case BENCH_MODE_FILTERED_MACRO:
+			Q_LOG(Q_LOG_DEBUG, "frame %llu entity %u position %f %f %f name %s", i, producer, position, position * 2.0f, position * 3.0f, "player");
+			break;
+		default:
+			quLog(Q_LOG_INFO, "frame %llu entity %u position %f %f %f name %s", i, producer, position, position * 2.0f, position * 3.0f, "player");
+			break;
+		}
+		samples[i] = (q_double)(benchNow() - before);
+		position += 0.25f;
+	}
+
+	// Last producer drains the asynchronous ring before the sink is closed
+	if (atomic_fetch_sub(&log->remaining, 1) == 1)
+	{
+		if (log->mode < BENCH_MODE_SYNC)
+		{
+			quLogStopAsync();
+		}
+		log->end = benchNow();
+		benchRestore(log);
+	}
+}
+
+// Run one case and report caller-side latency percentiles
+static q_void benchLog(bench_log *log, q_double timer)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "%s/%s", bench_sink_names[log->sink], bench_mode_names[log->mode]);
+	if (!benchSelected("Log", name))
+	{
+		return;
+	}
+
+	if (!benchRedirect(log))
+	{
+		fprintf(stderr, "cannot redirect stdout to %s\n", bench_sink_names[log->sink]);
+		return;
+	}
+
+	q_ulong dropped = quLogDropped();
+	if (log->mode < BENCH_MODE_SYNC && !quLogStartAsync(0, Q_LOG_OVERFLOW_BLOCK, (q_log_mode)log->mode))
+	{
+		benchRestore(log);
+		return;
+	}
+
+	atomic_store(&log->remaining, log->producers);
+	log->start = benchNow();
+	benchThreads(log->producers + 1, benchLogThread, log);
+
+	q_ulong count = log->producers * log->messages;
+	q_double sum = 0.0;
+	for (q_ulong i = 0; i < count; i++)
+	{
+		sum += log->samples[i];
+	}
+	benchSort(log->samples, count);
+
+	benchRecordBegin("Log", name, "latency");
+	benchRecordNumber("threads", log->producers);
+	benchRecordNumber("p50_ns", benchPercentile(log->samples, count, 50.0));
+	benchRecordNumber("p99_ns", benchPercentile(log->samples, count, 99.0));
+	benchRecordNumber("p999_ns", benchPercentile(log->samples, count, 99.9));
+	benchRecordNumber("max_ns", log->samples[count - 1]);
+	benchRecordNumber("mean_ns", sum / (q_double)count);
+	benchRecordNumber("messages_per_sec", (q_double)count / ((q_double)(log->end - log->start) * 1e-9));
+	benchRecordNumber("dropped", (q_double)(quLogDropped() - dropped));
+	benchRecordNumber("timer_ns", timer);
+	benchRecordEnd();
+}
+
+//// Main ////
+
+int main(int argc, char **argv)
+{
+	if (!benchInit(argc, argv, "log"))
+	{
+		return 1;
+	}
+
+	q_ulong messages = bench_config.size * 16;
+	q_double *samples = quAlloc(bench_config.threads * messages * sizeof(q_double));
+	if (samples == q_null)
+	{
+		fprintf(stderr, "%s: cannot allocate samples\n", argv[0]);
+		return 1;
+	}
+	printf("log: %llu messages per producer, compile level %d\n", messages, Q_LOG_COMPILE_LEVEL);
+
+	// Cost of the clock reads around each timed call
+	q_ulong before = benchNow();
+	for (q_uint i = 0; i < 1000; i++)
+	{
+		benchEscape(benchNow());
+	}
+	q_double timer = (q_double)(benchNow() - before) / 1000.0;
+
+	// Both a single producer and the most contended case
+	q_uint producers[] = { 1, bench_config.threads };
+	q_uint variants = bench_config.threads > 1 ? 2 : 1;
+	for (q_uint p = 0; p < variants; p++)
+	{
+		bench_log log = { BENCH_SINK_NULL, 0, producers[p], messages, samples, 0, -1, -1, 0, 0 };
+
+		quLogSetLevel(0, Q_LOG_WARN);
+		for (log.mode = BENCH_MODE_FILTERED_CALL; log.mode <= BENCH_MODE_FILTERED_MACRO; log.mode++)
+		{
+			benchLog(&log, timer);
+		}
+		quLogSetLevel(0, Q_LOG_INFO);
+
+		for (log.sink = 0; log.sink < BENCH_SINK_COUNT; log.sink++)
+		{
+			for (log.mode = BENCH_MODE_SYNC; log.mode >= 0; log.mode--)
+			{
+				benchLog(&log, timer);
+			}
+		}
+	}
+
+	quFree(samples);
+	return benchFinish();
+}
@@ -0,0 +1,695 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/qmath_bench.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// The suite provides the external definitions of math functions calls are not inlined into
+#ifndef Q_MATH_IMPLEMENTATION
+	#define Q_MATH_IMPLEMENTATION
+#endif /* Q_MATH_IMPLEMENTATION */
+
+#include <stdio.h> // printf, snprintf
+#include "qmath.h"
+#include "qutils.h"
+#include "bench.h"
+
+#if defined(Q_MATH_SSE)
+	#include <xmmintrin.h> // _mm_getcsr, _mm_setcsr
+#endif /* Q_MATH_SSE */
+
+//// Data ////
+
+// Arrays sized for the largest type, filled with floats away from zero
+typedef struct bench_data
+{
+	q_floatp a;
+	q_floatp b;
+	q_floatp f;
+	q_handle r;
+	q_ulong mask;
+	q_dualquat *pose;
+	q_matrix44 *joint;
+	q_uint *index;
+	q_floatp weight;
+	q_frustum frustum;
+} bench_data;
+
+// Joints in the skinning palette and influences per vertex
+#define BENCH_SKIN_JOINTS 64
+#define BENCH_SKIN_INFLUENCES 4
+
+//// Cases ////
+
+// Chains feed each result into the next call to measure latency.
+// Each case is (family, name, type, argument type, call) where call reads
+// x of type, y of argument type and s as a float.
+#define BENCH_CHAINS(X) \
+	X(Float, Clamp, q_float, q_float, qmFloatClamp(x, 0.25f, 1.25f)) \
+	X(Float, Wrap, q_float, q_float, qmFloatWrap(x + y, 0.5f, 1.5f)) \
+	X(Float, Lerp, q_float, q_float, qmFloatLerp(s, x, y)) \
+	X(Float, Normalize, q_float, q_float, qmFloatNormalize(x, 0.0f, y)) \
+	X(Float, Remap, q_float, q_float, qmFloatRemap(x, 0.0f, 2.0f, y, s)) \
+	X(Vector2, Add, q_vector2, q_vector2, qmVector2Add(x, y)) \
+	X(Vector2, Multiply, q_vector2, q_vector2, qmVector2Multiply(x, y)) \
+	X(Vector2, Scale, q_vector2, q_vector2, qmVector2Scale(x, s)) \
+	X(Vector2, Normalize, q_vector2, q_vector2, qmVector2Normalize(x)) \
+	X(Vector2, Lerp, q_vector2, q_vector2, qmVector2Lerp(s, x, y)) \
+	X(Vector2, Reflect, q_vector2, q_vector2, qmVector2Reflect(x, y)) \
+	X(Vector2, Rotate, q_vector2, q_vector2, qmVector2Rotate(x, s)) \
+	X(Vector3, Add, q_vector3, q_vector3, qmVector3Add(x, y)) \
+	X(Vector3, Multiply, q_vector3, q_vector3, qmVector3Multiply(x, y)) \
+	X(Vector3, Scale, q_vector3, q_vector3, qmVector3Scale(x, s)) \
+	X(Vector3, Normalize, q_vector3, q_vector3, qmVector3Normalize(x)) \
+	X(Vector3, Lerp, q_vector3, q_vector3, qmVector3Lerp(s, x, y)) \
+	X(Vector3, CrossProduct, q_vector3, q_vector3, qmVector3CrossProduct(x, y)) \
+	X(Vector3, Reflect, q_vector3, q_vector3, qmVector3Reflect(x, y)) \
+	X(Vector3, ClampMag, q_vector3, q_vector3, qmVector3ClampMag(x, 0.5f, 2.0f)) \
+	X(Vector3, RotateByAxis, q_vector3, q_vector3, qmVector3RotateByAxis(x, y, s)) \
+	X(Vector4, Add, q_vector4, q_vector4, qmVector4Add(x, y)) \
+	X(Vector4, Multiply, q_vector4, q_vector4, qmVector4Multiply(x, y)) \
+	X(Vector4, Scale, q_vector4, q_vector4, qmVector4Scale(x, s)) \
+	X(Vector4, Normalize, q_vector4, q_vector4, qmVector4Normalize(x)) \
+	X(Vector4, Lerp, q_vector4, q_vector4, qmVector4Lerp(s, x, y)) \
+	X(Vector4, Min, q_vector4, q_vector4, qmVector4Min(x, y)) \
+	X(Matrix22, Add, q_matrix22, q_matrix22, qmMatrix22Add(x, y)) \
+	X(Matrix22, MultiplyMatrix22, q_matrix22, q_matrix22, qmMatrix22MultiplyMatrix22(x, y)) \
+	X(Matrix22, Transpose, q_matrix22, q_matrix22, qmMatrix22Transpose(x)) \
+	X(Matrix22, Inverse, q_matrix22, q_matrix22, qmMatrix22Inverse(x)) \
+	X(Matrix33, Add, q_matrix33, q_matrix33, qmMatrix33Add(x, y)) \
+	X(Matrix33, MultiplyMatrix33, q_matrix33, q_matrix33, qmMatrix33MultiplyMatrix33(x, y)) \
+	X(Matrix33, Transpose, q_matrix33, q_matrix33, qmMatrix33Transpose(x)) \
+	X(Matrix33, Inverse, q_matrix33, q_matrix33, qmMatrix33Inverse(x)) \
+	X(Matrix44, Add, q_matrix44, q_matrix44, qmMatrix44Add(x, y)) \
+	X(Matrix44, MultiplyMatrix44, q_matrix44, q_matrix44, qmMatrix44MultiplyMatrix44(x, y)) \
+	X(Matrix44, Transpose, q_matrix44, q_matrix44, qmMatrix44Transpose(x)) \
+	X(Matrix44, Inverse, q_matrix44, q_matrix44, qmMatrix44Inverse(x)) \
+	X(Matrix44, InverseAffine, q_matrix44, q_matrix44, qmMatrix44InverseAffine(x)) \
+	X(Matrix44, InverseRigid, q_matrix44, q_matrix44, qmMatrix44InverseRigid(x)) \
+	X(Quaternion, Add, q_quaternion, q_quaternion, qmQuaternionAdd(x, y)) \
+	X(Quaternion, Multiply, q_quaternion, q_quaternion, qmQuaternionMultiply(x, y)) \
+	X(Quaternion, Scale, q_quaternion, q_quaternion, qmQuaternionScale(x, s)) \
+	X(Quaternion, Normalize, q_quaternion, q_quaternion, qmQuaternionNormalize(x)) \
+	X(Quaternion, Invert, q_quaternion, q_quaternion, qmQuaternionInvert(x)) \
+	X(Quaternion, Lerp, q_quaternion, q_quaternion, qmQuaternionLerp(s, x, y)) \
+	X(Quaternion, Nlerp, q_quaternion, q_quaternion, qmQuaternionNlerp(s, x, y)) \
+	X(Quaternion, Slerp, q_quaternion, q_quaternion, qmQuaternionSlerp(s, x, y)) \
+	X(Quaternion, RotateVector3, q_vector3, q_quaternion, qmQuaternionRotateVector3(y, x))
+
+// Maps only measure throughput, as their result type differs from their input.
+// Each case is (family, name, result type, type, argument type, call).
+#define BENCH_MAPS(X) \
+	X(Vector2, Length, q_float, q_vector2, q_vector2, qmVector2Length(x)) \
+	X(Vector2, DotProduct, q_float, q_vector2, q_vector2, qmVector2DotProduct(x, y)) \
+	X(Vector2, Distance, q_float, q_vector2, q_vector2, qmVector2Distance(x, y)) \
+	X(Vector2, Angle, q_float, q_vector2, q_vector2, qmVector2Angle(x, y)) \
+	X(Vector3, Length, q_float, q_vector3, q_vector3, qmVector3Length(x)) \
+	X(Vector3, DotProduct, q_float, q_vector3, q_vector3, qmVector3DotProduct(x, y)) \
+	X(Vector3, Distance, q_float, q_vector3, q_vector3, qmVector3Distance(x, y)) \
+	X(Vector3, Angle, q_float, q_vector3, q_vector3, qmVector3Angle(x, y)) \
+	X(Vector4, Length, q_float, q_vector4, q_vector4, qmVector4Length(x)) \
+	X(Vector4, DotProduct, q_float, q_vector4, q_vector4, qmVector4DotProduct(x, y)) \
+	X(Matrix22, MultiplyVector2, q_vector2, q_matrix22, q_vector2, qmMatrix22MultiplyVector2(x, y)) \
+	X(Matrix22, Determinant, q_float, q_matrix22, q_matrix22, qmMatrix22Determinant(x)) \
+	X(Matrix23, MultiplyVector3, q_vector2, q_matrix23, q_vector3, qmMatrix23MultiplyVector3(x, y)) \
+	X(Matrix23, MultiplyMatrix32, q_matrix22, q_matrix23, q_matrix32, qmMatrix23MultiplyMatrix32(x, y)) \
+	X(Matrix23, Transpose, q_matrix32, q_matrix23, q_matrix23, qmMatrix23Transpose(x)) \
+	X(Matrix24, MultiplyVector4, q_vector2, q_matrix24, q_vector4, qmMatrix24MultiplyVector4(x, y)) \
+	X(Matrix24, MultiplyMatrix42, q_matrix22, q_matrix24, q_matrix42, qmMatrix24MultiplyMatrix42(x, y)) \
+	X(Matrix24, Transpose, q_matrix42, q_matrix24, q_matrix24, qmMatrix24Transpose(x)) \
+	X(Matrix32, MultiplyVector2, q_vector3, q_matrix32, q_vector2, qmMatrix32MultiplyVector2(x, y)) \
+	X(Matrix32, MultiplyMatrix23, q_matrix33, q_matrix32, q_matrix23, qmMatrix32MultiplyMatrix23(x, y)) \
+	X(Matrix32, Transpose, q_matrix23, q_matrix32, q_matrix32, qmMatrix32Transpose(x)) \
+	X(Matrix33, MultiplyVector3, q_vector3, q_matrix33, q_vector3, qmMatrix33MultiplyVector3(x, y)) \
+	X(Matrix33, Determinant, q_float, q_matrix33, q_matrix33, qmMatrix33Determinant(x)) \
+	X(Matrix34, MultiplyVector4, q_vector3, q_matrix34, q_vector4, qmMatrix34MultiplyVector4(x, y)) \
+	X(Matrix34, MultiplyMatrix43, q_matrix33, q_matrix34, q_matrix43, qmMatrix34MultiplyMatrix43(x, y)) \
+	X(Matrix34, Transpose, q_matrix43, q_matrix34, q_matrix34, qmMatrix34Transpose(x)) \
+	X(Matrix42, MultiplyVector2, q_vector4, q_matrix42, q_vector2, qmMatrix42MultiplyVector2(x, y)) \
+	X(Matrix42, MultiplyMatrix24, q_matrix44, q_matrix42, q_matrix24, qmMatrix42MultiplyMatrix24(x, y)) \
+	X(Matrix42, Transpose, q_matrix24, q_matrix42, q_matrix42, qmMatrix42Transpose(x)) \
+	X(Matrix43, MultiplyVector3, q_vector4, q_matrix43, q_vector3, qmMatrix43MultiplyVector3(x, y)) \
+	X(Matrix43, MultiplyMatrix34, q_matrix44, q_matrix43, q_matrix34, qmMatrix43MultiplyMatrix34(x, y)) \
+	X(Matrix43, Transpose, q_matrix34, q_matrix43, q_matrix43, qmMatrix43Transpose(x)) \
+	X(Matrix44, MultiplyVector4, q_vector4, q_matrix44, q_vector4, qmMatrix44MultiplyVector4(x, y)) \
+	X(Matrix44, Determinant, q_float, q_matrix44, q_matrix44, qmMatrix44Determinant(x)) \
+	X(Transform, Translate, q_matrix44, q_vector3, q_vector3, qmMatrix44Translate(x.x, x.y, x.z)) \
+	X(Transform, Scale, q_matrix44, q_vector3, q_vector3, qmMatrix44Scale(x.x, x.y, x.z)) \
+	X(Transform, Rotate, q_matrix44, q_vector3, q_vector3, qmMatrix44Rotate(qmVector3Normalize(x), s)) \
+	X(Transform, RotateX, q_matrix44, q_float, q_float, qmMatrix44RotateX(s)) \
+	X(Transform, RotateXYZ, q_matrix44, q_vector3, q_vector3, qmMatrix44RotateXYZ(x)) \
+	X(Transform, Frustum, q_matrix44, q_float, q_float, qmMatrix44Frustum(-s, s, s, -s, 0.1f, 100.0f)) \
+	X(Transform, Perspective, q_matrix44, q_float, q_float, qmMatrix44Perspective(s, 1.5f, 0.1f, 100.0f)) \
+	X(Transform, Orthographic, q_matrix44, q_float, q_float, qmMatrix44Orthographic(-s, s, s, -s, 0.1f, 100.0f)) \
+	X(Transform, LookAt, q_matrix44, q_vector3, q_vector3, qmMatrix44LookAt(x, y, qmVector3Normalize(qmVector3CrossProduct(x, y)))) \
+	X(Quaternion, Length, q_float, q_quaternion, q_quaternion, qmQuaternionLength(x)) \
+	X(Quaternion, FromAxisAngle, q_quaternion, q_vector3, q_vector3, qmQuaternionFromAxisAngle(x, s)) \
+	X(Quaternion, FromEuler, q_quaternion, q_vector3, q_vector3, qmQuaternionFromEuler(x)) \
+	X(Quaternion, FromMatrix44, q_quaternion, q_matrix44, q_matrix44, qmQuaternionFromMatrix44(x)) \
+	X(Quaternion, ToMatrix44, q_matrix44, q_quaternion, q_quaternion, qmQuaternionToMatrix44(x))
+
+// Latency over a dependency chain
+#define BENCH_LATENCY(family, name, T, U, call) \
+	static q_void family##name##Latency(q_handle context, q_ulong count) \
+	{ \
+		bench_data *data = context; \
+		const U *b = (const U *)data->b; \
+		T x = *(const T *)data->a; \
+		for (q_ulong i = 0; i < count; i++) \
+		{ \
+			U y = b[i & data->mask]; \
+			q_float s = data->f[i & data->mask]; \
+			(q_void)y; \
+			(q_void)s; \
+			x = call; \
+		} \
+		benchEscape(&x); \
+	}
+
+// Throughput over independent array elements
+#define BENCH_THROUGHPUT(family, name, R, T, U, call) \
+	static q_void family##name##Throughput(q_handle context, q_ulong count) \
+	{ \
+		bench_data *data = context; \
+		const T *a = (const T *)data->a; \
+		const U *b = (const U *)data->b; \
+		R *r = data->r; \
+		for (q_ulong i = 0; i < count; i++) \
+		{ \
+			q_ulong j = i & data->mask; \
+			T x = a[j]; \
+			U y = b[j]; \
+			q_float s = data->f[j]; \
+			(q_void)x; \
+			(q_void)y; \
+			(q_void)s; \
+			r[j] = call; \
+		} \
+		benchEscape(r); \
+	}
+
+#define BENCH_CHAIN(family, name, T, U, call) \
+	BENCH_LATENCY(family, name, T, U, call) \
+	BENCH_THROUGHPUT(family, name, T, T, U, call)
+
+BENCH_CHAINS(BENCH_CHAIN)
+BENCH_MAPS(BENCH_THROUGHPUT)
+
+//// Array kernels ////
+
+// Get next batch length, batches never exceed the arrays
+static q_ulong benchBatchLength(const bench_data *data, q_ulong remaining)
+{
+	return remaining < data->mask + 1 ? remaining : data->mask + 1;
+}
+
+// Vector3 batch over the x, y and z thirds of each array
+static q_vector3_batch benchBatch(q_floatp base, q_ulong count)
+{
+	q_vector3_batch batch = { base, base + count, base + count * 2, (q_uint)count };
+	return batch;
+}
+
+static q_void FloatBatchSinCosThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_floatp result = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmFloatBatchSinCos(result, result + n, data->a, (q_uint)n);
+	}
+	benchEscape(result);
+}
+
+// Per-call libm loop the sine and cosine kernel replaces
+static q_void FloatSinCosLoopThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_floatp result = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		for (q_ulong i = 0; i < n; i++)
+		{
+			result[i] = sinf(data->a[i]);
+			result[n + i] = cosf(data->a[i]);
+		}
+	}
+	benchEscape(result);
+}
+
+static q_void Vector3BatchAddThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmVector3BatchAdd(benchBatch(data->r, n), benchBatch(data->a, n), benchBatch(data->b, n));
+	}
+	benchEscape(data->r);
+}
+
+static q_void Vector3BatchNormalizeThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmVector3BatchNormalize(benchBatch(data->r, n), benchBatch(data->a, n));
+	}
+	benchEscape(data->r);
+}
+
+static q_void Vector3BatchTransformThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_matrix44 mat = *(const q_matrix44 *)data->b;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmVector3BatchTransform(benchBatch(data->r, n), benchBatch(data->a, n), mat);
+	}
+	benchEscape(data->r);
+}
+
+static q_void Vector3BatchRotateThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_quaternion quat = qmQuaternionNormalize(*(const q_quaternion *)data->b);
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmVector3BatchRotate(benchBatch(data->r, n), benchBatch(data->a, n), quat);
+	}
+	benchEscape(data->r);
+}
+
+static q_void Vector3BatchDotProductThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmVector3BatchDotProduct(data->r, benchBatch(data->a, n), benchBatch(data->b, n));
+	}
+	benchEscape(data->r);
+}
+
+// Per-call loop the array kernels replace
+static q_void Matrix44MultiplyVector4LoopThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_matrix44 mat = *(const q_matrix44 *)data->b;
+	const q_vector4 *vec = (const q_vector4 *)data->a;
+	q_vector4 *result = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		for (q_ulong i = 0; i < n; i++)
+		{
+			result[i] = qmMatrix44MultiplyVector4(mat, vec[i]);
+		}
+	}
+	benchEscape(result);
+}
+
+static q_void Matrix44MultiplyVector4ArrayThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_matrix44 mat = *(const q_matrix44 *)data->b;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmMatrix44MultiplyVector4Array(data->r, mat, (const q_vector4 *)data->a, (q_uint)n, q_false);
+	}
+	benchEscape(data->r);
+}
+
+static q_void Matrix44MultiplyVector4StreamThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_matrix44 mat = *(const q_matrix44 *)data->b;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmMatrix44MultiplyVector4Array(data->r, mat, (const q_vector4 *)data->a, (q_uint)n, q_true);
+	}
+	benchEscape(data->r);
+}
+
+static q_void QuaternionRotateVector3ArrayThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_quaternion quat = qmQuaternionNormalize(*(const q_quaternion *)data->b);
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmQuaternionRotateVector3Array(data->r, quat, (const q_vector3 *)data->a, (q_uint)n);
+	}
+	benchEscape(data->r);
+}
+
+static q_void DualQuatSkinVector3ArrayThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	const q_vector3 *vec = (const q_vector3 *)data->a;
+	q_vector3 *result = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		qmDualQuatSkinVector3Array(result, q_null, vec, q_null, data->pose, data->index, data->weight, BENCH_SKIN_INFLUENCES, (q_uint)n);
+	}
+	benchEscape(result);
+}
+
+// Matrix linear blend skinning the dual quaternion kernel replaces
+static q_void Matrix44SkinLoopThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	const q_vector3 *vec = (const q_vector3 *)data->a;
+	q_vector3 *result = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		for (q_ulong i = 0; i < n; i++)
+		{
+			q_vector4 point = { vec[i].x, vec[i].y, vec[i].z, 1.0f };
+			q_vector4 sum = { 0.0f, 0.0f, 0.0f, 0.0f };
+			for (q_uint k = 0; k < BENCH_SKIN_INFLUENCES; k++)
+			{
+				q_ulong j = i * BENCH_SKIN_INFLUENCES + k;
+				sum = qmVector4Add(sum, qmVector4Scale(qmMatrix44MultiplyVector4(data->joint[data->index[j]], point), data->weight[j]));
+			}
+			result[i].x = sum.x;
+			result[i].y = sum.y;
+			result[i].z = sum.z;
+		}
+	}
+	benchEscape(result);
+}
+
+static q_void FrustumCullSphereBatchThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		benchEscape(qmFrustumCullSphereBatch(data->r, data->frustum, benchBatch(data->a, n), data->f));
+	}
+	benchEscape(data->r);
+}
+
+static q_void FrustumCullAabbBatchThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		benchEscape(qmFrustumCullAabbBatch(data->r, data->frustum, benchBatch(data->a, n), benchBatch(data->f, n)));
+	}
+	benchEscape(data->r);
+}
+
+// Per-call loop the sphere cull kernel replaces
+static q_void FrustumCullSphereLoopThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_uint *visible = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		q_vector3_batch center = benchBatch(data->a, n);
+		q_uint found = 0;
+		for (q_uint i = 0; i < (q_uint)n; i++)
+		{
+			q_vector3 point = { center.x[i], center.y[i], center.z[i] };
+			if (qmFrustumIntersectsSphere(data->frustum, point, data->f[i]))
+			{
+				visible[found++] = i;
+			}
+		}
+		benchEscape(found);
+	}
+	benchEscape(visible);
+}
+
+// Oriented boxes over the fifteen thirds of the first array
+static q_obb_batch benchObbBatch(q_floatp base, q_ulong count)
+{
+	q_obb_batch batch = {
+		benchBatch(base, count),
+		{ benchBatch(base + count * 3, count), benchBatch(base + count * 6, count), benchBatch(base + count * 9, count) },
+		benchBatch(base + count * 12, count)
+	};
+	return batch;
+}
+
+static q_void AabbIntersectsAabbBatchThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_aabb aabb = { { 0.75f, 0.75f, 0.75f }, { 1.25f, 1.25f, 1.25f } };
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		benchEscape(qmAabbIntersectsAabbBatch(data->r, aabb, benchBatch(data->a, n), benchBatch(data->b, n)));
+	}
+	benchEscape(data->r);
+}
+
+static q_void SphereIntersectsSphereBatchThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_sphere sphere = { { 1.0f, 1.0f, 1.0f }, 0.25f };
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		benchEscape(qmSphereIntersectsSphereBatch(data->r, sphere, benchBatch(data->a, n), data->f));
+	}
+	benchEscape(data->r);
+}
+
+static q_void ObbIntersectsObbBatchThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_obb obb = qmObbFromAabb(qmAabbFromCenterExtent((q_vector3){ 1.0f, 1.0f, 1.0f }, (q_vector3){ 0.5f, 0.5f, 0.5f }), qmQuaternionToMatrix44(qmQuaternionNormalize(*(const q_quaternion *)data->b)));
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		benchEscape(qmObbIntersectsObbBatch(data->r, obb, benchObbBatch(data->a, n)));
+	}
+	benchEscape(data->r);
+}
+
+// Per-call loop the oriented box kernel replaces
+static q_void ObbIntersectsObbLoopThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_obb obb = qmObbFromAabb(qmAabbFromCenterExtent((q_vector3){ 1.0f, 1.0f, 1.0f }, (q_vector3){ 0.5f, 0.5f, 0.5f }), qmQuaternionToMatrix44(qmQuaternionNormalize(*(const q_quaternion *)data->b)));
+	q_uint *hit = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		q_obb_batch other = benchObbBatch(data->a, n);
+		q_uint found = 0;
+		for (q_uint i = 0; i < (q_uint)n; i++)
+		{
+			q_obb box = {
+				{ other.center.x[i], other.center.y[i], other.center.z[i] },
+				{
+					{ other.axis[0].x[i], other.axis[0].y[i], other.axis[0].z[i] },
+					{ other.axis[1].x[i], other.axis[1].y[i], other.axis[1].z[i] },
+					{ other.axis[2].x[i], other.axis[2].y[i], other.axis[2].z[i] }
+				},
+				{ other.extent.x[i], other.extent.y[i], other.extent.z[i] }
+			};
+			if (qmObbIntersectsObb(obb, box))
+			{
+				hit[found++] = i;
+			}
+		}
+		benchEscape(found);
+	}
+	benchEscape(hit);
+}
+
+static q_void RayIntersectsAabbBatchThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_ray ray = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		benchEscape(qmRayIntersectsAabbBatch(data->r, (q_floatp)data->r + n, ray, benchBatch(data->a, n), benchBatch(data->b, n)));
+	}
+	benchEscape(data->r);
+}
+
+// Per-call loop the ray kernel replaces
+static q_void RayIntersectsAabbLoopThroughput(q_handle context, q_ulong count)
+{
+	bench_data *data = context;
+	q_ray ray = { { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f } };
+	q_uint *hit = data->r;
+	for (q_ulong done = 0, n; done < count; done += n)
+	{
+		n = benchBatchLength(data, count - done);
+		q_vector3_batch min = benchBatch(data->a, n);
+		q_vector3_batch max = benchBatch(data->b, n);
+		q_floatp distance = (q_floatp)hit + n;
+		q_uint found = 0;
+		for (q_uint i = 0; i < (q_uint)n; i++)
+		{
+			q_aabb aabb = { { min.x[i], min.y[i], min.z[i] }, { max.x[i], max.y[i], max.z[i] } };
+			if (qmRayIntersectsAabb(ray, aabb, distance + found))
+			{
+				hit[found++] = i;
+			}
+		}
+		benchEscape(found);
+	}
+	benchEscape(hit);
+}
+
+//// Main ////
+
+int main(int argc, char **argv)
+{
+	if (!benchInit(argc, argv, "qmath"))
+	{
+		return 1;
+	}
+
+#if defined(Q_MATH_SSE)
+	// Chains that shrink toward zero would otherwise time denormal arithmetic
+	_mm_setcsr(_mm_getcsr() | 0x8040);
+#endif /* Q_MATH_SSE */
+
+	// Every array holds size elements of the largest type
+	q_ulong size = bench_config.size;
+	q_ulong floats = size * (sizeof(q_matrix44) / sizeof(q_float));
+	bench_data data;
+	data.a = quAllocAligned(floats * sizeof(q_float), 64);
+	data.b = quAllocAligned(floats * sizeof(q_float), 64);
+	data.f = quAllocAligned(size * sizeof(q_float), 64);
+	data.r = quAllocAligned(floats * sizeof(q_float), 64);
+	data.mask = size - 1;
+	data.pose = quAllocAligned(BENCH_SKIN_JOINTS * sizeof(q_dualquat), 64);
+	data.joint = quAllocAligned(BENCH_SKIN_JOINTS * sizeof(q_matrix44), 64);
+	data.index = quAllocAligned(size * BENCH_SKIN_INFLUENCES * sizeof(q_uint), 64);
+	data.weight = quAllocAligned(size * BENCH_SKIN_INFLUENCES * sizeof(q_float), 64);
+	if (data.a == q_null || data.b == q_null || data.f == q_null || data.r == q_null ||
+		data.pose == q_null || data.joint == q_null || data.index == q_null || data.weight == q_null)
+	{
+		fprintf(stderr, "%s: cannot allocate %llu elements\n", argv[0], size);
+		return 1;
+	}
+
+	// Fixed seed keeps runs comparable
+	q_uint seed = 12345;
+	for (q_ulong i = 0; i < floats; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		data.a[i] = 0.5f + (q_float)(seed >> 8) / 16777216.0f;
+		seed = seed * 1664525u + 1013904223u;
+		data.b[i] = 0.5f + (q_float)(seed >> 8) / 16777216.0f;
+	}
+	for (q_ulong i = 0; i < size; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		data.f[i] = (q_float)(seed >> 8) / 16777216.0f;
+	}
+
+	// Same rigid palette as dual quaternions and matrices, weights summing to one
+	for (q_uint j = 0; j < BENCH_SKIN_JOINTS; j++)
+	{
+		q_quaternion rotation = { data.a[j * 4], data.a[j * 4 + 1], data.a[j * 4 + 2], data.a[j * 4 + 3] };
+		q_vector3 translation = { data.b[j * 3], data.b[j * 3 + 1], data.b[j * 3 + 2] };
+		data.pose[j] = qmDualQuatFromRotationTranslation(qmQuaternionNormalize(rotation), translation);
+		data.joint[j] = *(const q_matrix44 *)(data.b + j * 16);
+	}
+	for (q_ulong i = 0; i < size * BENCH_SKIN_INFLUENCES; i++)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		data.index[i] = (seed >> 8) % BENCH_SKIN_JOINTS;
+		data.weight[i] = 1.0f / BENCH_SKIN_INFLUENCES;
+	}
+
+	// Camera on the edge of the element cube looking in, so about half the bounds are visible
+	q_matrix44 view = qmMatrix44LookAt((q_vector3){ 0.5f, 1.0f, 1.0f }, (q_vector3){ 1.5f, 1.0f, 1.0f }, (q_vector3){ 0.0f, 1.0f, 0.0f });
+	data.frustum = qmFrustumFromMatrix44(qmMatrix44MultiplyMatrix44(qmMatrix44Perspective(Q_RAD(90.0f), 1.0f, 0.1f, 100.0f), view));
+
+#if defined(QM_SIMD)
+	printf("qmath: SIMD enabled, %llu elements per array\n", size);
+#else
+	printf("qmath: scalar, %llu elements per array\n", size);
+#endif /* QM_SIMD */
+
+	#define BENCH_RUN_CHAIN(family, name, T, U, call) \
+		benchRun(#family, #name, "latency", family##name##Latency, &data); \
+		benchRun(#family, #name, "throughput", family##name##Throughput, &data);
+	#define BENCH_RUN_MAP(family, name, R, T, U, call) \
+		benchRun(#family, #name, "throughput", family##name##Throughput, &data);
+
+	BENCH_CHAINS(BENCH_RUN_CHAIN)
+	BENCH_MAPS(BENCH_RUN_MAP)
+
+	// Batch kernels once per variant this processor supports, restoring the startup choice after
+	q_math_isa selected = qmDispatchGetIsa();
+	printf("qmath: kernels dispatched to %s\n", qmDispatchIsaName(selected));
+	for (q_int isa = 0; isa < Q_MATH_ISA_COUNT; isa++)
+	{
+		if (!qmDispatchSetIsa((q_math_isa)isa))
+		{
+			continue;
+		}
+
+		char family[32];
+		snprintf(family, sizeof(family), "Batch/%s", qmDispatchIsaName((q_math_isa)isa));
+		benchRun(family, "FloatSinCos", "throughput", FloatBatchSinCosThroughput, &data);
+		benchRun(family, "Vector3Add", "throughput", Vector3BatchAddThroughput, &data);
+		benchRun(family, "Vector3Normalize", "throughput", Vector3BatchNormalizeThroughput, &data);
+		benchRun(family, "Vector3Transform", "throughput", Vector3BatchTransformThroughput, &data);
+		benchRun(family, "Vector3Rotate", "throughput", Vector3BatchRotateThroughput, &data);
+		benchRun(family, "Vector3DotProduct", "throughput", Vector3BatchDotProductThroughput, &data);
+		benchRun(family, "Matrix44Vector4Array", "throughput", Matrix44MultiplyVector4ArrayThroughput, &data);
+		benchRun(family, "Matrix44Vector4Stream", "throughput", Matrix44MultiplyVector4StreamThroughput, &data);
+		benchRun(family, "QuaternionRotateArray", "throughput", QuaternionRotateVector3ArrayThroughput, &data);
+		benchRun(family, "DualQuatSkin", "throughput", DualQuatSkinVector3ArrayThroughput, &data);
+		benchRun(family, "FrustumCullSphere", "throughput", FrustumCullSphereBatchThroughput, &data);
+		benchRun(family, "FrustumCullAabb", "throughput", FrustumCullAabbBatchThroughput, &data);
+		benchRun(family, "AabbIntersectsAabb", "throughput", AabbIntersectsAabbBatchThroughput, &data);
+		benchRun(family, "SphereIntersectsSphere", "throughput", SphereIntersectsSphereBatchThroughput, &data);
+		benchRun(family, "ObbIntersectsObb", "throughput", ObbIntersectsObbBatchThroughput, &data);
+		benchRun(family, "RayIntersectsAabb", "throughput", RayIntersectsAabbBatchThroughput, &data);
+	}
+	qmDispatchSetIsa(selected);
+	benchRun("Batch", "FloatSinCosLoop", "throughput", FloatSinCosLoopThroughput, &data);
+	benchRun("Batch", "Matrix44Vector4Loop", "throughput", Matrix44MultiplyVector4LoopThroughput, &data);
+	benchRun("Batch", "Matrix44SkinLoop", "throughput", Matrix44SkinLoopThroughput, &data);
+	benchRun("Batch", "FrustumCullSphereLoop", "throughput", FrustumCullSphereLoopThroughput, &data);
+	benchRun("Batch", "ObbIntersectsObbLoop", "throughput", ObbIntersectsObbLoopThroughput, &data);
+	benchRun("Batch", "RayIntersectsAabbLoop", "throughput", RayIntersectsAabbLoopThroughput, &data);
+
+	quFreeAligned(data.a);
+	quFreeAligned(data.b);
+	quFreeAligned(data.f);
+	quFreeAligned(data.r);
+	quFreeAligned(data.pose);
+	quFreeAligned(data.joint);
+	quFreeAligned(data.index);
+	quFreeAligned(data.weight);
+	return benchFinish();
+}
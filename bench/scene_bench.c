@@ -0,0 +1,227 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// bench/scene_bench.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Keep private copies of the inline math functions, which the library does not export
+#if !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE)
+	#define Q_MATH_STATIC_INLINE
+#endif /* !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE) */
+
+#include <stdio.h> // printf, fprintf
+
+#include "qscene.h"
+#include "qutils.h"
+#include "bench.h"
+
+//// Data ////
+
+// Nodes per element of --size, so the default scene has 128k nodes
+#define BENCH_SCENE_SCALE 32
+
+// Deepest parent chain in the generated hierarchy
+#define BENCH_SCENE_DEPTH 12
+
+// One in this many nodes starts a new root
+#define BENCH_SCENE_ROOT 1024
+
+// Nodes moved per frame in the sparse update cases
+#define BENCH_SCENE_MOVED 16
+
+// Node of the parent chain walk the scene replaces
+typedef struct bench_chain
+{
+	q_matrix44 local;
+	q_matrix44 world;
+	q_uint parent;
+} bench_chain;
+
+typedef struct bench_scene
+{
+	q_scene *scene;
+	bench_chain *chain;
+	q_uint *roots;
+	q_uint count;
+	q_uint rootCount;
+	q_uint threads;
+	q_uint random;
+	q_float angle;
+} bench_scene;
+
+// Local matrix of a translation and a rotation about y
+static q_matrix44 benchLocal(q_vector3 translation, q_quaternion rotation)
+{
+	return qmMatrix44MultiplyMatrix44(qmMatrix44Translate(translation.x, translation.y, translation.z), qmQuaternionToMatrix44(rotation));
+}
+
+// Move some random nodes the way an animated frame would
+static q_void benchMove(bench_scene *data, q_uint moved)
+{
+	data->angle += 0.01f;
+	q_quaternion rotation = qmQuaternionFromAxisAngle((q_vector3){ 0.0f, 1.0f, 0.0f }, data->angle);
+	for (q_uint i = 0; i < moved; i++)
+	{
+		q_uint node = benchRandom(&data->random) % data->count;
+		qsSetRotation(data->scene, node, rotation);
+		data->chain[node].local = benchLocal(qsGetTranslation(data->scene, node), rotation);
+	}
+}
+
+// Move every root, which moves every node in the scene
+static q_void benchMoveRoots(bench_scene *data)
+{
+	data->angle += 0.01f;
+	q_quaternion rotation = qmQuaternionFromAxisAngle((q_vector3){ 0.0f, 1.0f, 0.0f }, data->angle);
+	for (q_uint i = 0; i < data->rootCount; i++)
+	{
+		qsSetRotation(data->scene, data->roots[i], rotation);
+	}
+}
+
+//// Cases ////
+
+// World matrices rebuilt by walking every parent chain
+static q_void SceneChainWalk(q_handle context, q_ulong count)
+{
+	bench_scene *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		benchMove(data, BENCH_SCENE_MOVED);
+		for (q_uint i = 0; i < data->count; i++)
+		{
+			q_matrix44 world = data->chain[i].local;
+			for (q_uint p = data->chain[i].parent; p != Q_SCENE_NONE; p = data->chain[p].parent)
+			{
+				world = qmMatrix44MultiplyMatrix44(data->chain[p].local, world);
+			}
+			data->chain[i].world = world;
+		}
+		benchEscape(data->chain);
+	}
+}
+
+// Every root moved, so the linear pass recomputes the whole scene
+static q_void SceneUpdateAll(q_handle context, q_ulong count)
+{
+	bench_scene *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		benchMoveRoots(data);
+		benchEscape(qsUpdate(data->scene));
+	}
+}
+
+// Few nodes moved, so the pass only recomputes their subtrees
+static q_void SceneUpdateSparse(q_handle context, q_ulong count)
+{
+	bench_scene *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		benchMove(data, BENCH_SCENE_MOVED);
+		benchEscape(qsUpdate(data->scene));
+	}
+}
+
+// Root subtrees are disjoint, so threads take every threads-th one
+static q_void benchSceneThread(q_handle context, q_uint index)
+{
+	bench_scene *data = context;
+	for (q_uint i = index; i < data->rootCount; i += data->threads)
+	{
+		qsUpdateSubtree(data->scene, data->roots[i]);
+	}
+}
+
+static q_void SceneUpdateThreaded(q_handle context, q_ulong count)
+{
+	bench_scene *data = context;
+	for (q_ulong n = 0; n < count; n++)
+	{
+		benchMoveRoots(data);
+		qsUpdateBegin(data->scene);
+		benchThreads(data->threads, benchSceneThread, data);
+	}
+}
+
+//// Main ////
+
+int main(int argc, char **argv)
+{
+	if (!benchInit(argc, argv, "scene"))
+	{
+		return 1;
+	}
+
+	bench_scene data = { 0 };
+	data.count = (q_uint)bench_config.size * BENCH_SCENE_SCALE;
+	data.random = 1;
+	data.scene = qsCreate(data.count);
+	data.chain = quAlloc(data.count * sizeof(bench_chain));
+	data.roots = quAlloc(data.count * sizeof(q_uint));
+	if (data.scene == q_null || data.chain == q_null || data.roots == q_null)
+	{
+		fprintf(stderr, "%s: cannot allocate %u nodes\n", argv[0], data.count);
+		return 1;
+	}
+
+	// Parents come from the current path, so nodes arrive in depth-first order. Half of the
+	// nodes are children of the one before, and one in BENCH_SCENE_ROOT starts a new root.
+	q_uint path[BENCH_SCENE_DEPTH];
+	q_uint depth = 0;
+	q_ulong total = 0;
+	for (q_uint i = 0; i < data.count; i++)
+	{
+		q_uint random = benchRandom(&data.random);
+		if (depth == 0 || random % BENCH_SCENE_ROOT == 0)
+		{
+			depth = 0;
+		}
+		else if (random & (1u << 16) || depth == BENCH_SCENE_DEPTH)
+		{
+			depth = 1 + (random >> 17) % depth;
+		}
+		q_uint parent = depth == 0 ? Q_SCENE_NONE : path[depth - 1];
+		q_uint node = qsAdd(data.scene, parent);
+		if (parent == Q_SCENE_NONE)
+		{
+			data.roots[data.rootCount++] = node;
+		}
+		path[depth++] = node;
+		total += depth;
+
+		q_vector3 translation = { (q_float)(i % 7), 1.0f, (q_float)(i % 5) };
+		qsSetTranslation(data.scene, node, translation);
+		data.chain[node].local = benchLocal(translation, qmQuaternionIdentity());
+		data.chain[node].parent = parent;
+	}
+	qsUpdate(data.scene);
+	printf("scene: %u nodes, %u roots, mean depth %.2f\n", data.count, data.rootCount, (q_double)total / data.count);
+
+	benchRun("Scene", "ChainWalk", "latency", SceneChainWalk, &data);
+	benchRun("Scene", "UpdateAll", "latency", SceneUpdateAll, &data);
+	benchRun("Scene", "UpdateSparse", "latency", SceneUpdateSparse, &data);
+	for (data.threads = 2; data.threads <= bench_config.threads; data.threads *= 2)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "UpdateThreaded/%u", data.threads);
+		benchRun("Scene", name, "latency", SceneUpdateThreaded, &data);
+	}
+
+	quFree(data.roots);
+	quFree(data.chain);
+	qsDestroy(data.scene);
+	return benchFinish();
+}
@@ -0,0 +1,1551 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qbvh.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Keep private copies of the inline functions unless the caller asked for external ones
+#if !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE)
+	#define Q_MATH_STATIC_INLINE
+#endif /* !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE) */
+
+// Node tests use the SIMD helpers the target supports
+#if !defined(Q_MATH_SIMD)
+	#define Q_MATH_SIMD
+#endif /* Q_MATH_SIMD */
+
+#include <stdatomic.h> // atomic_fetch_add_explicit, atomic_store_explicit
+#include <stdlib.h> // qsort
+#include <string.h> // memset
+#include "qbvh.h"
+#include "qutils.h"
+
+#if defined(_WIN32)
+	#include <windows.h> // CreateThread, WaitForSingleObject, CloseHandle
+#else
+	#include <pthread.h> // pthread_create, pthread_join
+#endif /* defined(_WIN32) */
+
+#if Q_BVH_WIDTH != 2 && Q_BVH_WIDTH != 4 && Q_BVH_WIDTH != 8
+	#error "Q_BVH_WIDTH must be 2, 4 or 8"
+#endif /* Q_BVH_WIDTH != 2 && Q_BVH_WIDTH != 4 && Q_BVH_WIDTH != 8 */
+
+#if Q_BVH_LEAF_SIZE < 1 || Q_BVH_LEAF_SIZE > 255
+	#error "Q_BVH_LEAF_SIZE must be from 1 to 255"
+#endif /* Q_BVH_LEAF_SIZE < 1 || Q_BVH_LEAF_SIZE > 255 */
+
+// Nodes and primitive boxes start on cache lines
+#define Q_BVH_ALIGNMENT 64
+
+//// Internal types ////
+
+// Node of width w: the minimum x, y and z then the maximum x, y and z of its children as six
+// rows of w floats, then w child references and w primitive counts. Children with a count are
+// leaves starting at that primitive, others are nodes, and empty lanes hold inverted boxes.
+#define QB_NODE_SIZE(width) ((q_ulong)(width) * 32)
+
+// Build node references with this bit index build tasks instead of nodes
+#define QB_TASK 0x80000000u
+
+// Cost of visiting a node relative to testing one primitive
+#define QB_NODE_COST 1.0f
+
+// Depth beyond which ranges are halved instead of split by area, so degenerate inputs cannot
+// make the tree deeper than the traversal stacks allow
+#define QB_SAH_DEPTH 64
+
+// Enough stack for trees of the depth above, as each level pushes at most width - 1 entries
+#define QB_STACK_SIZE ((QB_SAH_DEPTH + 32) * 8)
+
+// Build tasks per thread, so threads that finish early take more, and the smallest task
+#define QB_TASKS_PER_THREAD 4
+#define QB_TASK_MIN 1024
+
+// Kernels are inlined into each width, so lane loops have a known length
+#if defined(__GNUC__) || defined(__clang__)
+	#define QB_INLINE static inline __attribute__((always_inline))
+#else
+	#define QB_INLINE static inline
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+struct q_bvh
+{
+	// Nodes in depth-first order, so children follow their parents
+	q_uchar *nodes;
+	q_uint nodeCount;
+	q_uint width;
+
+	// Primitive boxes in leaf order, with the index each primitive had in the build input
+	q_aabb *boxes;
+	q_uint *primitive;
+	q_uint count;
+
+	// Triangle vertices and indices in leaf order, null unless built from triangles
+	q_vector3 *triangles;
+	q_uint *indices;
+
+	q_aabb bounds;
+};
+
+// Binary node made while building, a leaf when count is not zero
+typedef struct q_bvh_build_node
+{
+	q_aabb bounds;
+	q_uint child[2];
+	q_uint first;
+	q_uint count;
+} q_bvh_build_node;
+
+typedef struct q_bvh_build_nodes
+{
+	q_bvh_build_node *node;
+	q_uint count;
+	q_uint capacity;
+} q_bvh_build_nodes;
+
+// Range of primitives built into its own subtree by one thread
+typedef struct q_bvh_task
+{
+	q_bvh_build_nodes nodes;
+	q_uint first;
+	q_uint count;
+	q_uint depth;
+} q_bvh_task;
+
+// Primitive partitioned in place while building, kept with its box so every pass over a
+// range reads memory in order
+typedef struct q_bvh_ref
+{
+	q_aabb box;
+	q_float centroid[3];
+	q_uint index;
+} q_bvh_ref;
+
+typedef struct q_bvh_builder
+{
+	q_bvh_ref *refs;
+	q_bvh_build build;
+
+	// Nodes above the tasks, and tasks taken in schedule order by the build threads
+	q_bvh_build_nodes top;
+	q_bvh_task *tasks;
+	q_uint *schedule;
+	q_uint taskCount;
+	q_uint taskSize;
+	_Atomic q_uint next;
+	_Atomic q_uint failed;
+} q_bvh_builder;
+
+// Build node being collapsed, with the nodes its child references index
+typedef struct q_bvh_item
+{
+	const q_bvh_build_node *node;
+	const q_bvh_build_nodes *nodes;
+} q_bvh_item;
+
+// Ray prepared for slab tests against node rows
+typedef struct q_bvh_ray
+{
+	q_float origin[3];
+	q_float inverse[3];
+	q_uint near[3];
+	q_uint far[3];
+} q_bvh_ray;
+
+// Node or leaf waiting on a traversal stack, with the distance of its box
+typedef struct q_bvh_entry
+{
+	q_uint child;
+	q_uint count;
+	q_float distance;
+} q_bvh_entry;
+
+//// Node layout ////
+
+// Merge boxes with plain comparisons, which compile to single instructions where the fmin
+// and fmax of qmAabbMerge become calls
+static inline q_aabb qbMerge(q_aabb left, q_aabb right)
+{
+	q_aabb result = {
+		{
+			left.min.x < right.min.x ? left.min.x : right.min.x,
+			left.min.y < right.min.y ? left.min.y : right.min.y,
+			left.min.z < right.min.z ? left.min.z : right.min.z
+		},
+		{
+			left.max.x > right.max.x ? left.max.x : right.max.x,
+			left.max.y > right.max.y ? left.max.y : right.max.y,
+			left.max.z > right.max.z ? left.max.z : right.max.z
+		}
+	};
+	return result;
+}
+
+// Get node rows
+QB_INLINE q_floatp qbNode(q_uchar *nodes, q_uint width, q_uint node)
+{
+	return (q_floatp)(nodes + (q_ulong)node * QB_NODE_SIZE(width));
+}
+
+// Get child references of node rows
+QB_INLINE q_uint *qbChildren(q_floatp rows, q_uint width)
+{
+	return (q_uint *)(rows + 6 * width);
+}
+
+// Get primitive counts of node rows
+QB_INLINE q_uchar *qbCounts(q_floatp rows, q_uint width)
+{
+	return (q_uchar *)(qbChildren(rows, width) + width);
+}
+
+// Set the box of one child
+static inline q_void qbSetLane(q_floatp rows, q_uint width, q_uint lane, q_aabb box)
+{
+	rows[lane] = box.min.x;
+	rows[width + lane] = box.min.y;
+	rows[2 * width + lane] = box.min.z;
+	rows[3 * width + lane] = box.max.x;
+	rows[4 * width + lane] = box.max.y;
+	rows[5 * width + lane] = box.max.z;
+}
+
+// Get the box around every child, where empty lanes change nothing
+static q_aabb qbNodeBounds(const q_bvh *bvh, q_uint node)
+{
+	q_uint width = bvh->width;
+	q_floatp rows = qbNode(bvh->nodes, width, node);
+	q_aabb result = qmAabbEmpty();
+	for (q_uint l = 0; l < width; l++)
+	{
+		q_aabb lane = {
+			{ rows[l], rows[width + l], rows[2 * width + l] },
+			{ rows[3 * width + l], rows[4 * width + l], rows[5 * width + l] }
+		};
+		result = qbMerge(result, lane);
+	}
+	return result;
+}
+
+// Get the box around primitives [first, first + count)
+static q_aabb qbLeafBounds(const q_bvh *bvh, q_uint first, q_uint count)
+{
+	q_aabb result = qmAabbEmpty();
+	for (q_uint i = first; i < first + count; i++)
+	{
+		result = qbMerge(result, bvh->boxes[i]);
+	}
+	return result;
+}
+
+//// Lane kernels ////
+
+#if defined(QM_SIMD)
+// Load four lanes of a node row
+static inline q_simd qbLoad(const q_float *row)
+{
+#if defined(Q_MATH_SSE)
+	return _mm_loadu_ps(row);
+#else
+	return vld1q_f32(row);
+#endif /* defined(Q_MATH_SSE) */
+}
+
+// Lane-wise minimum and maximum, taking right where left is not a number
+static inline q_simd qbMin(q_simd left, q_simd right)
+{
+#if defined(Q_MATH_SSE)
+	return _mm_min_ps(left, right);
+#else
+	return vminnmq_f32(left, right);
+#endif /* defined(Q_MATH_SSE) */
+}
+
+static inline q_simd qbMax(q_simd left, q_simd right)
+{
+#if defined(Q_MATH_SSE)
+	return _mm_max_ps(left, right);
+#else
+	return vmaxnmq_f32(left, right);
+#endif /* defined(Q_MATH_SSE) */
+}
+
+// Lanes of left where left <= right, and of other elsewhere
+static inline q_simd qbSelectLessEqual(q_simd left, q_simd right, q_simd other)
+{
+#if defined(Q_MATH_SSE)
+	__m128 mask = _mm_cmple_ps(left, right);
+	return _mm_or_ps(_mm_and_ps(mask, left), _mm_andnot_ps(mask, other));
+#else
+	return vbslq_f32(vcleq_f32(left, right), left, other);
+#endif /* defined(Q_MATH_SSE) */
+}
+
+// Bit mask of the lanes where every row of low is at most the matching row of high
+static inline q_uint qbMaskLessEqual(const q_simd *low, const q_simd *high, q_uint rows)
+{
+#if defined(Q_MATH_SSE)
+	__m128 mask = _mm_cmple_ps(low[0], high[0]);
+	for (q_uint i = 1; i < rows; i++)
+	{
+		mask = _mm_and_ps(mask, _mm_cmple_ps(low[i], high[i]));
+	}
+	return (q_uint)_mm_movemask_ps(mask);
+#else
+	uint32x4_t mask = vcleq_f32(low[0], high[0]);
+	for (q_uint i = 1; i < rows; i++)
+	{
+		mask = vandq_u32(mask, vcleq_f32(low[i], high[i]));
+	}
+	uint32x4_t bits = { 1, 2, 4, 8 };
+	return vaddvq_u32(vandq_u32(mask, bits));
+#endif /* defined(Q_MATH_SSE) */
+}
+#endif /* QM_SIMD */
+
+// Entry distance of the ray into each child within limit, or infinity where it misses.
+// Entry and exit planes come from the direction signs, so inverted boxes are always missed,
+// and a plane through the origin parallel to the ray leaves its axis unconstrained.
+QB_INLINE q_void qbRayLanes(q_floatp entry, const q_float *rows, q_uint width, const q_bvh_ray *ray, q_float limit)
+{
+	const q_float *nx = rows + ray->near[0] * width, *fx = rows + ray->far[0] * width;
+	const q_float *ny = rows + ray->near[1] * width, *fy = rows + ray->far[1] * width;
+	const q_float *nz = rows + ray->near[2] * width, *fz = rows + ray->far[2] * width;
+
+#if defined(QM_SIMD)
+	if (width >= 4)
+	{
+		q_simd ox = simdsplat(ray->origin[0]), oy = simdsplat(ray->origin[1]), oz = simdsplat(ray->origin[2]);
+		q_simd ix = simdsplat(ray->inverse[0]), iy = simdsplat(ray->inverse[1]), iz = simdsplat(ray->inverse[2]);
+		q_simd miss = simdsplat(INFINITY);
+		for (q_uint l = 0; l < width; l += 4)
+		{
+			q_simd near = qbMax(simdmul(simdsub(qbLoad(nx + l), ox), ix), simdsplat(0.0f));
+			near = qbMax(simdmul(simdsub(qbLoad(ny + l), oy), iy), near);
+			near = qbMax(simdmul(simdsub(qbLoad(nz + l), oz), iz), near);
+			q_simd far = qbMin(simdmul(simdsub(qbLoad(fx + l), ox), ix), simdsplat(limit));
+			far = qbMin(simdmul(simdsub(qbLoad(fy + l), oy), iy), far);
+			far = qbMin(simdmul(simdsub(qbLoad(fz + l), oz), iz), far);
+		#if defined(Q_MATH_SSE)
+			_mm_storeu_ps(entry + l, qbSelectLessEqual(near, far, miss));
+		#else
+			vst1q_f32(entry + l, qbSelectLessEqual(near, far, miss));
+		#endif /* defined(Q_MATH_SSE) */
+		}
+		return;
+	}
+#endif /* QM_SIMD */
+
+	for (q_uint l = 0; l < width; l++)
+	{
+		q_float near = 0.0f, far = limit, t;
+		t = (nx[l] - ray->origin[0]) * ray->inverse[0];
+		near = t > near ? t : near;
+		t = (ny[l] - ray->origin[1]) * ray->inverse[1];
+		near = t > near ? t : near;
+		t = (nz[l] - ray->origin[2]) * ray->inverse[2];
+		near = t > near ? t : near;
+		t = (fx[l] - ray->origin[0]) * ray->inverse[0];
+		far = t < far ? t : far;
+		t = (fy[l] - ray->origin[1]) * ray->inverse[1];
+		far = t < far ? t : far;
+		t = (fz[l] - ray->origin[2]) * ray->inverse[2];
+		far = t < far ? t : far;
+		entry[l] = near <= far ? near : INFINITY;
+	}
+}
+
+// Squared distance from the point to each child, infinity for empty lanes
+QB_INLINE q_void qbPointLanes(q_floatp distance, const q_float *rows, q_uint width, q_vector3 point)
+{
+#if defined(QM_SIMD)
+	if (width >= 4)
+	{
+		q_simd p[3] = { simdsplat(point.x), simdsplat(point.y), simdsplat(point.z) };
+		for (q_uint l = 0; l < width; l += 4)
+		{
+			q_simd sum = simdsplat(0.0f);
+			for (q_uint k = 0; k < 3; k++)
+			{
+				q_simd below = simdsub(qbLoad(rows + k * width + l), p[k]);
+				q_simd above = simdsub(p[k], qbLoad(rows + (k + 3) * width + l));
+				q_simd d = qbMax(qbMax(below, above), simdsplat(0.0f));
+				sum = simdadd(sum, simdmul(d, d));
+			}
+		#if defined(Q_MATH_SSE)
+			_mm_storeu_ps(distance + l, sum);
+		#else
+			vst1q_f32(distance + l, sum);
+		#endif /* defined(Q_MATH_SSE) */
+		}
+		return;
+	}
+#endif /* QM_SIMD */
+
+	q_float p[3] = { point.x, point.y, point.z };
+	for (q_uint l = 0; l < width; l++)
+	{
+		q_float sum = 0.0f;
+		for (q_uint k = 0; k < 3; k++)
+		{
+			q_float below = rows[k * width + l] - p[k];
+			q_float above = p[k] - rows[(k + 3) * width + l];
+			q_float d = below > above ? below : above;
+			d = d > 0.0f ? d : 0.0f;
+			sum += d * d;
+		}
+		distance[l] = sum;
+	}
+}
+
+// Bit mask of the children overlapping the box
+QB_INLINE q_uint qbBoxLanes(const q_float *rows, q_uint width, q_aabb box)
+{
+	q_uint mask = 0;
+
+#if defined(QM_SIMD)
+	if (width >= 4)
+	{
+		q_simd low[6], high[6];
+		q_simd bmin[3] = { simdsplat(box.min.x), simdsplat(box.min.y), simdsplat(box.min.z) };
+		q_simd bmax[3] = { simdsplat(box.max.x), simdsplat(box.max.y), simdsplat(box.max.z) };
+		for (q_uint l = 0; l < width; l += 4)
+		{
+			for (q_uint k = 0; k < 3; k++)
+			{
+				low[k] = qbLoad(rows + k * width + l);
+				high[k] = bmax[k];
+				low[k + 3] = bmin[k];
+				high[k + 3] = qbLoad(rows + (k + 3) * width + l);
+			}
+			mask |= qbMaskLessEqual(low, high, 6) << l;
+		}
+		return mask;
+	}
+#endif /* QM_SIMD */
+
+	for (q_uint l = 0; l < width; l++)
+	{
+		q_bool overlap = Q_BOOL(
+			rows[l] <= box.max.x && rows[3 * width + l] >= box.min.x &&
+			rows[width + l] <= box.max.y && rows[4 * width + l] >= box.min.y &&
+			rows[2 * width + l] <= box.max.z && rows[5 * width + l] >= box.min.z
+		);
+		mask |= (q_uint)overlap << l;
+	}
+	return mask;
+}
+
+// Push the children with a finite distance, farthest first so the nearest is taken next
+QB_INLINE q_uint qbPushNearest(q_bvh_entry *stack, q_uint top, const q_float *distance, const q_uint *child, const q_uchar *count, q_uint width)
+{
+	q_uint order[8];
+	q_uint n = 0;
+	for (q_uint l = 0; l < width; l++)
+	{
+		if (distance[l] < INFINITY)
+		{
+			q_uint i = n++;
+			for (; i > 0 && distance[order[i - 1]] < distance[l]; i--)
+			{
+				order[i] = order[i - 1];
+			}
+			order[i] = l;
+		}
+	}
+
+	for (q_uint i = 0; i < n; i++)
+	{
+		q_uint l = order[i];
+		stack[top++] = (q_bvh_entry){ child[l], count[l], distance[l] };
+	}
+	return top;
+}
+
+//// Primitive tests ////
+
+// Ray and triangle intersection from either side, setting the distance in units of the direction
+static q_bool qbRayTriangle(q_ray ray, const q_vector3 *triangle, q_floatp distance)
+{
+	q_vector3 e1 = qmVector3Subtract(triangle[1], triangle[0]);
+	q_vector3 e2 = qmVector3Subtract(triangle[2], triangle[0]);
+	q_vector3 p = qmVector3CrossProduct(ray.direction, e2);
+	q_float det = qmVector3DotProduct(e1, p);
+	if (det == 0.0f)
+	{
+		return q_false;
+	}
+
+	q_float inv = 1.0f / det;
+	q_vector3 s = qmVector3Subtract(ray.origin, triangle[0]);
+	q_float u = qmVector3DotProduct(s, p) * inv;
+	if (u < 0.0f || u > 1.0f)
+	{
+		return q_false;
+	}
+
+	q_vector3 q = qmVector3CrossProduct(s, e1);
+	q_float v = qmVector3DotProduct(ray.direction, q) * inv;
+	if (v < 0.0f || u + v > 1.0f)
+	{
+		return q_false;
+	}
+
+	q_float t = qmVector3DotProduct(e2, q) * inv;
+	if (t < 0.0f)
+	{
+		return q_false;
+	}
+	*distance = t;
+	return q_true;
+}
+
+// Closest point of a segment, which is a when the segment has no length
+static q_vector3 qbClosestSegment(q_vector3 point, q_vector3 a, q_vector3 b)
+{
+	q_vector3 ab = qmVector3Subtract(b, a);
+	q_float length = qmVector3DotProduct(ab, ab);
+	if (length <= 0.0f)
+	{
+		return a;
+	}
+	q_float t = qmVector3DotProduct(qmVector3Subtract(point, a), ab) / length;
+	t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+	return qmVector3Add(a, qmVector3Scale(ab, t));
+}
+
+// Closest point of a triangle too thin for the regions below, which is on one of its edges
+static q_vector3 qbClosestEdges(q_vector3 point, const q_vector3 *triangle)
+{
+	q_vector3 result = qbClosestSegment(point, triangle[0], triangle[1]);
+	q_float best = qmVector3DotProduct(qmVector3Subtract(point, result), qmVector3Subtract(point, result));
+	for (q_uint i = 1; i < 3; i++)
+	{
+		q_vector3 closest = qbClosestSegment(point, triangle[i], triangle[(i + 1) % 3]);
+		q_float distance = qmVector3DotProduct(qmVector3Subtract(point, closest), qmVector3Subtract(point, closest));
+		if (distance < best)
+		{
+			best = distance;
+			result = closest;
+		}
+	}
+	return result;
+}
+
+// Closest point of a triangle, found from the Voronoi region of the point
+static q_vector3 qbClosestTriangle(q_vector3 point, const q_vector3 *triangle)
+{
+	q_vector3 a = triangle[0], b = triangle[1], c = triangle[2];
+	q_vector3 ab = qmVector3Subtract(b, a), ac = qmVector3Subtract(c, a), ap = qmVector3Subtract(point, a);
+
+	// Triangles with a repeated vertex would divide by zero below, and nearly collinear ones lose
+	// their regions to rounding
+	q_vector3 normal = qmVector3CrossProduct(ab, ac);
+	if (qmVector3DotProduct(normal, normal) <= Q_EPSILON * qmVector3DotProduct(ab, ab) * qmVector3DotProduct(ac, ac))
+	{
+		return qbClosestEdges(point, triangle);
+	}
+
+	q_float d1 = qmVector3DotProduct(ab, ap), d2 = qmVector3DotProduct(ac, ap);
+	if (d1 <= 0.0f && d2 <= 0.0f)
+	{
+		return a;
+	}
+
+	q_vector3 bp = qmVector3Subtract(point, b);
+	q_float d3 = qmVector3DotProduct(ab, bp), d4 = qmVector3DotProduct(ac, bp);
+	if (d3 >= 0.0f && d4 <= d3)
+	{
+		return b;
+	}
+
+	q_float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+	{
+		return qmVector3Add(a, qmVector3Scale(ab, d1 / (d1 - d3)));
+	}
+
+	q_vector3 cp = qmVector3Subtract(point, c);
+	q_float d5 = qmVector3DotProduct(ab, cp), d6 = qmVector3DotProduct(ac, cp);
+	if (d6 >= 0.0f && d5 <= d6)
+	{
+		return c;
+	}
+
+	q_float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+	{
+		return qmVector3Add(a, qmVector3Scale(ac, d2 / (d2 - d6)));
+	}
+
+	q_float va = d3 * d6 - d5 * d4;
+	if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+	{
+		return qmVector3Add(b, qmVector3Scale(qmVector3Subtract(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6))));
+	}
+
+	// Inside the face
+	q_float denom = 1.0f / (va + vb + vc);
+	return qmVector3Add(a, qmVector3Add(qmVector3Scale(ab, vb * denom), qmVector3Scale(ac, vc * denom)));
+}
+
+// Get the box around a triangle
+static q_aabb qbTriangleBounds(const q_vector3 *vertices, const q_uint *indices)
+{
+	q_aabb result = { vertices[indices[0]], vertices[indices[0]] };
+	result = qbMerge(result, (q_aabb){ vertices[indices[1]], vertices[indices[1]] });
+	return qbMerge(result, (q_aabb){ vertices[indices[2]], vertices[indices[2]] });
+}
+
+//// Building ////
+
+// Add a build node, returning its index or Q_BVH_NONE without memory
+static q_uint qbPushNode(q_bvh_build_nodes *nodes)
+{
+	if (nodes->count == nodes->capacity)
+	{
+		q_uint capacity = nodes->capacity ? nodes->capacity * 2 : 64;
+		q_bvh_build_node *grown = quRealloc(nodes->node, (q_ulong)capacity * sizeof(q_bvh_build_node));
+		if (grown == q_null)
+		{
+			return Q_BVH_NONE;
+		}
+		nodes->node = grown;
+		nodes->capacity = capacity;
+	}
+	return nodes->count++;
+}
+
+// Get the bin of a centroid, which the sweep and the partition must agree on
+static inline q_uint qbBin(q_float centroid, q_float low, q_float scale, q_uint bins)
+{
+	q_uint bin = (q_uint)((centroid - low) * scale);
+	return bin < bins ? bin : bins - 1;
+}
+
+// Compare references by centroid along one axis, breaking ties by index so builds repeat
+#define QB_COMPARE(name, axis) \
+	static int name(const q_void *left, const q_void *right) \
+	{ \
+		const q_bvh_ref *l = left, *r = right; \
+		if (l->centroid[axis] != r->centroid[axis]) \
+		{ \
+			return l->centroid[axis] < r->centroid[axis] ? -1 : 1; \
+		} \
+		return l->index < r->index ? -1 : l->index > r->index; \
+	}
+QB_COMPARE(qbCompareX, 0)
+QB_COMPARE(qbCompareY, 1)
+QB_COMPARE(qbCompareZ, 2)
+#undef QB_COMPARE
+
+// Sort references along an axis
+static q_void qbSortRefs(q_bvh_ref *refs, q_uint count, q_uint axis)
+{
+	qsort(refs, count, sizeof(q_bvh_ref), axis == 0 ? qbCompareX : axis == 1 ? qbCompareY : qbCompareZ);
+}
+
+// Split refs[first, first + count) in place, returning how many primitives go to the left
+// child, or zero to keep the range as a leaf, and setting the box around the range. Areas
+// hold count entries when building by sorted centroids.
+static q_uint qbSplit(const q_bvh_builder *builder, q_floatp areas, q_uint first, q_uint count, q_uint depth, q_aabb *bounds)
+{
+	q_bvh_ref *refs = builder->refs + first;
+	q_float low[3] = { INFINITY, INFINITY, INFINITY };
+	q_float high[3] = { -INFINITY, -INFINITY, -INFINITY };
+	*bounds = qmAabbEmpty();
+	for (q_uint i = 0; i < count; i++)
+	{
+		*bounds = qbMerge(*bounds, refs[i].box);
+		for (q_uint k = 0; k < 3; k++)
+		{
+			q_float c = refs[i].centroid[k];
+			low[k] = c < low[k] ? c : low[k];
+			high[k] = c > high[k] ? c : high[k];
+		}
+	}
+
+	if (depth >= QB_SAH_DEPTH)
+	{
+		return count > Q_BVH_LEAF_SIZE ? count / 2 : 0;
+	}
+
+	// Costs leave out the area of bounds, which every candidate shares
+	q_float bestCost = INFINITY;
+	q_uint bestAxis = 3, bestSplit = 0;
+	// Small ranges take a bin per primitive, as most of the bins would stay empty
+	q_uint bins = count < Q_BVH_BINS ? count : Q_BVH_BINS;
+	q_float scale[3];
+	for (q_uint k = 0; k < 3; k++)
+	{
+		scale[k] = high[k] > low[k] ? (q_float)bins / (high[k] - low[k]) : 0.0f;
+	}
+
+	if (builder->build == Q_BVH_BUILD_BINNED)
+	{
+		q_aabb bin[3][Q_BVH_BINS];
+		q_uint binCount[3][Q_BVH_BINS];
+		for (q_uint k = 0; k < 3; k++)
+		{
+			for (q_uint j = 0; j < bins; j++)
+			{
+				bin[k][j] = qmAabbEmpty();
+				binCount[k][j] = 0;
+			}
+		}
+
+		for (q_uint i = 0; i < count; i++)
+		{
+			for (q_uint k = 0; k < 3; k++)
+			{
+				q_uint j = qbBin(refs[i].centroid[k], low[k], scale[k], bins);
+				bin[k][j] = qbMerge(bin[k][j], refs[i].box);
+				binCount[k][j]++;
+			}
+		}
+
+		// Sweep the right sides from the last bin, then the left sides from the first
+		for (q_uint k = 0; k < 3; k++)
+		{
+			if (scale[k] == 0.0f)
+			{
+				continue;
+			}
+
+			q_float rightCost[Q_BVH_BINS];
+			q_aabb side = qmAabbEmpty();
+			q_uint n = 0;
+			for (q_uint j = bins - 1; j > 0; j--)
+			{
+				side = qbMerge(side, bin[k][j]);
+				n += binCount[k][j];
+				rightCost[j] = n ? qmAabbSurfaceArea(side) * (q_float)n : 0.0f;
+			}
+
+			side = qmAabbEmpty();
+			n = 0;
+			for (q_uint j = 0; j + 1 < bins; j++)
+			{
+				side = qbMerge(side, bin[k][j]);
+				n += binCount[k][j];
+				if (n == 0 || n == count)
+				{
+					continue;
+				}
+
+				q_float cost = qmAabbSurfaceArea(side) * (q_float)n + rightCost[j + 1];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = k;
+					bestSplit = j;
+				}
+			}
+		}
+	}
+	else
+	{
+		// Areas of the boxes right of each split, then the left boxes grown while sweeping
+		q_uint sorted = 3;
+		for (q_uint k = 0; k < 3; k++)
+		{
+			if (scale[k] == 0.0f)
+			{
+				continue;
+			}
+
+			qbSortRefs(refs, count, k);
+			sorted = k;
+			q_aabb side = qmAabbEmpty();
+			for (q_uint i = count - 1; i > 0; i--)
+			{
+				side = qbMerge(side, refs[i].box);
+				areas[i] = qmAabbSurfaceArea(side);
+			}
+
+			side = qmAabbEmpty();
+			for (q_uint i = 1; i < count; i++)
+			{
+				side = qbMerge(side, refs[i - 1].box);
+				q_float cost = qmAabbSurfaceArea(side) * (q_float)i + areas[i] * (q_float)(count - i);
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = k;
+					bestSplit = i;
+				}
+			}
+		}
+
+		if (bestAxis < 3 && sorted != bestAxis)
+		{
+			qbSortRefs(refs, count, bestAxis);
+		}
+	}
+
+	// Leaves small enough that testing every primitive is cheaper than a split, or halves where
+	// every centroid coincides
+	if (count <= Q_BVH_LEAF_SIZE && qmAabbSurfaceArea(*bounds) * ((q_float)count - QB_NODE_COST) <= bestCost)
+	{
+		return 0;
+	}
+	if (bestAxis == 3)
+	{
+		return count / 2;
+	}
+	if (builder->build != Q_BVH_BUILD_BINNED)
+	{
+		return bestSplit;
+	}
+
+	q_uint left = 0, right = count;
+	while (left < right)
+	{
+		if (qbBin(refs[left].centroid[bestAxis], low[bestAxis], scale[bestAxis], bins) <= bestSplit)
+		{
+			left++;
+		}
+		else
+		{
+			q_bvh_ref swap = refs[left];
+			refs[left] = refs[--right];
+			refs[right] = swap;
+		}
+	}
+	return left;
+}
+
+// Build the subtree over refs[first, first + count), returning its root or Q_BVH_NONE
+static q_uint qbBuildRange(const q_bvh_builder *builder, q_bvh_build_nodes *nodes, q_floatp areas, q_uint first, q_uint count, q_uint depth)
+{
+	q_uint index = qbPushNode(nodes);
+	if (index == Q_BVH_NONE)
+	{
+		return Q_BVH_NONE;
+	}
+
+	q_aabb bounds;
+	q_uint left = qbSplit(builder, areas, first, count, depth, &bounds);
+	q_bvh_build_node node = { bounds, { Q_BVH_NONE, Q_BVH_NONE }, first, left ? 0 : count };
+	if (left != 0)
+	{
+		node.child[0] = qbBuildRange(builder, nodes, areas, first, left, depth + 1);
+		node.child[1] = qbBuildRange(builder, nodes, areas, first + left, count - left, depth + 1);
+		if (node.child[0] == Q_BVH_NONE || node.child[1] == Q_BVH_NONE)
+		{
+			return Q_BVH_NONE;
+		}
+	}
+
+	nodes->node[index] = node;
+	return index;
+}
+
+// Split ranges larger than a task on the calling thread, returning a reference to the root
+// node or task, or Q_BVH_NONE without memory
+static q_uint qbBuildTop(q_bvh_builder *builder, q_floatp areas, q_uint first, q_uint count, q_uint depth)
+{
+	if (count <= builder->taskSize)
+	{
+		q_bvh_task *grown = quRealloc(builder->tasks, (q_ulong)(builder->taskCount + 1) * sizeof(q_bvh_task));
+		if (grown == q_null)
+		{
+			return Q_BVH_NONE;
+		}
+
+		builder->tasks = grown;
+		builder->tasks[builder->taskCount] = (q_bvh_task){ { q_null, 0, 0 }, first, count, depth };
+		return QB_TASK | builder->taskCount++;
+	}
+
+	q_uint index = qbPushNode(&builder->top);
+	if (index == Q_BVH_NONE)
+	{
+		return Q_BVH_NONE;
+	}
+
+	q_aabb bounds;
+	q_uint left = qbSplit(builder, areas, first, count, depth, &bounds);
+	q_bvh_build_node node = { bounds, { Q_BVH_NONE, Q_BVH_NONE }, first, left ? 0 : count };
+	if (left != 0)
+	{
+		node.child[0] = qbBuildTop(builder, areas, first, left, depth + 1);
+		node.child[1] = qbBuildTop(builder, areas, first + left, count - left, depth + 1);
+		if (node.child[0] == Q_BVH_NONE || node.child[1] == Q_BVH_NONE)
+		{
+			return Q_BVH_NONE;
+		}
+	}
+
+	builder->top.node[index] = node;
+	return index;
+}
+
+// Build scheduled tasks until none are left
+static q_void qbBuildTasks(q_bvh_builder *builder)
+{
+	q_floatp areas = q_null;
+	q_uint scratch = 0;
+	for (;;)
+	{
+		q_uint next = atomic_fetch_add_explicit(&builder->next, 1, memory_order_relaxed);
+		if (next >= builder->taskCount)
+		{
+			break;
+		}
+
+		// Tasks come largest first, so the first one sizes the sort scratch
+		q_bvh_task *task = builder->tasks + builder->schedule[next];
+		if (builder->build != Q_BVH_BUILD_BINNED && scratch < task->count)
+		{
+			quFree(areas);
+			scratch = task->count;
+			areas = quAlloc((q_ulong)scratch * sizeof(q_float));
+			if (areas == q_null)
+			{
+				atomic_store_explicit(&builder->failed, 1, memory_order_relaxed);
+				scratch = 0;
+				continue;
+			}
+		}
+
+		if (qbBuildRange(builder, &task->nodes, areas, task->first, task->count, task->depth) == Q_BVH_NONE)
+		{
+			atomic_store_explicit(&builder->failed, 1, memory_order_relaxed);
+		}
+	}
+	quFree(areas);
+}
+
+// Build thread entry
+#if defined(_WIN32)
+static DWORD WINAPI qbBuildWorker(LPVOID param)
+#else
+static q_voidp qbBuildWorker(q_voidp param)
+#endif /* defined(_WIN32) */
+{
+	qbBuildTasks(param);
+	return 0;
+}
+
+// Build every task on the calling thread and up to threads - 1 others, where threads that
+// cannot start leave their share to the rest
+static q_void qbRunTasks(q_bvh_builder *builder, q_uint threads)
+{
+	q_uint workers = threads < builder->taskCount ? threads - 1 : builder->taskCount - 1;
+#if defined(_WIN32)
+	HANDLE *thread = workers ? quAlloc((q_ulong)workers * sizeof(HANDLE)) : q_null;
+#else
+	pthread_t *thread = workers ? quAlloc((q_ulong)workers * sizeof(pthread_t)) : q_null;
+#endif /* defined(_WIN32) */
+
+	q_uint started = 0;
+	for (; thread != q_null && started < workers; started++)
+	{
+	#if defined(_WIN32)
+		thread[started] = CreateThread(q_null, 0, qbBuildWorker, builder, 0, q_null);
+		if (thread[started] == q_null)
+		{
+			break;
+		}
+	#else
+		if (pthread_create(thread + started, q_null, qbBuildWorker, builder) != 0)
+		{
+			break;
+		}
+	#endif /* defined(_WIN32) */
+	}
+
+	qbBuildTasks(builder);
+	for (q_uint i = 0; i < started; i++)
+	{
+	#if defined(_WIN32)
+		WaitForSingleObject(thread[i], INFINITE);
+		CloseHandle(thread[i]);
+	#else
+		pthread_join(thread[i], q_null);
+	#endif /* defined(_WIN32) */
+	}
+	quFree(thread);
+}
+
+// Get the build node a reference names, reading task references as the root of the task
+static q_bvh_item qbResolve(const q_bvh_builder *builder, const q_bvh_build_nodes *nodes, q_uint reference)
+{
+	if (reference & QB_TASK)
+	{
+		nodes = &builder->tasks[reference & ~QB_TASK].nodes;
+		reference = 0;
+	}
+	return (q_bvh_item){ nodes->node + reference, nodes };
+}
+
+// Write the children of a build node into a node, opening the largest inner children in
+// their place until it is full, then do the same for every inner child
+static q_void qbCollapse(q_bvh *bvh, const q_bvh_builder *builder, q_bvh_item item, q_uint node)
+{
+	q_uint width = bvh->width;
+	q_bvh_item lane[8];
+	q_uint count = 0;
+	if (item.node->count != 0)
+	{
+		lane[count++] = item;
+	}
+	else
+	{
+		lane[count++] = qbResolve(builder, item.nodes, item.node->child[0]);
+		lane[count++] = qbResolve(builder, item.nodes, item.node->child[1]);
+	}
+
+	while (count < width)
+	{
+		q_uint open = width;
+		q_float area = -1.0f;
+		for (q_uint l = 0; l < count; l++)
+		{
+			q_float a = qmAabbSurfaceArea(lane[l].node->bounds);
+			if (lane[l].node->count == 0 && a > area)
+			{
+				open = l;
+				area = a;
+			}
+		}
+		if (open == width)
+		{
+			break;
+		}
+
+		q_bvh_item inner = lane[open];
+		lane[open] = qbResolve(builder, inner.nodes, inner.node->child[0]);
+		lane[count++] = qbResolve(builder, inner.nodes, inner.node->child[1]);
+	}
+
+	// Inner children take the next free nodes, after their parent
+	q_floatp rows = qbNode(bvh->nodes, width, node);
+	q_uint *child = qbChildren(rows, width);
+	q_uchar *primitives = qbCounts(rows, width);
+	q_aabb empty = qmAabbEmpty();
+	for (q_uint l = 0; l < width; l++)
+	{
+		if (l >= count)
+		{
+			qbSetLane(rows, width, l, empty);
+			child[l] = Q_BVH_NONE;
+			primitives[l] = 0;
+			continue;
+		}
+
+		qbSetLane(rows, width, l, lane[l].node->bounds);
+		primitives[l] = (q_uchar)lane[l].node->count;
+		child[l] = lane[l].node->count ? lane[l].node->first : bvh->nodeCount++;
+	}
+
+	for (q_uint l = 0; l < count; l++)
+	{
+		if (lane[l].node->count == 0)
+		{
+			qbCollapse(bvh, builder, lane[l], child[l]);
+		}
+	}
+}
+
+// Count the inner build nodes, which bounds the nodes they collapse into
+static q_uint qbInnerCount(const q_bvh_build_nodes *nodes)
+{
+	q_uint result = 0;
+	for (q_uint i = 0; i < nodes->count; i++)
+	{
+		result += nodes->node[i].count == 0;
+	}
+	return result;
+}
+
+// Build nodes over boxes, leaving primitives and their boxes in leaf order
+static q_bool qbBuildBoxes(q_bvh *bvh, const q_aabb *boxes, q_uint count, q_bvh_build build, q_uint threads)
+{
+	bvh->count = 0;
+	bvh->nodeCount = 0;
+	bvh->bounds = qmAabbEmpty();
+	if (count == 0)
+	{
+		return q_true;
+	}
+
+	q_uint *primitive = quRealloc(bvh->primitive, (q_ulong)count * sizeof(q_uint));
+	bvh->primitive = primitive ? primitive : bvh->primitive;
+	q_bvh_builder builder;
+	memset(&builder, 0, sizeof(q_bvh_builder));
+	builder.build = build;
+	builder.refs = quAlloc((q_ulong)count * sizeof(q_bvh_ref));
+	if (primitive == q_null || builder.refs == q_null)
+	{
+		quFree(builder.refs);
+		return q_false;
+	}
+
+	for (q_uint i = 0; i < count; i++)
+	{
+		q_bvh_ref *ref = builder.refs + i;
+		ref->box = boxes[i];
+		ref->centroid[0] = 0.5f * (boxes[i].min.x + boxes[i].max.x);
+		ref->centroid[1] = 0.5f * (boxes[i].min.y + boxes[i].max.y);
+		ref->centroid[2] = 0.5f * (boxes[i].min.z + boxes[i].max.z);
+		ref->index = i;
+	}
+
+	// One task covers everything unless the top of the tree is split first
+	threads = threads ? threads : 1;
+	builder.taskSize = count;
+	if (threads > 1)
+	{
+		q_uint size = count / (threads * QB_TASKS_PER_THREAD);
+		builder.taskSize = size > QB_TASK_MIN ? size : QB_TASK_MIN;
+	}
+
+	q_floatp areas = q_null;
+	if (build != Q_BVH_BUILD_BINNED && count > builder.taskSize)
+	{
+		areas = quAlloc((q_ulong)count * sizeof(q_float));
+	}
+	q_bool ok = Q_BOOL(areas != q_null || build == Q_BVH_BUILD_BINNED || count <= builder.taskSize);
+	q_uint root = ok ? qbBuildTop(&builder, areas, 0, count, 0) : Q_BVH_NONE;
+	quFree(areas);
+
+	// Tasks run largest first, so no thread is left with a big one at the end
+	if (root != Q_BVH_NONE)
+	{
+		builder.schedule = quAlloc((q_ulong)builder.taskCount * sizeof(q_uint));
+		if (builder.schedule != q_null)
+		{
+			for (q_uint i = 0; i < builder.taskCount; i++)
+			{
+				q_uint j = i;
+				for (; j > 0 && builder.tasks[builder.schedule[j - 1]].count < builder.tasks[i].count; j--)
+				{
+					builder.schedule[j] = builder.schedule[j - 1];
+				}
+				builder.schedule[j] = i;
+			}
+			qbRunTasks(&builder, threads);
+		}
+	}
+	ok = Q_BOOL(root != Q_BVH_NONE && builder.schedule != q_null && atomic_load_explicit(&builder.failed, memory_order_relaxed) == 0);
+
+	if (ok)
+	{
+		q_uint inner = qbInnerCount(&builder.top);
+		for (q_uint i = 0; i < builder.taskCount; i++)
+		{
+			inner += qbInnerCount(&builder.tasks[i].nodes);
+		}
+
+		q_uchar *nodes = quReallocAligned(bvh->nodes, (q_ulong)(inner ? inner : 1) * QB_NODE_SIZE(bvh->width), Q_BVH_ALIGNMENT);
+		q_aabb *leaves = quReallocAligned(bvh->boxes, (q_ulong)count * sizeof(q_aabb), Q_BVH_ALIGNMENT);
+		bvh->nodes = nodes ? nodes : bvh->nodes;
+		bvh->boxes = leaves ? leaves : bvh->boxes;
+		ok = Q_BOOL(nodes != q_null && leaves != q_null);
+	}
+
+	if (ok)
+	{
+		bvh->nodeCount = 1;
+		qbCollapse(bvh, &builder, qbResolve(&builder, &builder.top, root), 0);
+		for (q_uint i = 0; i < count; i++)
+		{
+			bvh->boxes[i] = builder.refs[i].box;
+			bvh->primitive[i] = builder.refs[i].index;
+		}
+		bvh->count = count;
+		bvh->bounds = qbNodeBounds(bvh, 0);
+	}
+
+	for (q_uint i = 0; i < builder.taskCount; i++)
+	{
+		quFree(builder.tasks[i].nodes.node);
+	}
+	quFree(builder.tasks);
+	quFree(builder.schedule);
+	quFree(builder.top.node);
+	quFree(builder.refs);
+	return ok;
+}
+
+//// Hierarchy management ////
+
+// Create empty hierarchy
+Q_API q_bvh *qbCreate(q_uint width)
+{
+	width = width ? width : Q_BVH_WIDTH;
+	if (width != 2 && width != 4 && width != 8)
+	{
+		return q_null;
+	}
+
+	q_bvh *bvh = Q_MALLOC(sizeof(q_bvh));
+	if (bvh == q_null)
+	{
+		return q_null;
+	}
+
+	memset(bvh, 0, sizeof(q_bvh));
+	bvh->width = width;
+	bvh->bounds = qmAabbEmpty();
+	return bvh;
+}
+
+// Destroy hierarchy
+Q_API q_void qbDestroy(q_bvh *bvh)
+{
+	if (bvh == q_null)
+	{
+		return;
+	}
+
+	quFreeAligned(bvh->nodes);
+	quFreeAligned(bvh->boxes);
+	quFreeAligned(bvh->triangles);
+	quFree(bvh->primitive);
+	quFree(bvh->indices);
+	Q_FREE(bvh);
+}
+
+// Get primitive count
+Q_API q_uint qbCount(const q_bvh *bvh)
+{
+	return bvh->count;
+}
+
+// Get the box around every primitive, empty without any
+Q_API q_aabb qbBounds(const q_bvh *bvh)
+{
+	return bvh->bounds;
+}
+
+//// Building and refitting ////
+
+// Build over boxes
+Q_API q_bool qbBuild(q_bvh *bvh, const q_aabb *bounds, q_uint count, q_bvh_build build, q_uint threads)
+{
+	quFreeAligned(bvh->triangles);
+	quFree(bvh->indices);
+	bvh->triangles = q_null;
+	bvh->indices = q_null;
+	return qbBuildBoxes(bvh, bounds, count, build, threads);
+}
+
+// Build over triangles
+Q_API q_bool qbBuildTriangles(q_bvh *bvh, const q_vector3 *vertices, const q_uint *indices, q_uint count, q_bvh_build build, q_uint threads)
+{
+	if (count == 0)
+	{
+		return qbBuild(bvh, q_null, 0, build, threads);
+	}
+
+	q_vector3 *triangles = quReallocAligned(bvh->triangles, (q_ulong)count * 3 * sizeof(q_vector3), Q_BVH_ALIGNMENT);
+	bvh->triangles = triangles ? triangles : bvh->triangles;
+	q_uint *copy = quRealloc(bvh->indices, (q_ulong)count * 3 * sizeof(q_uint));
+	bvh->indices = copy ? copy : bvh->indices;
+	q_aabb *boxes = quAlloc((q_ulong)count * sizeof(q_aabb));
+	q_bool ok = Q_BOOL(triangles != q_null && copy != q_null && boxes != q_null);
+
+	if (ok)
+	{
+		for (q_uint i = 0; i < count; i++)
+		{
+			boxes[i] = qbTriangleBounds(vertices, indices + 3 * (q_ulong)i);
+		}
+		ok = qbBuildBoxes(bvh, boxes, count, build, threads);
+	}
+	quFree(boxes);
+	if (!ok)
+	{
+		qbBuild(bvh, q_null, 0, build, threads);
+		return q_false;
+	}
+
+	for (q_uint i = 0; i < count; i++)
+	{
+		const q_uint *source = indices + 3 * (q_ulong)bvh->primitive[i];
+		for (q_uint k = 0; k < 3; k++)
+		{
+			copy[3 * (q_ulong)i + k] = source[k];
+			triangles[3 * (q_ulong)i + k] = vertices[source[k]];
+		}
+	}
+	return q_true;
+}
+
+// Grow every node around its children, children first since they follow their parents
+static q_void qbRefitNodes(q_bvh *bvh)
+{
+	q_uint width = bvh->width;
+	for (q_uint node = bvh->nodeCount; node-- > 0;)
+	{
+		q_floatp rows = qbNode(bvh->nodes, width, node);
+		q_uint *child = qbChildren(rows, width);
+		q_uchar *count = qbCounts(rows, width);
+		for (q_uint l = 0; l < width; l++)
+		{
+			if (child[l] != Q_BVH_NONE)
+			{
+				qbSetLane(rows, width, l, count[l] ? qbLeafBounds(bvh, child[l], count[l]) : qbNodeBounds(bvh, child[l]));
+			}
+		}
+	}
+	bvh->bounds = bvh->nodeCount ? qbNodeBounds(bvh, 0) : qmAabbEmpty();
+}
+
+// Refit around moved boxes, given in build input order
+Q_API q_void qbRefit(q_bvh *bvh, const q_aabb *bounds)
+{
+	for (q_uint i = 0; i < bvh->count; i++)
+	{
+		bvh->boxes[i] = bounds[bvh->primitive[i]];
+	}
+	qbRefitNodes(bvh);
+}
+
+// Refit around moved vertices
+Q_API q_void qbRefitTriangles(q_bvh *bvh, const q_vector3 *vertices)
+{
+	for (q_uint i = 0; i < bvh->count; i++)
+	{
+		const q_uint *source = bvh->indices + 3 * (q_ulong)i;
+		q_vector3 *triangle = bvh->triangles + 3 * (q_ulong)i;
+		triangle[0] = vertices[source[0]];
+		triangle[1] = vertices[source[1]];
+		triangle[2] = vertices[source[2]];
+		bvh->boxes[i] = qbTriangleBounds(vertices, source);
+	}
+	qbRefitNodes(bvh);
+}
+
+//// Queries ////
+
+// Ray cast over nodes of one width
+QB_INLINE q_bool qbRayCastWidth(const q_bvh *bvh, q_ray ray, q_float maxDistance, q_bvh_hit *hit, q_uint width)
+{
+	q_bvh_ray prepared;
+	q_float origin[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+	q_float direction[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+	for (q_uint k = 0; k < 3; k++)
+	{
+		q_bool negative = Q_BOOL(direction[k] < 0.0f);
+		prepared.origin[k] = origin[k];
+		prepared.inverse[k] = 1.0f / direction[k];
+		prepared.near[k] = negative ? k + 3 : k;
+		prepared.far[k] = negative ? k : k + 3;
+	}
+
+	q_bvh_entry stack[QB_STACK_SIZE];
+	q_uint top = 0;
+	stack[top++] = (q_bvh_entry){ 0, 0, 0.0f };
+	q_float best = maxDistance;
+	q_uint found = Q_BVH_NONE;
+	while (top > 0)
+	{
+		q_bvh_entry entry = stack[--top];
+		if (entry.distance > best)
+		{
+			continue;
+		}
+
+		if (entry.count != 0)
+		{
+			for (q_uint p = entry.child; p < entry.child + entry.count; p++)
+			{
+				q_float t;
+				q_bool hits = bvh->indices ? qbRayTriangle(ray, bvh->triangles + 3 * (q_ulong)p, &t) : qmRayIntersectsAabb(ray, bvh->boxes[p], &t);
+				if (hits && (t < best || (t == best && found == Q_BVH_NONE)))
+				{
+					best = t;
+					found = p;
+				}
+			}
+			continue;
+		}
+
+		q_floatp rows = qbNode(bvh->nodes, width, entry.child);
+		q_float distance[8];
+		qbRayLanes(distance, rows, width, &prepared, best);
+		top = qbPushNearest(stack, top, distance, qbChildren(rows, width), qbCounts(rows, width), width);
+	}
+
+	if (found == Q_BVH_NONE)
+	{
+		return q_false;
+	}
+	if (hit != q_null)
+	{
+		hit->point = qmRayAt(ray, best);
+		hit->distance = best;
+		hit->primitive = bvh->primitive[found];
+	}
+	return q_true;
+}
+
+// Box overlap over nodes of one width
+QB_INLINE q_uint qbOverlapWidth(const q_bvh *bvh, q_aabb aabb, q_uint *result, q_uint capacity, q_uint width)
+{
+	q_uint stack[QB_STACK_SIZE];
+	q_uint top = 0;
+	stack[top++] = 0;
+	q_uint total = 0;
+	while (top > 0)
+	{
+		q_floatp rows = qbNode(bvh->nodes, width, stack[--top]);
+		q_uint *child = qbChildren(rows, width);
+		q_uchar *count = qbCounts(rows, width);
+		q_uint mask = qbBoxLanes(rows, width, aabb);
+		for (q_uint l = 0; l < width; l++)
+		{
+			if (!(mask >> l & 1) || child[l] == Q_BVH_NONE)
+			{
+				continue;
+			}
+			if (count[l] == 0)
+			{
+				stack[top++] = child[l];
+				continue;
+			}
+
+			for (q_uint p = child[l]; p < child[l] + count[l]; p++)
+			{
+				if (qmAabbIntersectsAabb(bvh->boxes[p], aabb))
+				{
+					if (total < capacity)
+					{
+						result[total] = bvh->primitive[p];
+					}
+					total++;
+				}
+			}
+		}
+	}
+	return total;
+}
+
+// Nearest primitive over nodes of one width, comparing squared distances
+QB_INLINE q_bool qbNearestWidth(const q_bvh *bvh, q_vector3 point, q_float maxDistance, q_bvh_hit *hit, q_uint width)
+{
+	q_bvh_entry stack[QB_STACK_SIZE];
+	q_uint top = 0;
+	stack[top++] = (q_bvh_entry){ 0, 0, 0.0f };
+	q_float best = maxDistance * maxDistance;
+	q_uint found = Q_BVH_NONE;
+	q_vector3 closest = point;
+	while (top > 0)
+	{
+		q_bvh_entry entry = stack[--top];
+		if (entry.distance > best)
+		{
+			continue;
+		}
+
+		if (entry.count != 0)
+		{
+			for (q_uint p = entry.child; p < entry.child + entry.count; p++)
+			{
+				q_vector3 c = bvh->indices ? qbClosestTriangle(point, bvh->triangles + 3 * (q_ulong)p) : qmAabbClosestPoint(bvh->boxes[p], point);
+				q_float d = qmVector3DistanceSq(point, c);
+				if (d < best || (d == best && found == Q_BVH_NONE))
+				{
+					best = d;
+					found = p;
+					closest = c;
+				}
+			}
+			continue;
+		}
+
+		q_floatp rows = qbNode(bvh->nodes, width, entry.child);
+		q_float distance[8];
+		qbPointLanes(distance, rows, width, point);
+		for (q_uint l = 0; l < width; l++)
+		{
+			distance[l] = distance[l] <= best ? distance[l] : INFINITY;
+		}
+		top = qbPushNearest(stack, top, distance, qbChildren(rows, width), qbCounts(rows, width), width);
+	}
+
+	if (found == Q_BVH_NONE)
+	{
+		return q_false;
+	}
+	if (hit != q_null)
+	{
+		hit->point = closest;
+		hit->distance = sqrtf(best);
+		hit->primitive = bvh->primitive[found];
+	}
+	return q_true;
+}
+
+// Cast ray
+Q_API q_bool qbRayCast(const q_bvh *bvh, q_ray ray, q_float maxDistance, q_bvh_hit *hit)
+{
+	if (bvh->count == 0)
+	{
+		return q_false;
+	}
+
+	switch (bvh->width)
+	{
+	case 2:
+		return qbRayCastWidth(bvh, ray, maxDistance, hit, 2);
+	case 8:
+		return qbRayCastWidth(bvh, ray, maxDistance, hit, 8);
+	default:
+		return qbRayCastWidth(bvh, ray, maxDistance, hit, 4);
+	}
+}
+
+// Find overlapping primitives
+Q_API q_uint qbOverlapAabb(const q_bvh *bvh, q_aabb aabb, q_uint *result, q_uint capacity)
+{
+	if (bvh->count == 0)
+	{
+		return 0;
+	}
+
+	switch (bvh->width)
+	{
+	case 2:
+		return qbOverlapWidth(bvh, aabb, result, capacity, 2);
+	case 8:
+		return qbOverlapWidth(bvh, aabb, result, capacity, 8);
+	default:
+		return qbOverlapWidth(bvh, aabb, result, capacity, 4);
+	}
+}
+
+// Find nearest primitive
+Q_API q_bool qbNearest(const q_bvh *bvh, q_vector3 point, q_float maxDistance, q_bvh_hit *hit)
+{
+	if (bvh->count == 0)
+	{
+		return q_false;
+	}
+
+	switch (bvh->width)
+	{
+	case 2:
+		return qbNearestWidth(bvh, point, maxDistance, hit, 2);
+	case 8:
+		return qbNearestWidth(bvh, point, maxDistance, hit, 8);
+	default:
+		return qbNearestWidth(bvh, point, maxDistance, hit, 4);
+	}
+}
@@ -0,0 +1,107 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qbvh.h
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef QBVH_H
+#define QBVH_H
+
+#if defined(_MSC_VER) && (_MSC_VER > 1000)
+#pragma once
+#endif /* defined(_MSC_VER) && (_MSC_VER > 1000) */
+
+#include "qmath.h"
+
+//// Bounding volume hierarchy ////
+
+// Hierarchy over boxes or triangles. Every node holds the boxes of its children side by side,
+// so one node of width 2 fills a 64-byte cache line, width 4 two and width 8 four, and a
+// query tests all children of a node at once.
+typedef struct q_bvh q_bvh;
+
+// Primitive reported when a query finds nothing
+#define Q_BVH_NONE 0xFFFFFFFFu
+
+// Default children per node
+#ifndef Q_BVH_WIDTH
+	#define Q_BVH_WIDTH 4
+#endif /* Q_BVH_WIDTH */
+
+// Most primitives in a leaf
+#ifndef Q_BVH_LEAF_SIZE
+	#define Q_BVH_LEAF_SIZE 4
+#endif /* Q_BVH_LEAF_SIZE */
+
+// Candidate split planes per axis in binned builds
+#ifndef Q_BVH_BINS
+	#define Q_BVH_BINS 16
+#endif /* Q_BVH_BINS */
+
+typedef enum
+{
+	Q_BVH_BUILD_BINNED, // Surface area heuristic over binned centroids, linear per level
+	Q_BVH_BUILD_SAH // Surface area heuristic over every sorted centroid, slower and tighter
+} q_bvh_build;
+
+// Closest primitive of a query, at distance in units of the ray direction for ray casts
+typedef struct q_bvh_hit
+{
+	q_vector3 point;
+	q_float distance;
+	q_uint primitive;
+} q_bvh_hit;
+
+//// Functions ////
+
+// Prevent function name mangling
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+// Hierarchy management, where width is 2, 4 or 8 children per node, or 0 for Q_BVH_WIDTH
+Q_API q_bvh *qbCreate(q_uint width);
+Q_API q_void qbDestroy(q_bvh *bvh);
+Q_API q_uint qbCount(const q_bvh *bvh);
+Q_API q_aabb qbBounds(const q_bvh *bvh);
+
+// Builds replace the hierarchy, splitting the work across up to threads threads. Triangles
+// are three indices into vertices each, which the hierarchy copies in leaf order.
+Q_API q_bool qbBuild(q_bvh *bvh, const q_aabb *bounds, q_uint count, q_bvh_build build, q_uint threads);
+Q_API q_bool qbBuildTriangles(q_bvh *bvh, const q_vector3 *vertices, const q_uint *indices, q_uint count, q_bvh_build build, q_uint threads);
+
+// Refits move the primitives of the last build and grow or shrink every node around them,
+// keeping the tree, which stays valid but loosens as the primitives drift from where they
+// were built. Triangles keep their indices and take new vertices.
+Q_API q_void qbRefit(q_bvh *bvh, const q_aabb *bounds);
+Q_API q_void qbRefitTriangles(q_bvh *bvh, const q_vector3 *vertices);
+
+// Closest primitive along the ray within maxDistance, where boxes are hit at their entry
+// distance and triangles from either side
+Q_API q_bool qbRayCast(const q_bvh *bvh, q_ray ray, q_float maxDistance, q_bvh_hit *hit);
+
+// Primitives whose boxes overlap aabb, returning how many there are while writing at most
+// capacity of them into result
+Q_API q_uint qbOverlapAabb(const q_bvh *bvh, q_aabb aabb, q_uint *result, q_uint capacity);
+
+// Primitive closest to point within maxDistance, at zero distance from inside a box
+Q_API q_bool qbNearest(const q_bvh *bvh, q_vector3 point, q_float maxDistance, q_bvh_hit *hit);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* QBVH_H */
@@ -0,0 +1,1045 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qmath.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Keep private copies of the inline functions unless the caller asked for external ones
+#if !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE)
+	#define Q_MATH_STATIC_INLINE
+#endif /* !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE) */
+
+// Library kernels may always use the SIMD helpers the target supports
+#if !defined(Q_MATH_SIMD)
+	#define Q_MATH_SIMD
+#endif /* Q_MATH_SIMD */
+
+#include <stdatomic.h> // atomic_load_explicit, atomic_store_explicit
+#include <stdint.h> // uintptr_t
+#include <stdlib.h> // getenv
+#include <string.h> // strcmp
+#include "qmath.h"
+
+// Wider variants are compiled with target attributes and selected from CPUID at startup
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && defined(Q_MATH_SSE)
+	#include <immintrin.h>
+	#define QM_DISPATCH_X86
+	#define QM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#define QM_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#endif /* (defined(__x86_64__) || defined(__i386__))... */
+
+//// Blocking ////
+
+// Vectors transformed per block, sized so a block of input and output stays in L1
+#ifndef Q_MATH_BLOCK_SIZE
+	#define Q_MATH_BLOCK_SIZE 256
+#endif /* Q_MATH_BLOCK_SIZE */
+
+//// Vectorization hints ////
+
+// Batch loops load every component of an element before storing any, so exact aliasing
+// between result and input is safe and the compiler may ignore assumed dependencies
+#if defined(__clang__)
+	#define QM_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+	#define QM_IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+	#define QM_IVDEP __pragma(loop(ivdep))
+#else
+	#define QM_IVDEP
+#endif /* defined(__clang__)... */
+
+// Kernels are inlined into every instruction set variant, so each is vectorized for its target
+#if defined(__GNUC__) || defined(__clang__)
+	#define QM_KERNEL static inline __attribute__((always_inline))
+#else
+	#define QM_KERNEL static inline
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+//// Float batch kernels ////
+
+// Sine and cosine kernel, which always uses the branch-free polynomial so it vectorizes
+QM_KERNEL q_void batchsincos(q_floatp sine, q_floatp cosine, const q_float *angle, q_uint count)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < count; i++)
+	{
+		q_float s, c;
+		sincospolyf(angle[i], &s, &c);
+
+		sine[i] = s;
+		cosine[i] = c;
+	}
+}
+
+//// Vector3 batch kernels ////
+
+// Add function
+QM_KERNEL q_void batchadd(q_vector3_batch result, q_vector3_batch left, q_vector3_batch right)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float x = left.x[i] + right.x[i];
+		q_float y = left.y[i] + right.y[i];
+		q_float z = left.z[i] + right.z[i];
+
+		result.x[i] = x;
+		result.y[i] = y;
+		result.z[i] = z;
+	}
+}
+
+// Scale function
+QM_KERNEL q_void batchscale(q_vector3_batch result, q_vector3_batch vec, q_float scl)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float x = vec.x[i] * scl;
+		q_float y = vec.y[i] * scl;
+		q_float z = vec.z[i] * scl;
+
+		result.x[i] = x;
+		result.y[i] = y;
+		result.z[i] = z;
+	}
+}
+
+// Normalize function
+QM_KERNEL q_void batchnormalize(q_vector3_batch result, q_vector3_batch vec)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float x = vec.x[i];
+		q_float y = vec.y[i];
+		q_float z = vec.z[i];
+
+		// Zero vectors divide by one and pass through unchanged, as in qmVector3Normalize;
+		// adding the comparison instead of selecting keeps the loop free of branches
+		q_float length = sqrtf(x * x + y * y + z * z);
+		length += (q_float)(length == 0.0f);
+
+		result.x[i] = x / length;
+		result.y[i] = y / length;
+		result.z[i] = z / length;
+	}
+}
+
+// Linear interpolation function
+QM_KERNEL q_void batchlerp(q_vector3_batch result, q_float value, q_vector3_batch start, q_vector3_batch end)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float x = start.x[i] + value * (end.x[i] - start.x[i]);
+		q_float y = start.y[i] + value * (end.y[i] - start.y[i]);
+		q_float z = start.z[i] + value * (end.z[i] - start.z[i]);
+
+		result.x[i] = x;
+		result.y[i] = y;
+		result.z[i] = z;
+	}
+}
+
+// Cross product function
+QM_KERNEL q_void batchcross(q_vector3_batch result, q_vector3_batch left, q_vector3_batch right)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float lx = left.x[i], ly = left.y[i], lz = left.z[i];
+		q_float rx = right.x[i], ry = right.y[i], rz = right.z[i];
+
+		result.x[i] = ly * rz - lz * ry;
+		result.y[i] = lz * rx - lx * rz;
+		result.z[i] = lx * ry - ly * rx;
+	}
+}
+
+// Transform point function
+QM_KERNEL q_void batchtransform(q_vector3_batch result, q_vector3_batch vec, q_matrix44 mat)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float x = vec.x[i];
+		q_float y = vec.y[i];
+		q_float z = vec.z[i];
+
+		result.x[i] = mat.m0 * x + mat.m4 * y + mat.m8 * z + mat.m12;
+		result.y[i] = mat.m1 * x + mat.m5 * y + mat.m9 * z + mat.m13;
+		result.z[i] = mat.m2 * x + mat.m6 * y + mat.m10 * z + mat.m14;
+	}
+}
+
+// Rotate by quaternion function
+QM_KERNEL q_void batchrotate(q_vector3_batch result, q_vector3_batch vec, q_quaternion quat)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < result.count; i++)
+	{
+		q_float x = vec.x[i];
+		q_float y = vec.y[i];
+		q_float z = vec.z[i];
+
+		// Same as qmQuaternionRotateVector3
+		q_float tx = 2.0f * (quat.y * z - quat.z * y);
+		q_float ty = 2.0f * (quat.z * x - quat.x * z);
+		q_float tz = 2.0f * (quat.x * y - quat.y * x);
+
+		result.x[i] = x + quat.w * tx + quat.y * tz - quat.z * ty;
+		result.y[i] = y + quat.w * ty + quat.z * tx - quat.x * tz;
+		result.z[i] = z + quat.w * tz + quat.x * ty - quat.y * tx;
+	}
+}
+
+// Length function
+QM_KERNEL q_void batchlength(q_floatp result, q_vector3_batch vec)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < vec.count; i++)
+	{
+		result[i] = sqrtf(vec.x[i] * vec.x[i] + vec.y[i] * vec.y[i] + vec.z[i] * vec.z[i]);
+	}
+}
+
+// Dot product function
+QM_KERNEL q_void batchdot(q_floatp result, q_vector3_batch left, q_vector3_batch right)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < left.count; i++)
+	{
+		result[i] = left.x[i] * right.x[i] + left.y[i] * right.y[i] + left.z[i] * right.z[i];
+	}
+}
+
+//// Frustum batch kernels ////
+
+// Append first + i for each of count elements whose keep flag is one, without branches
+QM_KERNEL q_uint compactindex(q_uint *index, q_uint n, q_uint first, const q_uint *keep, q_uint count)
+{
+	for (q_uint i = 0; i < count; i++)
+	{
+		index[n] = first + i;
+		n += keep[i];
+	}
+	return n;
+}
+
+// Sphere cull kernel, which tests a block with vector compares before compacting the indices
+// of the visible spheres
+QM_KERNEL q_uint cullsphere(q_uint *visible, q_frustum frustum, q_vector3_batch center, const q_float *radius)
+{
+	q_uint keep[Q_MATH_BLOCK_SIZE];
+	q_uint n = 0;
+	for (q_uint block = 0; block < center.count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = center.count - block < Q_MATH_BLOCK_SIZE ? center.count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = block; i < end; i++)
+		{
+			q_float x = center.x[i];
+			q_float y = center.y[i];
+			q_float z = center.z[i];
+			q_float r = -radius[i];
+
+			// Same as qmFrustumIntersectsSphere, without returning early
+			q_uint out = 0;
+			for (q_uint k = 0; k < 6; k++)
+			{
+				q_plane p = frustum.plane[k];
+				out |= (q_uint)(p.x * x + p.y * y + p.z * z + p.w < r);
+			}
+			keep[i - block] = out ^ 1;
+		}
+		n = compactindex(visible, n, block, keep, end - block);
+	}
+	return n;
+}
+
+// Axis-aligned box cull kernel, compacting as the sphere kernel does
+QM_KERNEL q_uint cullaabb(q_uint *visible, q_frustum frustum, q_vector3_batch center, q_vector3_batch extent)
+{
+	// Absolute normals project the half extent onto each plane normal
+	q_vector3 axis[6];
+	for (q_uint k = 0; k < 6; k++)
+	{
+		axis[k].x = fabsf(frustum.plane[k].x);
+		axis[k].y = fabsf(frustum.plane[k].y);
+		axis[k].z = fabsf(frustum.plane[k].z);
+	}
+
+	q_uint keep[Q_MATH_BLOCK_SIZE];
+	q_uint n = 0;
+	for (q_uint block = 0; block < center.count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = center.count - block < Q_MATH_BLOCK_SIZE ? center.count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = block; i < end; i++)
+		{
+			q_float x = center.x[i];
+			q_float y = center.y[i];
+			q_float z = center.z[i];
+			q_float ex = extent.x[i];
+			q_float ey = extent.y[i];
+			q_float ez = extent.z[i];
+
+			// Same as qmFrustumIntersectsAabb, without returning early
+			q_uint out = 0;
+			for (q_uint k = 0; k < 6; k++)
+			{
+				q_plane p = frustum.plane[k];
+				q_float r = axis[k].x * ex + axis[k].y * ey + axis[k].z * ez;
+				out |= (q_uint)(p.x * x + p.y * y + p.z * z + p.w < -r);
+			}
+			keep[i - block] = out ^ 1;
+		}
+		n = compactindex(visible, n, block, keep, end - block);
+	}
+	return n;
+}
+
+//// Bounding volume batch kernels ////
+
+// Axis-aligned box overlap kernel, compacting as the cull kernels do
+QM_KERNEL q_uint aabboverlap(q_uint *hit, q_aabb aabb, q_vector3_batch min, q_vector3_batch max)
+{
+	q_uint keep[Q_MATH_BLOCK_SIZE];
+	q_uint n = 0;
+	for (q_uint block = 0; block < min.count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = min.count - block < Q_MATH_BLOCK_SIZE ? min.count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = block; i < end; i++)
+		{
+			// Same as qmAabbIntersectsAabb
+			keep[i - block] =
+				(q_uint)(aabb.min.x <= max.x[i]) & (q_uint)(min.x[i] <= aabb.max.x) &
+				(q_uint)(aabb.min.y <= max.y[i]) & (q_uint)(min.y[i] <= aabb.max.y) &
+				(q_uint)(aabb.min.z <= max.z[i]) & (q_uint)(min.z[i] <= aabb.max.z);
+		}
+		n = compactindex(hit, n, block, keep, end - block);
+	}
+	return n;
+}
+
+// Sphere overlap kernel
+QM_KERNEL q_uint sphereoverlap(q_uint *hit, q_sphere sphere, q_vector3_batch center, const q_float *radius)
+{
+	q_uint keep[Q_MATH_BLOCK_SIZE];
+	q_uint n = 0;
+	for (q_uint block = 0; block < center.count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = center.count - block < Q_MATH_BLOCK_SIZE ? center.count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = block; i < end; i++)
+		{
+			// Same as qmSphereIntersectsSphere
+			q_float x = sphere.center.x - center.x[i];
+			q_float y = sphere.center.y - center.y[i];
+			q_float z = sphere.center.z - center.z[i];
+			q_float r = sphere.radius + radius[i];
+			keep[i - block] = (q_uint)(x * x + y * y + z * z <= r * r);
+		}
+		n = compactindex(hit, n, block, keep, end - block);
+	}
+	return n;
+}
+
+// Oriented box overlap kernel, evaluating all fifteen separating axes of each pair
+QM_KERNEL q_uint obboverlap(q_uint *hit, q_obb obb, q_obb_batch other)
+{
+	q_float le[3] = { obb.extent.x, obb.extent.y, obb.extent.z };
+	q_uint keep[Q_MATH_BLOCK_SIZE];
+	q_uint n = 0;
+	for (q_uint block = 0; block < other.center.count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = other.center.count - block < Q_MATH_BLOCK_SIZE ? other.center.count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = block; i < end; i++)
+		{
+			// Same as qmObbIntersectsObb, without returning early
+			q_float re[3] = { other.extent.x[i], other.extent.y[i], other.extent.z[i] };
+			q_float dx = other.center.x[i] - obb.center.x;
+			q_float dy = other.center.y[i] - obb.center.y;
+			q_float dz = other.center.z[i] - obb.center.z;
+
+			q_float r[3][3], a[3][3], t[3];
+			for (q_uint k = 0; k < 3; k++)
+			{
+				q_vector3 axis = obb.axis[k];
+				for (q_uint j = 0; j < 3; j++)
+				{
+					r[k][j] = axis.x * other.axis[j].x[i] + axis.y * other.axis[j].y[i] + axis.z * other.axis[j].z[i];
+					a[k][j] = fabsf(r[k][j]) + Q_EPSILON;
+				}
+				t[k] = dx * axis.x + dy * axis.y + dz * axis.z;
+			}
+
+			q_uint out = 0;
+			for (q_uint k = 0; k < 3; k++)
+			{
+				out |= (q_uint)(fabsf(t[k]) > le[k] + re[0] * a[k][0] + re[1] * a[k][1] + re[2] * a[k][2]);
+			}
+			for (q_uint j = 0; j < 3; j++)
+			{
+				q_float d = t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j];
+				out |= (q_uint)(fabsf(d) > le[0] * a[0][j] + le[1] * a[1][j] + le[2] * a[2][j] + re[j]);
+			}
+			for (q_uint k = 0; k < 3; k++)
+			{
+				q_uint k1 = (k + 1) % 3, k2 = (k + 2) % 3;
+				for (q_uint j = 0; j < 3; j++)
+				{
+					q_uint j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+					q_float d = t[k2] * r[k1][j] - t[k1] * r[k2][j];
+					out |= (q_uint)(fabsf(d) > le[k1] * a[k2][j] + le[k2] * a[k1][j] + re[j1] * a[k][j2] + re[j2] * a[k][j1]);
+				}
+			}
+			keep[i - block] = out ^ 1;
+		}
+		n = compactindex(hit, n, block, keep, end - block);
+	}
+	return n;
+}
+
+// Ray and axis-aligned box kernel, compacting the entry distances alongside the indices
+QM_KERNEL q_uint rayaabb(q_uint *hit, q_floatp distance, q_ray ray, q_vector3_batch min, q_vector3_batch max)
+{
+	q_float inv[3] = { 1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z };
+	q_float o[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+	q_uint keep[Q_MATH_BLOCK_SIZE];
+	q_float entry[Q_MATH_BLOCK_SIZE];
+	q_uint n = 0;
+	for (q_uint block = 0; block < min.count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = min.count - block < Q_MATH_BLOCK_SIZE ? min.count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = block; i < end; i++)
+		{
+			// Same as qmRayIntersectsAabb
+			q_float lo[3] = { min.x[i], min.y[i], min.z[i] };
+			q_float hi[3] = { max.x[i], max.y[i], max.z[i] };
+			q_float near = 0.0f, far = INFINITY;
+			for (q_uint k = 0; k < 3; k++)
+			{
+				q_float t0 = (lo[k] - o[k]) * inv[k];
+				q_float t1 = (hi[k] - o[k]) * inv[k];
+				q_float enter = t0 < t1 ? t0 : t1;
+				q_float exit = t0 < t1 ? t1 : t0;
+				near = enter > near ? enter : near;
+				far = exit < far ? exit : far;
+			}
+			keep[i - block] = (q_uint)(near <= far);
+			entry[i - block] = near;
+		}
+
+		if (distance != q_null)
+		{
+			for (q_uint i = block, m = n; i < end; i++)
+			{
+				distance[m] = entry[i - block];
+				m += keep[i - block];
+			}
+		}
+		n = compactindex(hit, n, block, keep, end - block);
+	}
+	return n;
+}
+
+//// Matrix44 array kernels ////
+
+#if defined(QM_SIMD)
+// Load matrix columns into registers
+static inline q_void simdcolumns(const q_matrix44 *mat, q_simd col[4])
+{
+#if defined(Q_MATH_SSE)
+	// Rows are contiguous in memory, so transpose them into columns
+	col[0] = _mm_loadu_ps(&mat->m0);
+	col[1] = _mm_loadu_ps(&mat->m1);
+	col[2] = _mm_loadu_ps(&mat->m2);
+	col[3] = _mm_loadu_ps(&mat->m3);
+	_MM_TRANSPOSE4_PS(col[0], col[1], col[2], col[3]);
+#else
+	float32x4x4_t cols = vld4q_f32(&mat->m0);
+	col[0] = cols.val[0];
+	col[1] = cols.val[1];
+	col[2] = cols.val[2];
+	col[3] = cols.val[3];
+#endif /* defined(Q_MATH_SSE) */
+}
+
+// Multiply column registers with vector register
+static inline q_simd simdtransform(const q_simd col[4], q_simd vec)
+{
+	q_simd result = simdmul(col[0], Q_SIMD_SWIZZLE(vec, 0, 0, 0, 0));
+	result = simdadd(result, simdmul(col[1], Q_SIMD_SWIZZLE(vec, 1, 1, 1, 1)));
+	result = simdadd(result, simdmul(col[2], Q_SIMD_SWIZZLE(vec, 2, 2, 2, 2)));
+	result = simdadd(result, simdmul(col[3], Q_SIMD_SWIZZLE(vec, 3, 3, 3, 3)));
+	return result;
+}
+
+// Store vector register, bypassing the cache when requested and possible
+static inline q_void simdstream(q_vector4 *result, q_simd reg, q_bool stream)
+{
+#if defined(Q_MATH_SSE)
+	if (stream)
+	{
+		_mm_stream_ps(&result->x, reg);
+		return;
+	}
+	_mm_storeu_ps(&result->x, reg);
+#else
+	(q_void)stream;
+	vst1q_f32(&result->x, reg);
+#endif /* defined(Q_MATH_SSE) */
+}
+
+// Prefetch the block after the current one
+static inline q_void simdprefetch(const q_void *address)
+{
+#if defined(Q_MATH_SSE)
+	_mm_prefetch((const char *)address, _MM_HINT_T0);
+#elif defined(__GNUC__)
+	__builtin_prefetch(address);
+#else
+	(q_void)address;
+#endif /* defined(Q_MATH_SSE)... */
+}
+#endif /* QM_SIMD */
+
+// Multiply Vector4 array function
+QM_KERNEL q_void arraymultiply(q_vector4 *result, q_matrix44 mat, const q_vector4 *vec, q_uint count, q_bool stream)
+{
+#if defined(QM_SIMD)
+	q_simd col[4];
+	simdcolumns(&mat, col);
+
+	// Non-temporal stores need 16-byte aligned output
+	stream = Q_BOOL(stream && ((uintptr_t)result & 15) == 0);
+
+	for (q_uint block = 0; block < count; block += Q_MATH_BLOCK_SIZE)
+	{
+		q_uint end = count - block < Q_MATH_BLOCK_SIZE ? count : block + Q_MATH_BLOCK_SIZE;
+		for (q_uint i = end; i < end + Q_MATH_BLOCK_SIZE && i < count; i += 4)
+		{
+			simdprefetch(vec + i);
+		}
+		for (q_uint i = block; i < end; i++)
+		{
+			simdstream(result + i, simdtransform(col, simdload(vec[i])), stream);
+		}
+	}
+
+#if defined(Q_MATH_SSE)
+	if (stream)
+	{
+		_mm_sfence();
+	}
+#endif /* defined(Q_MATH_SSE) */
+#else
+	(q_void)stream;
+	for (q_uint i = 0; i < count; i++)
+	{
+		q_vector4 v = vec[i];
+		q_vector4 r = {
+			mat.m0 * v.x + mat.m4 * v.y + mat.m8 * v.z + mat.m12 * v.w,
+			mat.m1 * v.x + mat.m5 * v.y + mat.m9 * v.z + mat.m13 * v.w,
+			mat.m2 * v.x + mat.m6 * v.y + mat.m10 * v.z + mat.m14 * v.w,
+			mat.m3 * v.x + mat.m7 * v.y + mat.m11 * v.z + mat.m15 * v.w
+		};
+		result[i] = r;
+	}
+#endif /* QM_SIMD */
+}
+
+// Multiply Vector4 array by matrix array function
+QM_KERNEL q_void arraymultiplyeach(q_vector4 *result, const q_matrix44 *mat, const q_uint *index, const q_vector4 *vec, q_uint count, q_bool stream)
+{
+#if defined(QM_SIMD)
+	stream = Q_BOOL(stream && ((uintptr_t)result & 15) == 0);
+
+	for (q_uint i = 0; i < count; i++)
+	{
+		q_simd col[4];
+		simdcolumns(mat + (index ? index[i] : i), col);
+		simdstream(result + i, simdtransform(col, simdload(vec[i])), stream);
+	}
+
+#if defined(Q_MATH_SSE)
+	if (stream)
+	{
+		_mm_sfence();
+	}
+#endif /* defined(Q_MATH_SSE) */
+#else
+	(q_void)stream;
+	for (q_uint i = 0; i < count; i++)
+	{
+		const q_matrix44 *m = mat + (index ? index[i] : i);
+		q_vector4 v = vec[i];
+		q_vector4 r = {
+			m->m0 * v.x + m->m4 * v.y + m->m8 * v.z + m->m12 * v.w,
+			m->m1 * v.x + m->m5 * v.y + m->m9 * v.z + m->m13 * v.w,
+			m->m2 * v.x + m->m6 * v.y + m->m10 * v.z + m->m14 * v.w,
+			m->m3 * v.x + m->m7 * v.y + m->m11 * v.z + m->m15 * v.w
+		};
+		result[i] = r;
+	}
+#endif /* QM_SIMD */
+}
+
+//// Quaternion array kernels ////
+
+// Rotate Vector3 array function
+QM_KERNEL q_void arrayrotate(q_vector3 *result, q_quaternion quat, const q_vector3 *vec, q_uint count)
+{
+	QM_IVDEP
+	for (q_uint i = 0; i < count; i++)
+	{
+		q_vector3 v = vec[i];
+		q_float tx = 2.0f * (quat.y * v.z - quat.z * v.y);
+		q_float ty = 2.0f * (quat.z * v.x - quat.x * v.z);
+		q_float tz = 2.0f * (quat.x * v.y - quat.y * v.x);
+
+		q_vector3 r = {
+			v.x + quat.w * tx + quat.y * tz - quat.z * ty,
+			v.y + quat.w * ty + quat.z * tx - quat.x * tz,
+			v.z + quat.w * tz + quat.x * ty - quat.y * tx
+		};
+		result[i] = r;
+	}
+}
+
+//// Dual quaternion array kernels ////
+
+// Skinning kernel, blending the joint transforms of each vertex before transforming it once
+QM_KERNEL q_void skindualquat(q_vector3 *result, q_vector3 *normalResult, const q_vector3 *vec, const q_vector3 *normal, const q_dualquat *pose, const q_uint *joint, const q_float *weight, q_uint influences, q_uint count)
+{
+	q_bool normals = Q_BOOL(normal != q_null && normalResult != q_null);
+	for (q_uint i = 0; i < count; i++)
+	{
+		const q_uint *j = joint + (q_ulong)i * influences;
+		const q_float *w = weight + (q_ulong)i * influences;
+#if defined(QM_SIMD)
+		// Real and dual parts each fill one register
+		q_simd pivot = simdload(pose[j[0]].real);
+		q_simd rs = simdsplat(0.0f);
+		q_simd ds = simdsplat(0.0f);
+
+		for (q_uint k = 0; k < influences; k++)
+		{
+			// Antipodal rotations would cancel, so every joint blends in the hemisphere of the first
+			q_simd real = simdload(pose[j[k]].real);
+			q_simd s = simdsplat(simddot(pivot, real) < 0.0f ? -w[k] : w[k]);
+			rs = simdadd(rs, simdmul(real, s));
+			ds = simdadd(ds, simdmul(simdload(pose[j[k]].dual), s));
+		}
+		q_quaternion r = simdstore(rs);
+		q_quaternion d = simdstore(ds);
+#else
+		q_quaternion pivot = pose[j[0]].real;
+		q_quaternion r = { 0.0f, 0.0f, 0.0f, 0.0f };
+		q_quaternion d = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		for (q_uint k = 0; k < influences; k++)
+		{
+			// Antipodal rotations would cancel, so every joint blends in the hemisphere of the first
+			const q_dualquat *dq = pose + j[k];
+			q_float dot = pivot.x * dq->real.x + pivot.y * dq->real.y + pivot.z * dq->real.z + pivot.w * dq->real.w;
+			q_float s = dot < 0.0f ? -w[k] : w[k];
+
+			r.x += dq->real.x * s;
+			r.y += dq->real.y * s;
+			r.z += dq->real.z * s;
+			r.w += dq->real.w * s;
+			d.x += dq->dual.x * s;
+			d.y += dq->dual.y * s;
+			d.z += dq->dual.z * s;
+			d.w += dq->dual.w * s;
+		}
+#endif /* QM_SIMD */
+
+		// Vertices without weight keep their bind pose
+		q_float squared = r.x * r.x + r.y * r.y + r.z * r.z + r.w * r.w;
+		q_vector3 p = vec[i];
+		if (squared == 0.0f)
+		{
+			result[i] = p;
+			if (normals)
+			{
+				normalResult[i] = normal[i];
+			}
+			continue;
+		}
+
+		q_float inv = 1.0f / sqrtf(squared);
+		q_quaternion rn = { r.x * inv, r.y * inv, r.z * inv, r.w * inv };
+		q_quaternion dn = { d.x * inv, d.y * inv, d.z * inv, d.w * inv };
+		r = rn;
+		d = dn;
+
+		// Same as qmDualQuatTransformPoint
+		q_vector3 c = {
+			r.y * p.z - r.z * p.y + r.w * p.x,
+			r.z * p.x - r.x * p.z + r.w * p.y,
+			r.x * p.y - r.y * p.x + r.w * p.z
+		};
+		q_vector3 out = {
+			p.x + 2.0f * (r.y * c.z - r.z * c.y + r.w * d.x - d.w * r.x + r.y * d.z - r.z * d.y),
+			p.y + 2.0f * (r.z * c.x - r.x * c.z + r.w * d.y - d.w * r.y + r.z * d.x - r.x * d.z),
+			p.z + 2.0f * (r.x * c.y - r.y * c.x + r.w * d.z - d.w * r.z + r.x * d.y - r.y * d.x)
+		};
+		result[i] = out;
+
+		// Normals only rotate
+		if (normals)
+		{
+			q_vector3 n = normal[i];
+			q_vector3 cn = {
+				r.y * n.z - r.z * n.y + r.w * n.x,
+				r.z * n.x - r.x * n.z + r.w * n.y,
+				r.x * n.y - r.y * n.x + r.w * n.z
+			};
+			q_vector3 rotated = {
+				n.x + 2.0f * (r.y * cn.z - r.z * cn.y),
+				n.y + 2.0f * (r.z * cn.x - r.x * cn.z),
+				n.z + 2.0f * (r.x * cn.y - r.y * cn.x)
+			};
+			normalResult[i] = rotated;
+		}
+	}
+}
+
+#if defined(QM_DISPATCH_X86)
+// Multiply Vector4 array kernel, two vectors per 256-bit register
+QM_TARGET_AVX2 static q_void arraymultiplyavx2(q_vector4 *result, q_matrix44 mat, const q_vector4 *vec, q_uint count, q_bool stream)
+{
+	q_simd col[4];
+	simdcolumns(&mat, col);
+	__m256 c0 = _mm256_set_m128(col[0], col[0]);
+	__m256 c1 = _mm256_set_m128(col[1], col[1]);
+	__m256 c2 = _mm256_set_m128(col[2], col[2]);
+	__m256 c3 = _mm256_set_m128(col[3], col[3]);
+
+	// Wide non-temporal stores need 32-byte aligned output, reached by one narrow store
+	stream = Q_BOOL(stream && ((uintptr_t)result & 15) == 0);
+	q_uint i = 0;
+	if (stream && ((uintptr_t)result & 31) != 0 && count > 0)
+	{
+		simdstream(result, simdtransform(col, simdload(vec[0])), q_true);
+		i = 1;
+	}
+
+	for (; i + 2 <= count; i += 2)
+	{
+		if (i % Q_MATH_BLOCK_SIZE < 2)
+		{
+			for (q_uint p = i + Q_MATH_BLOCK_SIZE; p < i + 2 * Q_MATH_BLOCK_SIZE && p < count; p += 4)
+			{
+				simdprefetch(vec + p);
+			}
+		}
+
+		__m256 v = _mm256_loadu_ps(&vec[i].x);
+		__m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+		r = _mm256_fmadd_ps(c1, _mm256_permute_ps(v, 0x55), r);
+		r = _mm256_fmadd_ps(c2, _mm256_permute_ps(v, 0xAA), r);
+		r = _mm256_fmadd_ps(c3, _mm256_permute_ps(v, 0xFF), r);
+		if (stream)
+		{
+			_mm256_stream_ps(&result[i].x, r);
+		}
+		else
+		{
+			_mm256_storeu_ps(&result[i].x, r);
+		}
+	}
+	if (i < count)
+	{
+		simdstream(result + i, simdtransform(col, simdload(vec[i])), stream);
+	}
+
+	if (stream)
+	{
+		_mm_sfence();
+	}
+}
+
+// Multiply Vector4 array kernel, four vectors per 512-bit register
+QM_TARGET_AVX512 static q_void arraymultiplyavx512(q_vector4 *result, q_matrix44 mat, const q_vector4 *vec, q_uint count, q_bool stream)
+{
+	q_simd col[4];
+	simdcolumns(&mat, col);
+	__m512 c0 = _mm512_broadcast_f32x4(col[0]);
+	__m512 c1 = _mm512_broadcast_f32x4(col[1]);
+	__m512 c2 = _mm512_broadcast_f32x4(col[2]);
+	__m512 c3 = _mm512_broadcast_f32x4(col[3]);
+
+	// Wide non-temporal stores need 64-byte aligned output, reached by up to three narrow stores
+	stream = Q_BOOL(stream && ((uintptr_t)result & 15) == 0);
+	q_uint i = 0;
+	while (stream && ((uintptr_t)(result + i) & 63) != 0 && i < count)
+	{
+		simdstream(result + i, simdtransform(col, simdload(vec[i])), q_true);
+		i++;
+	}
+
+	for (; i + 4 <= count; i += 4)
+	{
+		if (i % Q_MATH_BLOCK_SIZE < 4)
+		{
+			for (q_uint p = i + Q_MATH_BLOCK_SIZE; p < i + 2 * Q_MATH_BLOCK_SIZE && p < count; p += 4)
+			{
+				simdprefetch(vec + p);
+			}
+		}
+
+		__m512 v = _mm512_loadu_ps(&vec[i].x);
+		__m512 r = _mm512_mul_ps(c0, _mm512_permute_ps(v, 0x00));
+		r = _mm512_fmadd_ps(c1, _mm512_permute_ps(v, 0x55), r);
+		r = _mm512_fmadd_ps(c2, _mm512_permute_ps(v, 0xAA), r);
+		r = _mm512_fmadd_ps(c3, _mm512_permute_ps(v, 0xFF), r);
+		if (stream)
+		{
+			_mm512_stream_ps(&result[i].x, r);
+		}
+		else
+		{
+			_mm512_storeu_ps(&result[i].x, r);
+		}
+	}
+	for (; i < count; i++)
+	{
+		simdstream(result + i, simdtransform(col, simdload(vec[i])), stream);
+	}
+
+	if (stream)
+	{
+		_mm_sfence();
+	}
+}
+#endif /* QM_DISPATCH_X86 */
+
+//// Kernel dispatch ////
+
+// Each entry is (function, kernel, parameters, arguments) for kernels that every
+// instruction set variant compiles from the same source
+#define QM_KERNELS(X) \
+	X(FloatBatchSinCos, batchsincos, (q_floatp sine, q_floatp cosine, const q_float *angle, q_uint count), (sine, cosine, angle, count)) \
+	X(Vector3BatchAdd, batchadd, (q_vector3_batch result, q_vector3_batch left, q_vector3_batch right), (result, left, right)) \
+	X(Vector3BatchScale, batchscale, (q_vector3_batch result, q_vector3_batch vec, q_float scl), (result, vec, scl)) \
+	X(Vector3BatchNormalize, batchnormalize, (q_vector3_batch result, q_vector3_batch vec), (result, vec)) \
+	X(Vector3BatchLerp, batchlerp, (q_vector3_batch result, q_float value, q_vector3_batch start, q_vector3_batch end), (result, value, start, end)) \
+	X(Vector3BatchCrossProduct, batchcross, (q_vector3_batch result, q_vector3_batch left, q_vector3_batch right), (result, left, right)) \
+	X(Vector3BatchTransform, batchtransform, (q_vector3_batch result, q_vector3_batch vec, q_matrix44 mat), (result, vec, mat)) \
+	X(Vector3BatchRotate, batchrotate, (q_vector3_batch result, q_vector3_batch vec, q_quaternion quat), (result, vec, quat)) \
+	X(Vector3BatchLength, batchlength, (q_floatp result, q_vector3_batch vec), (result, vec)) \
+	X(Vector3BatchDotProduct, batchdot, (q_floatp result, q_vector3_batch left, q_vector3_batch right), (result, left, right)) \
+	X(QuaternionRotateVector3Array, arrayrotate, (q_vector3 *result, q_quaternion quat, const q_vector3 *vec, q_uint count), (result, quat, vec, count)) \
+	X(Matrix44ArrayMultiplyVector4Array, arraymultiplyeach, (q_vector4 *result, const q_matrix44 *mat, const q_uint *index, const q_vector4 *vec, q_uint count, q_bool stream), (result, mat, index, vec, count, stream))
+
+// Kernels working on one element at a time, which gain nothing from 512-bit registers
+// and would only pay for them, so the AVX-512 table reuses their AVX2 variant
+#define QM_NARROW_KERNELS(X) \
+	X(DualQuatSkinVector3Array, skindualquat, (q_vector3 *result, q_vector3 *normalResult, const q_vector3 *vec, const q_vector3 *normal, const q_dualquat *pose, const q_uint *joint, const q_float *weight, q_uint influences, q_uint count), (result, normalResult, vec, normal, pose, joint, weight, influences, count))
+
+// Kernels returning how many results they wrote, compiled the same way as QM_KERNELS
+#define QM_COUNT_KERNELS(X) \
+	X(FrustumCullSphereBatch, cullsphere, (q_uint *visible, q_frustum frustum, q_vector3_batch center, const q_float *radius), (visible, frustum, center, radius)) \
+	X(FrustumCullAabbBatch, cullaabb, (q_uint *visible, q_frustum frustum, q_vector3_batch center, q_vector3_batch extent), (visible, frustum, center, extent)) \
+	X(AabbIntersectsAabbBatch, aabboverlap, (q_uint *hit, q_aabb aabb, q_vector3_batch min, q_vector3_batch max), (hit, aabb, min, max)) \
+	X(SphereIntersectsSphereBatch, sphereoverlap, (q_uint *hit, q_sphere sphere, q_vector3_batch center, const q_float *radius), (hit, sphere, center, radius)) \
+	X(ObbIntersectsObbBatch, obboverlap, (q_uint *hit, q_obb obb, q_obb_batch other), (hit, obb, other)) \
+	X(RayIntersectsAabbBatch, rayaabb, (q_uint *hit, q_floatp distance, q_ray ray, q_vector3_batch min, q_vector3_batch max), (hit, distance, ray, min, max))
+
+// Kernels with a hand-written variant per instruction set
+#define QM_MULTIPLY_PARAMS (q_vector4 *result, q_matrix44 mat, const q_vector4 *vec, q_uint count, q_bool stream)
+
+typedef struct qm_kernel_table
+{
+	#define QM_TABLE_MEMBER(name, kernel, params, args) q_void (*name) params;
+	QM_KERNELS(QM_TABLE_MEMBER)
+	QM_NARROW_KERNELS(QM_TABLE_MEMBER)
+	#undef QM_TABLE_MEMBER
+	#define QM_COUNT_TABLE_MEMBER(name, kernel, params, args) q_uint (*name) params;
+	QM_COUNT_KERNELS(QM_COUNT_TABLE_MEMBER)
+	#undef QM_COUNT_TABLE_MEMBER
+	q_void (*Matrix44MultiplyVector4Array) QM_MULTIPLY_PARAMS;
+} qm_kernel_table;
+
+// Variant of kernel compiled for target, named after the function with suffix
+#define QM_VARIANT(target, suffix, name, kernel, params, args) \
+	target static q_void qm##name##suffix params \
+	{ \
+		kernel args; \
+	}
+
+#define QM_COUNT_VARIANT(target, suffix, name, kernel, params, args) \
+	target static q_uint qm##name##suffix params \
+	{ \
+		return kernel args; \
+	}
+
+#define QM_BASELINE_VARIANT(name, kernel, params, args) QM_VARIANT(, Baseline, name, kernel, params, args)
+#define QM_BASELINE_COUNT_VARIANT(name, kernel, params, args) QM_COUNT_VARIANT(, Baseline, name, kernel, params, args)
+#define QM_BASELINE_ENTRY(name, kernel, params, args) .name = qm##name##Baseline,
+
+QM_KERNELS(QM_BASELINE_VARIANT)
+QM_NARROW_KERNELS(QM_BASELINE_VARIANT)
+QM_COUNT_KERNELS(QM_BASELINE_COUNT_VARIANT)
+
+static const qm_kernel_table qm_kernels_baseline = {
+	QM_KERNELS(QM_BASELINE_ENTRY)
+	QM_NARROW_KERNELS(QM_BASELINE_ENTRY)
+	QM_COUNT_KERNELS(QM_BASELINE_ENTRY)
+	.Matrix44MultiplyVector4Array = arraymultiply
+};
+
+#if defined(QM_DISPATCH_X86)
+#define QM_AVX2_VARIANT(name, kernel, params, args) QM_VARIANT(QM_TARGET_AVX2, Avx2, name, kernel, params, args)
+#define QM_AVX2_COUNT_VARIANT(name, kernel, params, args) QM_COUNT_VARIANT(QM_TARGET_AVX2, Avx2, name, kernel, params, args)
+#define QM_AVX2_ENTRY(name, kernel, params, args) .name = qm##name##Avx2,
+#define QM_AVX512_VARIANT(name, kernel, params, args) QM_VARIANT(QM_TARGET_AVX512, Avx512, name, kernel, params, args)
+#define QM_AVX512_COUNT_VARIANT(name, kernel, params, args) QM_COUNT_VARIANT(QM_TARGET_AVX512, Avx512, name, kernel, params, args)
+#define QM_AVX512_ENTRY(name, kernel, params, args) .name = qm##name##Avx512,
+
+QM_KERNELS(QM_AVX2_VARIANT)
+QM_NARROW_KERNELS(QM_AVX2_VARIANT)
+QM_COUNT_KERNELS(QM_AVX2_COUNT_VARIANT)
+QM_KERNELS(QM_AVX512_VARIANT)
+QM_COUNT_KERNELS(QM_AVX512_COUNT_VARIANT)
+
+static const qm_kernel_table qm_kernels_avx2 = {
+	QM_KERNELS(QM_AVX2_ENTRY)
+	QM_NARROW_KERNELS(QM_AVX2_ENTRY)
+	QM_COUNT_KERNELS(QM_AVX2_ENTRY)
+	.Matrix44MultiplyVector4Array = arraymultiplyavx2
+};
+
+static const qm_kernel_table qm_kernels_avx512 = {
+	QM_KERNELS(QM_AVX512_ENTRY)
+	QM_NARROW_KERNELS(QM_AVX2_ENTRY)
+	QM_COUNT_KERNELS(QM_AVX512_ENTRY)
+	.Matrix44MultiplyVector4Array = arraymultiplyavx512
+};
+#endif /* QM_DISPATCH_X86 */
+
+// Indexed by q_math_isa, null where this build has no variant
+static const qm_kernel_table *const qm_kernel_tables[Q_MATH_ISA_COUNT] = {
+	&qm_kernels_baseline,
+#if defined(QM_DISPATCH_X86)
+	&qm_kernels_avx2,
+	&qm_kernels_avx512
+#endif /* QM_DISPATCH_X86 */
+};
+
+static const q_str qm_isa_names[Q_MATH_ISA_COUNT] = { "baseline", "avx2", "avx512" };
+
+// Swapped as a whole, so a thread overriding the selection never exposes a mixed table
+static const qm_kernel_table *_Atomic qm_kernels = &qm_kernels_baseline;
+static _Atomic q_int qm_isa = Q_MATH_ISA_BASELINE;
+
+// Get whether this build and processor can run variant
+Q_API q_bool qmDispatchSupported(q_math_isa isa)
+{
+	if ((q_uint)isa >= Q_MATH_ISA_COUNT || qm_kernel_tables[isa] == q_null)
+	{
+		return q_false;
+	}
+
+#if defined(QM_DISPATCH_X86)
+	// Also checks that the operating system saves the wide registers
+	__builtin_cpu_init();
+	switch (isa)
+	{
+	case Q_MATH_ISA_AVX2:
+		return Q_BOOL(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"));
+	case Q_MATH_ISA_AVX512:
+		return Q_BOOL(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"));
+	default:
+		break;
+	}
+#endif /* QM_DISPATCH_X86 */
+	return q_true;
+}
+
+// Get variant the kernels currently run
+Q_API q_math_isa qmDispatchGetIsa(q_void)
+{
+	return (q_math_isa)atomic_load_explicit(&qm_isa, memory_order_relaxed);
+}
+
+// Override variant the kernels run, failing if it is not supported
+Q_API q_bool qmDispatchSetIsa(q_math_isa isa)
+{
+	if (!qmDispatchSupported(isa))
+	{
+		return q_false;
+	}
+
+	atomic_store_explicit(&qm_kernels, qm_kernel_tables[isa], memory_order_relaxed);
+	atomic_store_explicit(&qm_isa, isa, memory_order_relaxed);
+	return q_true;
+}
+
+// Get widest supported variant
+Q_API q_math_isa qmDispatchBestIsa(q_void)
+{
+	q_int isa = Q_MATH_ISA_COUNT - 1;
+	while (isa > Q_MATH_ISA_BASELINE && !qmDispatchSupported((q_math_isa)isa))
+	{
+		isa--;
+	}
+	return (q_math_isa)isa;
+}
+
+// Get variant name, as accepted by the QUITE_MATH_ISA environment variable
+Q_API q_str qmDispatchIsaName(q_math_isa isa)
+{
+	return (q_uint)isa < Q_MATH_ISA_COUNT ? qm_isa_names[isa] : "unknown";
+}
+
+#if defined(QM_DISPATCH_X86)
+// Select widest variant before main, unless QUITE_MATH_ISA names a supported one
+__attribute__((constructor)) static q_void qmDispatchInit(q_void)
+{
+	q_str name = getenv("QUITE_MATH_ISA");
+	for (q_int isa = 0; name != q_null && isa < Q_MATH_ISA_COUNT; isa++)
+	{
+		if (strcmp(name, qm_isa_names[isa]) == 0 && qmDispatchSetIsa((q_math_isa)isa))
+		{
+			return;
+		}
+	}
+	qmDispatchSetIsa(qmDispatchBestIsa());
+}
+#endif /* QM_DISPATCH_X86 */
+
+//// Batch and array functions ////
+
+// Forward to the selected variant
+#define QM_DISPATCH(name, kernel, params, args) \
+	Q_API q_void qm##name params \
+	{ \
+		atomic_load_explicit(&qm_kernels, memory_order_relaxed)->name args; \
+	}
+
+#define QM_COUNT_DISPATCH(name, kernel, params, args) \
+	Q_API q_uint qm##name params \
+	{ \
+		return atomic_load_explicit(&qm_kernels, memory_order_relaxed)->name args; \
+	}
+
+QM_KERNELS(QM_DISPATCH)
+QM_NARROW_KERNELS(QM_DISPATCH)
+QM_COUNT_KERNELS(QM_COUNT_DISPATCH)
+QM_DISPATCH(Matrix44MultiplyVector4Array, arraymultiply, QM_MULTIPLY_PARAMS, (result, mat, vec, count, stream))
@@ -35,7 +35,8 @@
 	#elif defined(_WIN32) && defined(Q_IMPORT_SHARED_LIBRARY)
 		#define QM_API __declspec(dllimport)
 	#elif defined(Q_EXPORT_SHARED_LIBRARY)
-		#define QM_API __attribute__((visibility("default")))
+		// Still inline, so calls between exported functions are not held back by interposition
+		#define QM_API __attribute__((visibility("default"))) extern inline
 	#else
 		#define QM_API extern inline
 	#endif /* defined(_WIN32) && defined(Q_EXPORT_SHARED_LIBRARY)... */
@@ -45,7 +46,60 @@
 	#define QM_API inline
 #endif /* defined(Q_MATH_IMPLEMENTATION)... */
 
+// Internal functions follow the linkage of the public ones without being exported
+#if defined(Q_MATH_IMPLEMENTATION)
+	#define QM_INTERNAL extern inline
+#elif defined(Q_MATH_STATIC_INLINE)
+	#define QM_INTERNAL static inline
+#else
+	#define QM_INTERNAL inline
+#endif /* defined(Q_MATH_IMPLEMENTATION)... */
+
+// Pointer functions promise their result overlaps no operand, spelled the C++ way where needed
+#if defined(__cplusplus) || defined(_MSC_VER)
+	#define QM_RESTRICT __restrict
+#else
+	#define QM_RESTRICT restrict
+#endif /* defined(__cplusplus) || defined(_MSC_VER) */
+
+// Pointer functions wrap the value functions, which must be inlined into them to save any copy
+#if defined(__GNUC__) || defined(__clang__)
+	#define QM_FLATTEN __attribute__((flatten))
+#else
+	#define QM_FLATTEN
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+//// SIMD ////
+
+// Q_MATH_SIMD opts into 128-bit kernels for the vector4 and quaternion families,
+// falling back to the scalar code when the target has no supported instruction set
+#if defined(Q_MATH_SIMD)
+	#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+		#define Q_MATH_SSE
+	#elif (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__) && defined(__GNUC__)
+		#define Q_MATH_NEON
+	#endif /* defined(__SSE__) || defined(_M_X64)... */
+#endif /* Q_MATH_SIMD */
+
+#if defined(Q_MATH_SSE) || defined(Q_MATH_NEON)
+	#define QM_SIMD
+#endif /* defined(Q_MATH_SSE) || defined(Q_MATH_NEON) */
+
+// Double-precision kernels hold four doubles per register, swizzled across lanes with AVX2
+#if defined(Q_MATH_SIMD) && defined(__AVX2__)
+	#define QM_SIMD_DOUBLE
+#endif /* defined(Q_MATH_SIMD) && defined(__AVX2__) */
+
 #include <math.h>
+#include <stddef.h> // NULL
+#if defined(Q_MATH_SSE)
+	#include <xmmintrin.h>
+#elif defined(Q_MATH_NEON)
+	#include <arm_neon.h>
+#endif /* defined(Q_MATH_SSE)... */
+#if defined(QM_SIMD_DOUBLE)
+	#include <immintrin.h>
+#endif /* QM_SIMD_DOUBLE */
 #include "quite.h"
 
 //// Epsilon ////
@@ -54,6 +108,10 @@
 	#define Q_EPSILON 1.192092896e-7
 #endif /* Q_EPSILON */
 
+#ifndef Q_EPSILON_DOUBLE
+	#define Q_EPSILON_DOUBLE 2.2204460492503131e-16
+#endif /* Q_EPSILON_DOUBLE */
+
 //// Angles ////
 
 #ifndef Q_PI
@@ -170,3252 +228,853 @@
 	typedef q_vector4 q_quaternion;
 #endif /* Q_QUATERNION */
 
-//// Internal functions ////
+//// Dual quaternion type ////
 
-// Square function
-inline q_float sqf(q_float x)
-{
-	return x * x;
-}
+#ifndef Q_DUALQUAT
+	#define Q_DUALQUAT
 
-// Cube function
-inline q_float cbf(q_float x)
-{
-	return x * x * x;
-}
+	// Rigid transform as a rotation in the real part and half the translation times the rotation in the dual part
+	typedef struct q_dualquat
+	{
+		q_quaternion real;
+		q_quaternion dual;
+	} q_dualquat;
+#endif /* Q_DUALQUAT */
 
-// Float equal function
-inline q_bool equalf(q_float l, q_float r)
-{
-	return Q_BOOL(fabsf(l - r) <= fmaxf(fmaxf(fabsf(l), fabsf(r)), 1.0f) * Q_EPSILON);
-}
+//// Plane and frustum types ////
 
-//// Functions ////
+#ifndef Q_PLANE
+	#define Q_PLANE
 
-// Prevent function name mangling
-#ifdef __cplusplus
-extern "C"
-{
-#endif /* __cplusplus */
+	// Plane of the points p where dot(p, xyz) + w is zero, facing the side where it is positive
+	typedef q_vector4 q_plane;
 
-//// Float functions ////
+	// Inward-facing planes in the order left, right, bottom, top, near, far
+	typedef struct q_frustum
+	{
+		q_plane plane[6];
+	} q_frustum;
+#endif /* Q_PLANE */
+
+//// Bounding volume types ////
+
+#ifndef Q_BOUNDS
+	#define Q_BOUNDS
+
+	// Axis-aligned box, empty while any min component exceeds its max
+	typedef struct q_aabb
+	{
+		q_vector3 min;
+		q_vector3 max;
+	} q_aabb;
+
+	typedef struct q_sphere
+	{
+		q_vector3 center;
+		q_float radius;
+	} q_sphere;
+
+	// Oriented box with unit axes and the half extent along each
+	typedef struct q_obb
+	{
+		q_vector3 center;
+		q_vector3 axis[3];
+		q_vector3 extent;
+	} q_obb;
+
+	// Ray of the points origin + t * direction for t >= 0
+	typedef struct q_ray
+	{
+		q_vector3 origin;
+		q_vector3 direction;
+	} q_ray;
+#endif /* Q_BOUNDS */
+
+//// Double-precision types ////
+
+#ifndef Q_VECTOR_DOUBLE
+	#define Q_VECTOR_DOUBLE
+
+	typedef struct q_vector2d
+	{
+		q_double x;
+		q_double y;
+	} q_vector2d;
+
+	typedef struct q_vector3d
+	{
+		q_double x;
+		q_double y;
+		q_double z;
+	} q_vector3d;
+
+	typedef struct q_vector4d
+	{
+		q_double x;
+		q_double y;
+		q_double z;
+		q_double w;
+	} q_vector4d;
+#endif /* Q_VECTOR_DOUBLE */
+
+#ifndef Q_MATRIX_DOUBLE
+	#define Q_MATRIX_DOUBLE
+
+	typedef struct q_matrix22d
+	{
+		q_double m0, m2;
+		q_double m1, m3;
+	} q_matrix22d;
+
+	typedef struct q_matrix23d
+	{
+		q_double m0, m2, m4;
+		q_double m1, m3, m5;
+	} q_matrix23d;
+
+	typedef struct q_matrix24d
+	{
+		q_double m0, m2, m4, m6;
+		q_double m1, m3, m5, m7;
+	} q_matrix24d;
+
+	typedef struct q_matrix32d
+	{
+		q_double m0, m3;
+		q_double m1, m4;
+		q_double m2, m5;
+	} q_matrix32d;
+
+	typedef struct q_matrix33d
+	{
+		q_double m0, m3, m6;
+		q_double m1, m4, m7;
+		q_double m2, m5, m8;
+	} q_matrix33d;
+
+	typedef struct q_matrix34d
+	{
+		q_double m0, m3, m6, m9;
+		q_double m1, m4, m7, m10;
+		q_double m2, m5, m8, m11;
+	} q_matrix34d;
+
+	typedef struct q_matrix42d
+	{
+		q_double m0, m4;
+		q_double m1, m5;
+		q_double m2, m6;
+		q_double m3, m7;
+	} q_matrix42d;
+
+	typedef struct q_matrix43d
+	{
+		q_double m0, m4, m8;
+		q_double m1, m5, m9;
+		q_double m2, m6, m10;
+		q_double m3, m7, m11;
+	} q_matrix43d;
+
+	typedef struct q_matrix44d
+	{
+		q_double m0, m4, m8, m12;
+		q_double m1, m5, m9, m13;
+		q_double m2, m6, m10, m14;
+		q_double m3, m7, m11, m15;
+	} q_matrix44d;
+#endif /* Q_MATRIX_DOUBLE */
+
+#ifndef Q_QUATERNION_DOUBLE
+	#define Q_QUATERNION_DOUBLE
 
-// Clamp function
-QM_API q_float qmFloatClamp(q_float value, q_float min, q_float max)
+	typedef q_vector4d q_quaterniond;
+#endif /* Q_QUATERNION_DOUBLE */
+
+#ifndef Q_DUALQUAT_DOUBLE
+	#define Q_DUALQUAT_DOUBLE
+
+	typedef struct q_dualquatd
+	{
+		q_quaterniond real;
+		q_quaterniond dual;
+	} q_dualquatd;
+#endif /* Q_DUALQUAT_DOUBLE */
+
+#ifndef Q_PLANE_DOUBLE
+	#define Q_PLANE_DOUBLE
+
+	typedef q_vector4d q_planed;
+
+	typedef struct q_frustumd
+	{
+		q_planed plane[6];
+	} q_frustumd;
+#endif /* Q_PLANE_DOUBLE */
+
+#ifndef Q_BOUNDS_DOUBLE
+	#define Q_BOUNDS_DOUBLE
+
+	typedef struct q_aabbd
+	{
+		q_vector3d min;
+		q_vector3d max;
+	} q_aabbd;
+
+	typedef struct q_sphered
+	{
+		q_vector3d center;
+		q_double radius;
+	} q_sphered;
+
+	typedef struct q_obbd
+	{
+		q_vector3d center;
+		q_vector3d axis[3];
+		q_vector3d extent;
+	} q_obbd;
+
+	typedef struct q_rayd
+	{
+		q_vector3d origin;
+		q_vector3d direction;
+	} q_rayd;
+#endif /* Q_BOUNDS_DOUBLE */
+
+//// Batch types ////
+
+#ifndef Q_VECTOR_BATCH
+	#define Q_VECTOR_BATCH
+
+	// Structure-of-arrays view over caller-owned component arrays
+	typedef struct q_vector3_batch
+	{
+		q_floatp x;
+		q_floatp y;
+		q_floatp z;
+		q_uint count;
+	} q_vector3_batch;
+#endif /* Q_VECTOR_BATCH */
+
+#ifndef Q_BOUNDS_BATCH
+	#define Q_BOUNDS_BATCH
+
+	// Structure-of-arrays view over oriented boxes, counted by the center batch
+	typedef struct q_obb_batch
+	{
+		q_vector3_batch center;
+		q_vector3_batch axis[3];
+		q_vector3_batch extent;
+	} q_obb_batch;
+#endif /* Q_BOUNDS_BATCH */
+
+//// Dispatch types ////
+
+// Instruction set variants of the batch and array kernels, from narrowest to widest
+typedef enum
 {
-	if (max < min)
+	Q_MATH_ISA_BASELINE,
+	Q_MATH_ISA_AVX2,
+	Q_MATH_ISA_AVX512,
+	Q_MATH_ISA_COUNT
+} q_math_isa;
+
+//// Internal functions ////
+
+#if defined(Q_MATH_SSE)
+	typedef __m128 q_simd;
+
+	// Swizzle lanes of a register
+	#define Q_SIMD_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(w, z, y, x))
+#elif defined(Q_MATH_NEON)
+	typedef float32x4_t q_simd;
+
+	// Swizzle lanes of a register
+	#if defined(__clang__)
+		#define Q_SIMD_SWIZZLE(v, x, y, z, w) __builtin_shufflevector((v), (v), x, y, z, w)
+	#else
+		#define Q_SIMD_SWIZZLE(v, x, y, z, w) __builtin_shuffle((v), (uint32x4_t){ x, y, z, w })
+	#endif /* defined(__clang__) */
+#endif /* defined(Q_MATH_SSE)... */
+
+#if defined(QM_SIMD)
+	// Load vector into register
+	QM_INTERNAL q_simd simdload(q_vector4 vec)
 	{
-		return value;
+	#if defined(Q_MATH_SSE)
+		return _mm_loadu_ps(&vec.x);
+	#else
+		return vld1q_f32(&vec.x);
+	#endif /* defined(Q_MATH_SSE) */
 	}
-	return fminf(fmaxf(value, min), max);
-}
 
-// Wrap function
-QM_API q_float qmFloatWrap(q_float value, q_float min, q_float max)
-{
-	if (max <= min)
+	// Store register into vector
+	QM_INTERNAL q_vector4 simdstore(q_simd reg)
 	{
-		return value;
+		q_vector4 result;
+	#if defined(Q_MATH_SSE)
+		_mm_storeu_ps(&result.x, reg);
+	#else
+		vst1q_f32(&result.x, reg);
+	#endif /* defined(Q_MATH_SSE) */
+		return result;
 	}
-	return value - (max - min) * floorf((value - min) / (max - min));
-}
 
-// Linear interpolate function
-QM_API q_float qmFloatLerp(q_float value, q_float start, q_float end)
-{
-	return start + value * (end - start);
-}
+	// Set register lanes
+	QM_INTERNAL q_simd simdset(q_float x, q_float y, q_float z, q_float w)
+	{
+	#if defined(Q_MATH_SSE)
+		return _mm_setr_ps(x, y, z, w);
+	#else
+		q_float lanes[4] = { x, y, z, w };
+		return vld1q_f32(lanes);
+	#endif /* defined(Q_MATH_SSE) */
+	}
 
-// Normalize function
-QM_API q_float qmFloatNormalize(q_float value, q_float start, q_float end)
-{
-	return (value - start) * (end - start);
-}
+	// Broadcast scalar to all lanes
+	QM_INTERNAL q_simd simdsplat(q_float scl)
+	{
+	#if defined(Q_MATH_SSE)
+		return _mm_set1_ps(scl);
+	#else
+		return vdupq_n_f32(scl);
+	#endif /* defined(Q_MATH_SSE) */
+	}
 
-// Remap function
-QM_API q_float qmFloatRemap(q_float value, q_float inStart, q_float inEnd, q_float outStart, q_float outEnd)
-{
-	if (inStart == inEnd || outStart == outEnd)
+	// Lane-wise add
+	QM_INTERNAL q_simd simdadd(q_simd left, q_simd right)
+	{
+	#if defined(Q_MATH_SSE)
+		return _mm_add_ps(left, right);
+	#else
+		return vaddq_f32(left, right);
+	#endif /* defined(Q_MATH_SSE) */
+	}
+
+	// Lane-wise subtract
+	QM_INTERNAL q_simd simdsub(q_simd left, q_simd right)
 	{
-		return value;
+	#if defined(Q_MATH_SSE)
+		return _mm_sub_ps(left, right);
+	#else
+		return vsubq_f32(left, right);
+	#endif /* defined(Q_MATH_SSE) */
 	}
-	return (value - inStart) * (outEnd - outStart) / (inEnd - inStart) + outStart;
-}
 
-// Equal function
-QM_API q_bool qmFloatEqual(q_float left, q_float right)
+	// Lane-wise multiply
+	QM_INTERNAL q_simd simdmul(q_simd left, q_simd right)
+	{
+	#if defined(Q_MATH_SSE)
+		return _mm_mul_ps(left, right);
+	#else
+		return vmulq_f32(left, right);
+	#endif /* defined(Q_MATH_SSE) */
+	}
+
+	// Lane-wise divide
+	QM_INTERNAL q_simd simddiv(q_simd left, q_simd right)
+	{
+	#if defined(Q_MATH_SSE)
+		return _mm_div_ps(left, right);
+	#else
+		return vdivq_f32(left, right);
+	#endif /* defined(Q_MATH_SSE) */
+	}
+
+	// Horizontal sum of all lanes
+	QM_INTERNAL q_float simdsum(q_simd reg)
+	{
+	#if defined(Q_MATH_SSE)
+		__m128 shuf = _mm_shuffle_ps(reg, reg, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128 sums = _mm_add_ps(reg, shuf);
+		shuf = _mm_movehl_ps(shuf, sums);
+		return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+	#else
+		return vaddvq_f32(reg);
+	#endif /* defined(Q_MATH_SSE) */
+	}
+
+	// Dot product of all lanes
+	QM_INTERNAL q_float simddot(q_simd left, q_simd right)
+	{
+		return simdsum(simdmul(left, right));
+	}
+#endif /* QM_SIMD */
+
+// Sine and cosine polynomials after reduction to a quarter turn, within 1e-7 absolute error
+// for angles up to 8192 radians; accuracy falls off beyond, reaching 1e-6 at 65536
+QM_INTERNAL q_void sincospolyf(q_float angle, q_floatp sine, q_floatp cosine)
 {
-	return Q_BOOL(equalf(left, right));
+	// Three-part pi / 2 keeps the reduction exact for the quadrants above
+	q_int quadrant = (q_int)(angle * 0.636619772f + (angle < 0.0f ? -0.5f : 0.5f));
+	q_float k = (q_float)quadrant;
+	q_float r = ((angle - k * 1.5703125f) - k * 4.837512969970703125e-4f) - k * 7.54978995489188216e-8f;
+	q_float z = r * r;
+
+	q_float s = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+	q_float c = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.0f;
+
+	q_float qs = (quadrant & 1) ? c : s;
+	q_float qc = (quadrant & 1) ? s : c;
+	*sine = (quadrant & 2) ? -qs : qs;
+	*cosine = ((quadrant + 1) & 2) ? -qc : qc;
 }
 
-//// Vector2 functions ////
+// Q_MATH_FAST trades libm accuracy for the approximations below, with the error bounds given
+#if defined(Q_MATH_FAST)
+	// Reciprocal square root, within 3e-7 relative error from SSE or 5e-6 otherwise
+	QM_INTERNAL q_float invsqrtf(q_float x)
+	{
+		// Estimates flush denormals to infinity, so those take the exact path
+		if (x < 1.17549435e-38f)
+		{
+			return 1.0f / sqrtf(x);
+		}
+
+	#if defined(Q_MATH_SSE)
+		q_float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+		return y * (1.5f - 0.5f * x * y * y);
+	#else
+		union
+		{
+			q_float f;
+			q_uint i;
+		} bits = { x };
+		bits.i = 0x5f375a86u - (bits.i >> 1);
+		q_float y = bits.f;
+		y = y * (1.5f - 0.5f * x * y * y);
+		return y * (1.5f - 0.5f * x * y * y);
+	#endif /* defined(Q_MATH_SSE) */
+	}
+
+	// Sine and cosine, with the polynomial error bound up to 8192 radians and libm beyond
+	QM_INTERNAL q_void sinecosinef(q_float angle, q_floatp sine, q_floatp cosine)
+	{
+		if (fabsf(angle) > 8192.0f)
+		{
+			*sine = sinf(angle);
+			*cosine = cosf(angle);
+			return;
+		}
+		sincospolyf(angle, sine, cosine);
+	}
+
+	// Sine function
+	QM_INTERNAL q_float sinef(q_float angle)
+	{
+		q_float sine, cosine;
+		sinecosinef(angle, &sine, &cosine);
+		return sine;
+	}
+
+	// Arc cosine, within 5e-7 absolute error
+	QM_INTERNAL q_float arccosinef(q_float x)
+	{
+		q_float a = fabsf(x);
+		q_float p = -0.0012624911f;
+		p = p * a + 0.0066700901f;
+		p = p * a - 0.0170881256f;
+		p = p * a + 0.0308918810f;
+		p = p * a - 0.0501743046f;
+		p = p * a + 0.0889789874f;
+		p = p * a - 0.2145988016f;
+		p = p * a + 1.5707963050f;
+
+		q_float result = sqrtf(1.0f - a) * p;
+		return x < 0.0f ? (q_float)Q_PI - result : result;
+	}
+#else
+	// Reciprocal square root function
+	QM_INTERNAL q_float invsqrtf(q_float x)
+	{
+		return 1.0f / sqrtf(x);
+	}
+
+	// Sine and cosine function
+	QM_INTERNAL q_void sinecosinef(q_float angle, q_floatp sine, q_floatp cosine)
+	{
+		*sine = sinf(angle);
+		*cosine = cosf(angle);
+	}
 
-// Zero vector function
-QM_API q_vector2 qmVector2Zero(q_void)
+	// Sine function
+	QM_INTERNAL q_float sinef(q_float angle)
+	{
+		return sinf(angle);
+	}
+
+	// Arc cosine function
+	QM_INTERNAL q_float arccosinef(q_float x)
+	{
+		return acosf(x);
+	}
+#endif /* Q_MATH_FAST */
+
+// Double-precision callers keep libm accuracy under Q_MATH_FAST
+
+// Reciprocal square root function
+QM_INTERNAL q_double invsqrtd(q_double x)
 {
-	q_vector2 result = {0.0f, 0.0f};
-	return result;
+	return 1.0 / sqrt(x);
 }
 
-// One vector function
-QM_API q_vector2 qmVector2One(q_void)
+// Sine and cosine function
+QM_INTERNAL q_void sinecosined(q_double angle, q_doublep sine, q_doublep cosine)
 {
-	q_vector2 result = {1.0f, 1.0f};
-	return result;
+	*sine = sin(angle);
+	*cosine = cos(angle);
 }
 
-// Add function
-QM_API q_vector2 qmVector2Add(q_vector2 left, q_vector2 right)
+// Sine function
+QM_INTERNAL q_double sined(q_double angle)
 {
-	q_vector2 result = {
-		left.x + right.x,
-		left.y + right.y
-	};
-	return result;
+	return sin(angle);
 }
 
-// Scalar add function
-QM_API q_vector2 qmVector2AddScalar(q_vector2 vec, q_float scl)
+// Arc cosine function
+QM_INTERNAL q_double arccosined(q_double x)
 {
-	q_vector2 result = {
-		vec.x + scl,
-		vec.y + scl
-	};
-	return result;
+	return acos(x);
 }
 
-// Subtract function
-QM_API q_vector2 qmVector2Subtract(q_vector2 left, q_vector2 right)
+#if defined(QM_SIMD_DOUBLE)
+	typedef __m256d q_simdd;
+
+	// Swizzle lanes of a double register
+	#define Q_SIMDD_SWIZZLE(v, x, y, z, w) _mm256_permute4x64_pd((v), _MM_SHUFFLE(w, z, y, x))
+
+	// Load vector into double register
+	QM_INTERNAL q_simdd dsimdload(q_vector4d vec)
+	{
+		return _mm256_loadu_pd(&vec.x);
+	}
+
+	// Store double register into vector
+	QM_INTERNAL q_vector4d dsimdstore(q_simdd reg)
+	{
+		q_vector4d result;
+		_mm256_storeu_pd(&result.x, reg);
+		return result;
+	}
+
+	// Set double register lanes
+	QM_INTERNAL q_simdd dsimdset(q_double x, q_double y, q_double z, q_double w)
+	{
+		return _mm256_setr_pd(x, y, z, w);
+	}
+
+	// Broadcast scalar to all double lanes
+	QM_INTERNAL q_simdd dsimdsplat(q_double scl)
+	{
+		return _mm256_set1_pd(scl);
+	}
+
+	// Lane-wise double add
+	QM_INTERNAL q_simdd dsimdadd(q_simdd left, q_simdd right)
+	{
+		return _mm256_add_pd(left, right);
+	}
+
+	// Lane-wise double subtract
+	QM_INTERNAL q_simdd dsimdsub(q_simdd left, q_simdd right)
+	{
+		return _mm256_sub_pd(left, right);
+	}
+
+	// Lane-wise double multiply
+	QM_INTERNAL q_simdd dsimdmul(q_simdd left, q_simdd right)
+	{
+		return _mm256_mul_pd(left, right);
+	}
+
+	// Lane-wise double divide
+	QM_INTERNAL q_simdd dsimddiv(q_simdd left, q_simdd right)
+	{
+		return _mm256_div_pd(left, right);
+	}
+
+	// Horizontal sum of all double lanes
+	QM_INTERNAL q_double dsimdsum(q_simdd reg)
+	{
+		__m128d sums = _mm_add_pd(_mm256_castpd256_pd128(reg), _mm256_extractf128_pd(reg, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(sums, _mm_unpackhi_pd(sums, sums)));
+	}
+
+	// Dot product of all double lanes
+	QM_INTERNAL q_double dsimddot(q_simdd left, q_simdd right)
+	{
+		return dsimdsum(dsimdmul(left, right));
+	}
+#endif /* QM_SIMD_DOUBLE */
+
+//// Functions ////
+
+// Prevent function name mangling
+#ifdef __cplusplus
+extern "C"
 {
-	q_vector2 result = {
-		left.x - right.x,
-		left.y - right.y
-	};
-	return result;
-}
+#endif /* __cplusplus */
+
+//// Float functions ////
 
-// Scalar subtract function
-QM_API q_vector2 qmVector2SubtractScalar(q_vector2 vec, q_float scl)
+#define QMT_REAL q_float
+#define QMT_TYPE(name) q_##name
+#define QMT_FUNCTION(type, name) qm##type##name
+#define QMT_SCALAR_FUNCTION(name) qmFloat##name
+#define QMT_HELPER(name) name##f
+#define QMT_MATH(name) name##f
+#define QMT_EPSILON Q_EPSILON
+#if defined(QM_SIMD)
+	#define QMT_SIMD
+	#define QMT_SIMD_TYPE q_simd
+	#define QMT_SIMD_OP(name) simd##name
+	#define QMT_SWIZZLE Q_SIMD_SWIZZLE
+#endif /* QM_SIMD */
+#include "qmathtemplate.h"
+
+//// Double functions ////
+
+// Same source as the float functions, named with a d after the type and Double for scalars
+#define QMT_REAL q_double
+#define QMT_TYPE(name) q_##name##d
+#define QMT_FUNCTION(type, name) qm##type##d##name
+#define QMT_SCALAR_FUNCTION(name) qmDouble##name
+#define QMT_HELPER(name) name##d
+#define QMT_MATH(name) name
+#define QMT_EPSILON Q_EPSILON_DOUBLE
+#if defined(QM_SIMD_DOUBLE)
+	#define QMT_SIMD
+	#define QMT_SIMD_TYPE q_simdd
+	#define QMT_SIMD_OP(name) dsimd##name
+	#define QMT_SWIZZLE Q_SIMDD_SWIZZLE
+#endif /* QM_SIMD_DOUBLE */
+#include "qmathtemplate.h"
+
+//// Mixed precision functions ////
+
+// Vector2 to double function
+QM_API q_vector2d qmVector2ToVector2d(q_vector2 vec)
+{
+	q_vector2d result = {
+		(q_double)vec.x,
+		(q_double)vec.y
+	};
+	return result;
+}
+
+// Vector2 to float function
+QM_API q_vector2 qmVector2dToVector2(q_vector2d vec)
 {
 	q_vector2 result = {
-		vec.x - scl,
-		vec.y - scl
+		(q_float)vec.x,
+		(q_float)vec.y
 	};
 	return result;
 }
 
-// Multiply function
-QM_API q_vector2 qmVector2Multiply(q_vector2 left, q_vector2 right)
+// Vector3 to double function
+QM_API q_vector3d qmVector3ToVector3d(q_vector3 vec)
 {
-	q_vector2 result = {
-		left.x * right.x,
-		left.y * right.y
+	q_vector3d result = {
+		(q_double)vec.x,
+		(q_double)vec.y,
+		(q_double)vec.z
 	};
 	return result;
 }
 
-// Scale function
-QM_API q_vector2 qmVector2Scale(q_vector2 vec, q_float scl)
+// Vector3 to float function
+QM_API q_vector3 qmVector3dToVector3(q_vector3d vec)
 {
-	q_vector2 result = {
-		vec.x * scl,
-		vec.y * scl
+	q_vector3 result = {
+		(q_float)vec.x,
+		(q_float)vec.y,
+		(q_float)vec.z
 	};
 	return result;
 }
 
-// Negate function
-QM_API q_vector2 qmVector2Negate(q_vector2 vec)
+// Vector4 to double function
+QM_API q_vector4d qmVector4ToVector4d(q_vector4 vec)
 {
-	q_vector2 result = {
-		-vec.x,
-		-vec.y
+	q_vector4d result = {
+		(q_double)vec.x,
+		(q_double)vec.y,
+		(q_double)vec.z,
+		(q_double)vec.w
 	};
 	return result;
 }
 
-// Divide function
-QM_API q_vector2 qmVector2Divide(q_vector2 left, q_vector2 right)
+// Vector4 to float function
+QM_API q_vector4 qmVector4dToVector4(q_vector4d vec)
 {
-	q_vector2 result = {
-		left.x / right.x,
-		left.y / right.y
+	q_vector4 result = {
+		(q_float)vec.x,
+		(q_float)vec.y,
+		(q_float)vec.z,
+		(q_float)vec.w
 	};
 	return result;
 }
 
-// Scalar divide function
-QM_API q_vector2 qmVector2DivideScalar(q_vector2 vec, q_float scl)
+// Quaternion to double function
+QM_API q_quaterniond qmQuaternionToQuaterniond(q_quaternion vec)
 {
-	q_vector2 result = {
-		vec.x / scl,
-		vec.y / scl
+	q_quaterniond result = {
+		(q_double)vec.x,
+		(q_double)vec.y,
+		(q_double)vec.z,
+		(q_double)vec.w
 	};
 	return result;
 }
 
-// Normalize function
-QM_API q_vector2 qmVector2Normalize(q_vector2 vec)
+// Quaternion to float function
+QM_API q_quaternion qmQuaterniondToQuaternion(q_quaterniond vec)
 {
-	q_float length = sqrtf(sqf(vec.x) + sqf(vec.y)); // qmVector2Length(vec)
-	if (length == 0.0f)
-	{
-		return vec;
-	}
-
-	q_vector2 result = { // qmVector2DivideScale(vec, length)
-		vec.x / length,
-		vec.y / length
+	q_quaternion result = {
+		(q_float)vec.x,
+		(q_float)vec.y,
+		(q_float)vec.z,
+		(q_float)vec.w
 	};
 	return result;
 }
 
-// Invert function
-QM_API q_vector2 qmVector2Invert(q_vector2 vec)
+// Matrix44 to double function
+QM_API q_matrix44d qmMatrix44ToMatrix44d(q_matrix44 mat)
 {
-	q_vector2 result = {
-		1.0f / vec.x,
-		1.0f / vec.y
+	q_matrix44d result = {
+		(q_double)mat.m0, (q_double)mat.m4, (q_double)mat.m8, (q_double)mat.m12,
+		(q_double)mat.m1, (q_double)mat.m5, (q_double)mat.m9, (q_double)mat.m13,
+		(q_double)mat.m2, (q_double)mat.m6, (q_double)mat.m10, (q_double)mat.m14,
+		(q_double)mat.m3, (q_double)mat.m7, (q_double)mat.m11, (q_double)mat.m15
 	};
 	return result;
 }
 
-// Minimum function
-QM_API q_vector2 qmVector2Min(q_vector2 left, q_vector2 right)
+// Matrix44 to float function
+QM_API q_matrix44 qmMatrix44dToMatrix44(q_matrix44d mat)
 {
-	q_vector2 result = {
-		fminf(left.x, right.x),
-		fminf(left.y, right.y)
+	q_matrix44 result = {
+		(q_float)mat.m0, (q_float)mat.m4, (q_float)mat.m8, (q_float)mat.m12,
+		(q_float)mat.m1, (q_float)mat.m5, (q_float)mat.m9, (q_float)mat.m13,
+		(q_float)mat.m2, (q_float)mat.m6, (q_float)mat.m10, (q_float)mat.m14,
+		(q_float)mat.m3, (q_float)mat.m7, (q_float)mat.m11, (q_float)mat.m15
 	};
 	return result;
 }
 
-// Maximum function
-QM_API q_vector2 qmVector2Max(q_vector2 left, q_vector2 right)
+// Add float offset to double position function
+QM_API q_vector3d qmVector3dAddVector3(q_vector3d vec, q_vector3 offset)
 {
-	q_vector2 result = {
-		fmaxf(left.x, right.x),
-		fmaxf(left.y, right.y)
+	q_vector3d result = {
+		vec.x + offset.x,
+		vec.y + offset.y,
+		vec.z + offset.z
 	};
 	return result;
 }
 
-// Clamp function
-QM_API q_vector2 qmVector2Clamp(q_vector2 vec, q_vector2 min, q_vector2 max)
+// Subtract double positions into float offset function, rounding only the difference
+QM_API q_vector3 qmVector3dSubtractToVector3(q_vector3d left, q_vector3d right)
 {
-	q_vector2 result = {
-		max.x < min.x ? vec.x : fminf(fmaxf(vec.x, min.x), max.x), // qmFloatClamp(vec.x, min.x, max.x)
-		max.y < min.y ? vec.y : fminf(fmaxf(vec.y, min.y), max.y)  // qmFloatClamp(vec.y, min.y, max.y)
+	q_vector3 result = {
+		(q_float)(left.x - right.x),
+		(q_float)(left.y - right.y),
+		(q_float)(left.z - right.z)
 	};
 	return result;
 }
 
-// Clamp on vector magnitude function
-QM_API q_vector2 qmVector2ClampMag(q_vector2 vec, q_float min, q_float max)
+// Float matrix with translation relative to a double origin, such as the camera position
+QM_API q_matrix44 qmMatrix44dRelative(q_matrix44d mat, q_vector3d origin)
 {
-	if (max < min)
-	{
-		return vec;
-	}
-
-	q_float length = sqrtf(sqf(vec.x) + sqf(vec.y)); // qmVector2Length(vec)
-	if (length == 0.0f)
-	{
-		return vec;
-	}
-
-	q_float scl = 1.0f;
-	if (length < min)
-	{
-		scl = min / length;
-	}
-	if (length > max)
-	{
-		scl = max / length;
-	}
+	mat.m12 -= origin.x;
+	mat.m13 -= origin.y;
+	mat.m14 -= origin.z;
 
-	q_vector2 result = { // qmVector2Scale(vec, scl)
-		vec.x * scl,
-		vec.y * scl
+	q_matrix44 result = { // qmMatrix44dToMatrix44(mat)
+		(q_float)mat.m0, (q_float)mat.m4, (q_float)mat.m8, (q_float)mat.m12,
+		(q_float)mat.m1, (q_float)mat.m5, (q_float)mat.m9, (q_float)mat.m13,
+		(q_float)mat.m2, (q_float)mat.m6, (q_float)mat.m10, (q_float)mat.m14,
+		(q_float)mat.m3, (q_float)mat.m7, (q_float)mat.m11, (q_float)mat.m15
 	};
 	return result;
 }
 
-// Linear interpolation function
-QM_API q_vector2 qmVector2Lerp(q_float value, q_vector2 start, q_vector2 end)
-{
-	q_vector2 result = {
-		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
-		start.y + value * (end.y - start.y)  // qmFloatLerp(value, start.y, end.y)
-	};
-	return result;
-}
+//// Float batch functions ////
 
-// Reflection function
-QM_API q_vector2 qmVector2Reflect(q_vector2 vec, q_vector2 normal)
-{
-	q_float dot = vec.x * normal.x + vec.y * normal.y; // qmVector2DotProduct(vec, normal)
+// Sine and cosine of count angles, with the error bound of qmFloatSinCos under Q_MATH_FAST
+// up to 8192 radians whether or not it is defined. Outputs may alias the angles exactly.
+Q_API q_void qmFloatBatchSinCos(q_floatp sine, q_floatp cosine, const q_float *angle, q_uint count);
 
-	q_vector2 result = {
-		vec.x - normal.x * 2.0f * dot,
-		vec.y - normal.y * 2.0f * dot
-	};
-	return result;
-}
+//// Vector3 batch functions ////
 
-// Refraction function
-QM_API q_vector2 qmVector2Refract(q_vector2 vec, q_vector2 normal, q_float index)
-{
-	q_float dot = vec.x * normal.x + vec.y * normal.y; // qmVector2DotProduct(vec, normal)
-	q_float diff = 1.0f - sqf(index) * (1.0f - sqf(dot));
-	if (diff < 0)
-	{
-		return vec;
-	}
+// Batch functions are compiled into the library and process the count of the result batch,
+// or of the first input batch for scalar results. A result may alias an input exactly,
+// but must not partially overlap it.
+Q_API q_void qmVector3BatchAdd(q_vector3_batch result, q_vector3_batch left, q_vector3_batch right);
+Q_API q_void qmVector3BatchScale(q_vector3_batch result, q_vector3_batch vec, q_float scl);
+Q_API q_void qmVector3BatchNormalize(q_vector3_batch result, q_vector3_batch vec);
+Q_API q_void qmVector3BatchLerp(q_vector3_batch result, q_float value, q_vector3_batch start, q_vector3_batch end);
+Q_API q_void qmVector3BatchCrossProduct(q_vector3_batch result, q_vector3_batch left, q_vector3_batch right);
+Q_API q_void qmVector3BatchTransform(q_vector3_batch result, q_vector3_batch vec, q_matrix44 mat);
+Q_API q_void qmVector3BatchRotate(q_vector3_batch result, q_vector3_batch vec, q_quaternion quat);
+Q_API q_void qmVector3BatchLength(q_floatp result, q_vector3_batch vec);
+Q_API q_void qmVector3BatchDotProduct(q_floatp result, q_vector3_batch left, q_vector3_batch right);
 
-	q_vector2 result = {
-		vec.x * index - normal.x * (dot * index + sqrtf(diff)),
-		vec.y * index - normal.y * (dot * index + sqrtf(diff))
-	};
-	return result;
-}
+//// Matrix44 array functions ////
 
-// Move function
-QM_API q_vector2 qmVector2Move(q_vector2 vec, q_vector2 target, q_float dist)
-{
-	if (dist <= 0.0f)
-	{
-		return vec;
-	}
-
-	q_float cdist = sqrtf(sqf(target.x - vec.x) + sqf(target.y - vec.y)); // qmVector2Distance(target, vec)
-	if (cdist > dist)
-	{
-		return vec;
-	}
-
-	q_vector2 result = {
-		vec.x + dist / cdist * (target.x - vec.x),
-		vec.y + dist / cdist * (target.y - vec.y)
-	};
-	return result;
-}
-
-// Rotate function
-QM_API q_vector2 qmVector2Rotate(q_vector2 vec, q_float angle)
-{
-	q_float sin = sinf(angle);
-	q_float cos = cosf(angle);
-
-	q_vector2 result = {
-		vec.x * cos - vec.y * sin,
-		vec.x * sin + vec.y * cos
-	};
-	return result;
-}
-
-// Length function
-QM_API q_float qmVector2Length(q_vector2 vec)
-{
-	return sqrtf(sqf(vec.x) + sqf(vec.y));
-}
-
-// Squared length function
-QM_API q_float qmVector2LengthSq(q_vector2 vec)
-{
-	return sqf(vec.x) + sqf(vec.y);
-}
-
-// Dot product function
-QM_API q_float qmVector2DotProduct(q_vector2 left, q_vector2 right)
-{
-	return left.x * right.x + left.y * right.y;
-}
-
-// Distance function
-QM_API q_float qmVector2Distance(q_vector2 left, q_vector2 right)
-{
-	return sqrtf(sqf(left.x - right.x) + sqf(left.y - right.y));
-}
-
-// Squared distance function
-QM_API q_float qmVector2DistanceSq(q_vector2 left, q_vector2 right)
-{
-	return sqf(left.x - right.x) + sqf(left.y - right.y);
-}
-
-// Angle function
-QM_API q_float qmVector2Angle(q_vector2 left, q_vector2 right)
-{
-	q_float det = left.x * right.y - left.y * right.x;
-	q_float dot = left.x * right.x + left.y * right.y; // qmVector2DotProduct(left, right)
-	return atan2f(det, dot);
-}
-
-// Line angle function
-QM_API q_float qmVector2LineAngle(q_vector2 start, q_vector2 end)
-{
-	return -atan2f(end.y - start.y, end.x - start.x);
-}
-
-// Equal function
-QM_API q_bool qmVector2Equal(q_vector2 left, q_vector2 right)
-{
-	return Q_BOOL(
-		equalf(left.x, right.x) &&
-		equalf(left.y, right.y)
-	);
-}
-
-//// Vector3 functions ////
-
-// Zero vector function
-QM_API q_vector3 qmVector3Zero(q_void)
-{
-	q_vector3 result = {0.0f, 0.0f, 0.0f};
-	return result;
-}
-
-// One vector function
-QM_API q_vector3 qmVector3One(q_void)
-{
-	q_vector3 result = {1.0f, 1.0f, 1.0f};
-	return result;
-}
-
-// Add function
-QM_API q_vector3 qmVector3Add(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		left.x + right.x,
-		left.y + right.y,
-		left.z + right.z
-	};
-	return result;
-}
-
-// Scalar add function
-QM_API q_vector3 qmVector3AddScalar(q_vector3 vec, q_float scl)
-{
-	q_vector3 result = {
-		vec.x + scl,
-		vec.y + scl,
-		vec.z + scl
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_vector3 qmVector3Subtract(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		left.x - right.x,
-		left.y - right.y,
-		left.z - right.z
-	};
-	return result;
-}
-
-// Scalar subtract function
-QM_API q_vector3 qmVector3SubtractScalar(q_vector3 vec, q_float scl)
-{
-	q_vector3 result = {
-		vec.x - scl,
-		vec.y - scl,
-		vec.z - scl
-	};
-	return result;
-}
-
-// Multiply function
-QM_API q_vector3 qmVector3Multiply(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		left.x * right.x,
-		left.y * right.y,
-		left.z * right.z
-	};
-	return result;
-}
-
-// Scale function
-QM_API q_vector3 qmVector3Scale(q_vector3 vec, q_float scl)
-{
-	q_vector3 result = {
-		vec.x * scl,
-		vec.y * scl,
-		vec.z * scl
-	};
-	return result;
-}
-
-// Negate function
-QM_API q_vector3 qmVector3Negate(q_vector3 vec)
-{
-	q_vector3 result = {
-		-vec.x,
-		-vec.y,
-		-vec.z
-	};
-	return result;
-}
-
-// Divide function
-QM_API q_vector3 qmVector3Divide(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		left.x / right.x,
-		left.y / right.y,
-		left.z / right.z
-	};
-	return result;
-}
-
-// Scalar divide function
-QM_API q_vector3 qmVector3DivideScalar(q_vector3 vec, q_float scl)
-{
-	q_vector3 result = {
-		vec.x / scl,
-		vec.y / scl,
-		vec.z / scl
-	};
-	return result;
-}
-
-// Normalize function
-QM_API q_vector3 qmVector3Normalize(q_vector3 vec)
-{
-	q_float length = sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z)); // qmVector3Length(vec)
-	if (length == 0.0f)
-	{
-		return vec;
-	}
-
-	q_vector3 result = { // qmVector3DivideScale(vec, length)
-		vec.x / length,
-		vec.y / length,
-		vec.z / length
-	};
-	return result;
-}
-
-// Orthonormalize function
-QM_API q_void qmVector3Orthonormalize(q_vector3 *left, q_vector3 *right)
-{
-	q_vector3 vec = *left;
-	q_float len = sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z)); // qmVector3Length(vec)
-	if (len > 0.0f) // qmVector3DivideScale(left, len)
-	{
-		left->x /= len;
-		left->y /= len;
-		left->z /= len;
-	}
-
-	q_vector3 lcross = { // qmVector3CrossProduct(left, right)
-		left->y * right->z - left->z * right->y,
-		left->z * right->x - left->x * right->z,
-		left->x * right->y - left->y * right->x
-	};
-	vec = lcross;
-	len = sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z)); // qmVector3Length(vec)
-	if (len > 0.0f) // qmVector3DivideScale(lcross, len)
-	{
-		lcross.x /= len;
-		lcross.y /= len;
-		lcross.z /= len;
-	}
-
-	q_vector3 rcross = { // qmVector3CrossProduct(lcross, left)
-		lcross.y * left->z - lcross.z * left->y,
-		lcross.z * left->x - lcross.x * left->z,
-		lcross.x * left->y - lcross.y * left->x
-	};
-	*right = rcross;
-}
-
-// Invert function
-QM_API q_vector3 qmVector3Invert(q_vector3 vec)
-{
-	q_vector3 result = {
-		1.0f / vec.x,
-		1.0f / vec.y,
-		1.0f / vec.z
-	};
-	return result;
-}
-
-// Minimum function
-QM_API q_vector3 qmVector3Min(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		fminf(left.x, right.x),
-		fminf(left.y, right.y),
-		fminf(left.z, right.z)
-	};
-	return result;
-}
-
-// Maximum function
-QM_API q_vector3 qmVector3Max(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		fmaxf(left.x, right.x),
-		fmaxf(left.y, right.y),
-		fmaxf(left.z, right.z)
-	};
-	return result;
-}
-
-// Clamp function
-QM_API q_vector3 qmVector3Clamp(q_vector3 vec, q_vector3 min, q_vector3 max)
-{
-	q_vector3 result = {
-		max.x < min.x ? vec.x : fminf(fmaxf(vec.x, min.x), max.x), // qmFloatClamp(vec.x, min.x, max.x)
-		max.y < min.y ? vec.y : fminf(fmaxf(vec.y, min.y), max.y), // qmFloatClamp(vec.y, min.y, max.y)
-		max.z < min.z ? vec.z : fminf(fmaxf(vec.z, min.z), max.z)  // qmFloatClamp(vec.z, min.z, max.z)
-	};
-	return result;
-}
-
-// Clamp on vector magnitude function
-QM_API q_vector3 qmVector3ClampMag(q_vector3 vec, q_float min, q_float max)
-{
-	if (max < min)
-	{
-		return vec;
-	}
-
-	q_float length = sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z)); // qmVector3Length(vec)
-	if (length <= 0.0f)
-	{
-		return vec;
-	}
-
-	q_float scl = 1.0f;
-	if (length < min)
-	{
-		scl = min / length;
-	}
-	if (length > max)
-	{
-		scl = max / length;
-	}
-
-	q_vector3 result = { // qmVector3Scale(vec, scl)
-		vec.x * scl,
-		vec.y * scl,
-		vec.z * scl
-	};
-	return result;
-}
-
-// Linear interpolation function
-QM_API q_vector3 qmVector3Lerp(q_float value, q_vector3 start, q_vector3 end)
-{
-	q_vector3 result = {
-		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
-		start.y + value * (end.y - start.y), // qmFloatLerp(value, start.y, end.y)
-		start.z + value * (end.z - start.z)  // qmFloatLerp(value, start.z, end.z)
-	};
-	return result;
-}
-
-// Cubic hermite interpolation function
-QM_API q_vector3 qmVector3CubicHermite(q_float value, q_vector3 left, q_vector3 ltan, q_vector3 right, q_vector3 rtan)
-{
-	q_float p0 = cbf(value) * 2.0f - sqf(value) * 3.0f + 1.0f;
-	q_float p1 = cbf(value) - sqf(value) * 2.0f + value;
-	q_float p2 = cbf(value) * -2.0f + sqf(value) * 3.0f;
-	q_float p3 = cbf(value) - sqf(value);
-
-	q_vector3 result = {
-		p0 * left.x + p1 * ltan.x + p2 * right.x + p3 * rtan.x,
-		p0 * left.y + p1 * ltan.y + p2 * right.y + p3 * rtan.y,
-		p0 * left.z + p1 * ltan.z + p2 * right.z + p3 * rtan.z,
-	};
-	return result;
-}
-
-// Cross product function
-QM_API q_vector3 qmVector3CrossProduct(q_vector3 left, q_vector3 right)
-{
-	q_vector3 result = {
-		left.y * right.z - left.z * right.y,
-		left.z * right.x - left.x * right.z,
-		left.x * right.y - left.y * right.x
-	};
-	return result;
-}
-
-// Perpendicular function
-QM_API q_vector3 qmVector3Perpendicular(q_vector3 vec)
-{
-	q_float min = fabsf(vec.x);
-	q_vector3 axis = {1.0f, 0.0f, 0.0f};
-	if (fabsf(vec.y) < min)
-	{
-		q_vector3 a = {0.0f, 1.0f, 0.0f};
-		min = fabsf(vec.y);
-		axis = a;
-	}
-	if (fabsf(vec.z) < min)
-	{
-		q_vector3 a = {0.0f, 0.0f, 1.0f};
-		axis = a;
-	}
-
-	q_vector3 result = { // qmVector3CrossProduct(vec, axis)
-		vec.y * axis.z - vec.z * axis.y,
-		vec.z * axis.x - vec.x * axis.z,
-		vec.x * axis.y - vec.y * axis.x
-	};
-	return result;
-}
-
-// Barycenter function
-QM_API q_vector3 qmVector3Barycenter(q_vector3 plane, q_vector3 v1, q_vector3 v2, q_vector3 v3)
-{
-	q_vector3 s1 = { // qmVector3Subtract(v2, v1)
-		v2.x - v1.x,
-		v2.y - v1.y,
-		v2.z - v1.z
-	};
-	q_vector3 s2 = { // qmVector3Subtract(v3, v1)
-		v3.x - v1.x,
-		v3.y - v1.y,
-		v3.z - v1.z
-	};
-	q_vector3 s3 = { // qmVector3Subtract(plane, v1)
-		plane.x - v1.x,
-		plane.y - v1.y,
-		plane.z - v1.z
-	};
-
-	q_float fs1 = sqf(s1.x) + sqf(s1.y) + sqf(s1.z);       // qmVector3DistanceSq(s1)
-	q_float fs2 = sqf(s2.x) + sqf(s2.y) + sqf(s2.z);       // qmVector3DistanceSq(s2)
-	q_float dot = s1.x * s2.x + s1.y * s2.y + s1.z * s2.z; // qmVector3DotProduct(s1, s2)
-	q_float dp1 = s1.x * s3.x + s1.y * s3.y + s1.z * s3.z; // qmVector3DotProduct(s1, s3)
-	q_float dp2 = s2.x * s3.x + s2.y * s3.y + s2.z * s3.z; // qmVector3DotProduct(s2, s3)
-
-	q_float y = (fs2 * dp1 - dot * dp2) / (fs1 * fs2 - sqf(dot));
-	q_float z = (fs1 * dp2 - dot * dp1) / (fs1 * fs2 - sqf(dot));
-	q_vector3 result = {
-		1.0f - y - z,
-		y,
-		z
-	};
-	return result;
-}
-
-// Reflection function
-QM_API q_vector3 qmVector3Reflect(q_vector3 vec, q_vector3 normal)
-{
-	q_float dot = vec.x * normal.x + vec.y * normal.y + vec.z * normal.z; // qmVector3DotProduct(vec, normal)
-
-	q_vector3 result = {
-		vec.x - normal.x * 2.0f * dot,
-		vec.y - normal.y * 2.0f * dot,
-		vec.z - normal.z * 2.0f * dot
-	};
-	return result;
-}
-
-// Refraction function
-QM_API q_vector3 qmVector3Refract(q_vector3 vec, q_vector3 normal, q_float index)
-{
-	q_float dot = vec.x * normal.x + vec.y * normal.y + vec.z * normal.z; // qmVector3DotProduct(vec, normal)
-	q_float diff = 1.0f - sqf(index) * (1.0f - sqf(dot));
-	if (diff < 0)
-	{
-		return vec;
-	}
-
-	q_vector3 result = {
-		vec.x * index - normal.x * (dot * index + sqrtf(diff)),
-		vec.y * index - normal.y * (dot * index + sqrtf(diff)),
-		vec.z * index - normal.z * (dot * index + sqrtf(diff))
-	};
-	return result;
-}
-
-// Projection function
-QM_API q_vector3 qmVector3Project(q_vector3 vec, q_vector3 target)
-{
-	q_float dot = vec.x * target.x + vec.y * target.y + vec.z * target.z; // qmVector3DotProduct(vec, target)
-	q_float len = sqf(target.x) + sqf(target.y) + sqf(target.z);          // qmVector3LengthSq(target)
-	q_float mag = dot / len;
-
-	q_vector3 result = { // qmVector3Scale(target, mag)
-		target.x * mag,
-		target.y * mag,
-		target.z * mag
-	};
-	return result;
-}
-
-// Rejection function
-QM_API q_vector3 qmVector3Reject(q_vector3 vec, q_vector3 target)
-{
-	q_float dot = vec.x * target.x + vec.y * target.y + vec.z * target.z; // qmVector3DotProduct(vec, target)
-	q_float len = sqf(target.x) + sqf(target.y) + sqf(target.z);          // qmVector3LengthSq(target)
-	q_float mag = dot / len;
-
-	q_vector3 result = { // qmVector3Subtract(vec, qmVector3Scale(target, mag))
-		vec.x - target.x * mag,
-		vec.y - target.y * mag,
-		vec.z - target.z * mag
-	};
-	return result;
-}
-
-// Rotate by axis function
-QM_API q_vector3 qmVector3RotateByAxis(q_vector3 vec, q_vector3 axis, q_float angle)
-{
-	q_float alen = sqrtf(sqf(axis.x) + sqf(axis.y) + sqf(axis.z)); // qmVector3Length(axis)
-	if (alen > 0.0f) // qmVector3DivideScalar(axis, alen)
-	{
-		axis.x /= alen;
-		axis.y /= alen;
-		axis.z /= alen;
-	}
-
-	angle /= 2.0f;
-	q_float a = sinf(angle);
-	q_vector3 w = { // qmVector3Scale(axis, a)
-		axis.x * a,
-		axis.y * a,
-		axis.z * a
-	};
-	a = cosf(angle);
-
-	q_vector3 cross = { // qmVector3CrossProduct(w, vec)
-		w.y * vec.z - w.z * vec.y,
-		w.z * vec.x - w.x * vec.z,
-		w.x * vec.y - w.y * vec.x
-	};
-	q_vector3 dcross = { // qmVector3CrossProduct(w, cross)
-		w.y * cross.z - w.z * cross.y,
-		w.z * cross.x - w.x * cross.z,
-		w.x * cross.y - w.y * cross.x
-	};
-
-	q_vector3 result = {
-		cross.x * 2.0f * a + dcross.x * 2.0f,
-		cross.y * 2.0f * a + dcross.y * 2.0f,
-		cross.z * 2.0f * a + dcross.z * 2.0f
-	};
-	return result;
-}
-
-// Move function
-QM_API q_vector3 qmVector3Move(q_vector3 vec, q_vector3 target, q_float dist)
-{
-	if (dist <= 0.0f)
-	{
-		return vec;
-	}
-
-	q_float cdist = sqrtf(sqf(target.x - vec.x) + sqf(target.y - vec.y) + sqf(target.z - vec.z)); // qmVector3Distance(target, vec)
-	if (cdist > dist)
-	{
-		return vec;
-	}
-
-	q_vector3 result = {
-		vec.x + dist / cdist * (target.x - vec.x),
-		vec.y + dist / cdist * (target.y - vec.y),
-		vec.z + dist / cdist * (target.z - vec.z)
-	};
-	return result;
-}
-
-// Length function
-QM_API q_float qmVector3Length(q_vector3 vec)
-{
-	return sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z));
-}
-
-// Squared length function
-QM_API q_float qmVector3LengthSq(q_vector3 vec)
-{
-	return sqf(vec.x) + sqf(vec.y) + sqf(vec.z);
-}
-
-// Dot product function
-QM_API q_float qmVector3DotProduct(q_vector3 left, q_vector3 right)
-{
-	return left.x * right.x + left.y * right.y + left.z * right.z;
-}
-
-// Distance function
-QM_API q_float qmVector3Distance(q_vector3 left, q_vector3 right)
-{
-	return sqrtf(sqf(left.x - right.x) + sqf(left.y - right.y) + sqf(left.z - right.z));
-}
-
-// Squared distance function
-QM_API q_float qmVector3DistanceSq(q_vector3 left, q_vector3 right)
-{
-	return sqf(left.x - right.x) + sqf(left.y - right.y) + sqf(left.z - right.z);
-}
-
-// Angle function
-QM_API q_float qmVector3Angle(q_vector3 left, q_vector3 right)
-{
-	q_vector3 cross = { // qmVector3CrossProduct(left, right)
-		left.y * right.z - left.z * right.y,
-		left.z * right.x - left.x * right.z,
-		left.x * right.y - left.y * right.x
-	};
-
-	q_float len = sqrtf(sqf(cross.x) + sqf(cross.y) + sqf(cross.z));      // qmVector3Length(cross)
-	q_float dot = left.x * right.x + left.y * right.y + left.z * right.z; // qmVector3DotProduct(left, right)
-	return atan2f(len, dot);
-}
-
-// Equal function
-QM_API q_bool qmVector3Equal(q_vector3 left, q_vector3 right)
-{
-	return Q_BOOL(
-		equalf(left.x, right.x) &&
-		equalf(left.y, right.y) &&
-		equalf(left.z, right.z)
-	);
-}
-
-//// Vector4 functions ////
-
-// Zero vector function
-QM_API q_vector4 qmVector4Zero(q_void)
-{
-	q_vector4 result = {0.0f, 0.0f, 0.0f, 0.0f};
-	return result;
-}
-
-// One vector function
-QM_API q_vector4 qmVector4One(q_void)
-{
-	q_vector4 result = {1.0f, 1.0f, 1.0f, 1.0f};
-	return result;
-}
-
-// Add function
-QM_API q_vector4 qmVector4Add(q_vector4 left, q_vector4 right)
-{
-	q_vector4 result = {
-		left.x + right.x,
-		left.y + right.y,
-		left.z + right.z,
-		left.w + right.w
-	};
-	return result;
-}
-
-// Scalar add function
-QM_API q_vector4 qmVector4AddScalar(q_vector4 vec, q_float scl)
-{
-	q_vector4 result = {
-		vec.x + scl,
-		vec.y + scl,
-		vec.z + scl,
-		vec.w + scl
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_vector4 qmVector4Subtract(q_vector4 left, q_vector4 right)
-{
-	q_vector4 result = {
-		left.x - right.x,
-		left.y - right.y,
-		left.z - right.z,
-		left.w - right.w
-	};
-	return result;
-}
-
-// Scalar subtract function
-QM_API q_vector4 qmVector4SubtractScalar(q_vector4 vec, q_float scl)
-{
-	q_vector4 result = {
-		vec.x - scl,
-		vec.y - scl,
-		vec.z - scl,
-		vec.w - scl
-	};
-	return result;
-}
-
-// Multiply function
-QM_API q_vector4 qmVector4Multiply(q_vector4 left, q_vector4 right)
-{
-	q_vector4 result = {
-		left.x * right.x,
-		left.y * right.y,
-		left.z * right.z,
-		left.w * right.w
-	};
-	return result;
-}
-
-// Scale function
-QM_API q_vector4 qmVector4Scale(q_vector4 vec, q_float scl)
-{
-	q_vector4 result = {
-		vec.x * scl,
-		vec.y * scl,
-		vec.z * scl,
-		vec.w * scl
-	};
-	return result;
-}
-
-// Negate function
-QM_API q_vector4 qmVector4Negate(q_vector4 vec)
-{
-	q_vector4 result = {
-		-vec.x,
-		-vec.y,
-		-vec.z,
-		-vec.w
-	};
-	return result;
-}
-
-// Divide function
-QM_API q_vector4 qmVector4Divide(q_vector4 left, q_vector4 right)
-{
-	q_vector4 result = {
-		left.x / right.x,
-		left.y / right.y,
-		left.z / right.z,
-		left.w / right.w
-	};
-	return result;
-}
-
-// Scalar divide function
-QM_API q_vector4 qmVector4DivideScalar(q_vector4 vec, q_float scl)
-{
-	q_vector4 result = {
-		vec.x / scl,
-		vec.y / scl,
-		vec.z / scl,
-		vec.w / scl
-	};
-	return result;
-}
-
-// Normalize function
-QM_API q_vector4 qmVector4Normalize(q_vector4 vec)
-{
-	q_float length = sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z) + sqf(vec.w)); // qmVector4Length(vec)
-	if (length == 0.0f)
-	{
-		return vec;
-	}
-
-	q_vector4 result = { // qmVector4DivideScale(vec, length)
-		vec.x / length,
-		vec.y / length,
-		vec.z / length,
-		vec.w / length
-	};
-	return result;
-}
-
-// Invert function
-QM_API q_vector4 qmVector4Invert(q_vector4 vec)
-{
-	q_vector4 result = {
-		1.0f / vec.x,
-		1.0f / vec.y,
-		1.0f / vec.z,
-		1.0f / vec.w
-	};
-	return result;
-}
-
-// Minimum function
-QM_API q_vector4 qmVector4Min(q_vector4 left, q_vector4 right)
-{
-	q_vector4 result = {
-		fminf(left.x, right.x),
-		fminf(left.y, right.y),
-		fminf(left.z, right.z),
-		fminf(left.w, right.w)
-	};
-	return result;
-}
-
-// Maximum function
-QM_API q_vector4 qmVector4Max(q_vector4 left, q_vector4 right)
-{
-	q_vector4 result = {
-		fmaxf(left.x, right.x),
-		fmaxf(left.y, right.y),
-		fmaxf(left.z, right.z),
-		fmaxf(left.w, right.w)
-	};
-	return result;
-}
-
-// Clamp function
-QM_API q_vector4 qmVector4Clamp(q_vector4 vec, q_vector4 min, q_vector4 max)
-{
-	q_vector4 result = {
-		max.x < min.x ? vec.x : fminf(fmaxf(vec.x, min.x), max.x), // qmFloatClamp(vec.x, min.x, max.x)
-		max.y < min.y ? vec.y : fminf(fmaxf(vec.y, min.y), max.y), // qmFloatClamp(vec.y, min.y, max.y)
-		max.z < min.z ? vec.z : fminf(fmaxf(vec.z, min.z), max.z), // qmFloatClamp(vec.z, min.z, max.z)
-		max.w < min.w ? vec.w : fminf(fmaxf(vec.w, min.w), max.w)  // qmFloatClamp(vec.w, min.w, max.w)
-	};
-	return result;
-}
-
-// Linear interpolation function
-QM_API q_vector4 qmVector4Lerp(q_float value, q_vector4 start, q_vector4 end)
-{
-	q_vector4 result = {
-		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
-		start.y + value * (end.y - start.y), // qmFloatLerp(value, start.y, end.y)
-		start.z + value * (end.z - start.z), // qmFloatLerp(value, start.z, end.z)
-		start.w + value * (end.w - start.w)  // qmFloatLerp(value, start.w, end.w)
-	};
-	return result;
-}
-
-// Move function
-QM_API q_vector4 qmVector4Move(q_vector4 vec, q_vector4 target, q_float dist)
-{
-	if (dist <= 0.0f)
-	{
-		return vec;
-	}
-
-	q_float cdist = sqrtf(sqf(target.x - vec.x) + sqf(target.y - vec.y) + sqf(target.z - vec.z) + sqf(target.w - vec.w)); // qmVector4Distance(target, vec)
-	if (cdist > dist)
-	{
-		return vec;
-	}
-
-	q_vector4 result = {
-		vec.x + dist / cdist * (target.x - vec.x),
-		vec.y + dist / cdist * (target.y - vec.y),
-		vec.z + dist / cdist * (target.z - vec.z),
-		vec.w + dist / cdist * (target.w - vec.w)
-	};
-	return result;
-}
-
-// Length function
-QM_API q_float qmVector4Length(q_vector4 vec)
-{
-	return sqrtf(sqf(vec.x) + sqf(vec.y) + sqf(vec.z) + sqf(vec.w));
-}
-
-// Squared length function
-QM_API q_float qmVector4LengthSq(q_vector4 vec)
-{
-	return sqf(vec.x) + sqf(vec.y) + sqf(vec.z) + sqf(vec.w);
-}
-
-// Dot product function
-QM_API q_float qmVector4DotProduct(q_vector4 left, q_vector4 right)
-{
-	return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
-}
-
-// Distance function
-QM_API q_float qmVector4Distance(q_vector4 left, q_vector4 right)
-{
-	return sqrtf(sqf(left.x - right.x) + sqf(left.y - right.y) + sqf(left.z - right.z) + sqf(left.w - right.w));
-}
-
-// Squared distance function
-QM_API q_float qmVector4DistanceSq(q_vector4 left, q_vector4 right)
-{
-	return sqf(left.x - right.x) + sqf(left.y - right.y) + sqf(left.z - right.z) + sqf(left.w - right.w);
-}
-
-// Equal function
-QM_API q_bool qmVector4Equal(q_vector4 left, q_vector4 right)
-{
-	return Q_BOOL(
-		equalf(left.x, right.x) &&
-		equalf(left.y, right.y) &&
-		equalf(left.z, right.z) &&
-		equalf(left.w, right.w)
-	);
-}
-
-//// Matrix22 functions ////
-
-// Zero matrix function
-QM_API q_matrix22 qmMatrix22Zero(q_void)
-{
-	q_matrix22 result = {
-		0.0f, 0.0f,
-		0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix22 qmMatrix22One(q_void)
-{
-	q_matrix22 result = {
-		1.0f, 1.0f,
-		1.0f, 1.0f
-	};
-	return result;
-}
-
-// Identity matrix function
-QM_API q_matrix22 qmMatrix22Identity(q_void)
-{
-	q_matrix22 result = {
-		1.0f, 0.0f,
-		0.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix22 qmMatrix22Add(q_matrix22 left, q_matrix22 right)
-{
-	q_matrix22 result = {
-		left.m0 + right.m0, left.m2 + right.m2,
-		left.m1 + right.m1, left.m3 + right.m3
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix22 qmMatrix22Subtract(q_matrix22 left, q_matrix22 right)
-{
-	q_matrix22 result = {
-		left.m0 - right.m0, left.m2 - right.m2,
-		left.m1 - right.m1, left.m3 - right.m3
-	};
-	return result;
-}
-
-// Multiply Vector2 function
-QM_API q_vector2 qmMatrix22MultiplyVector2(q_matrix22 mat, q_vector2 vec)
-{
-	q_vector2 result = {
-		mat.m0 * vec.x + mat.m2 * vec.y,
-		mat.m1 * vec.x + mat.m3 * vec.y
-	};
-	return result;
-}
-
-// Multiply Matrix22 function
-QM_API q_matrix22 qmMatrix22MultiplyMatrix22(q_matrix22 left, q_matrix22 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1;
-	q_float m2 = left.m0 * right.m2 + left.m2 * right.m3;
-	q_float m3 = left.m1 * right.m2 + left.m3 * right.m3;
-
-	q_matrix22 result = {
-		m0, m2,
-		m1, m3
-	};
-	return result;
-}
-
-// Multiply Matrix23 function
-QM_API q_matrix23 qmMatrix22MultiplyMatrix23(q_matrix22 left, q_matrix23 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1;
-	q_float m2 = left.m0 * right.m2 + left.m2 * right.m3;
-	q_float m3 = left.m1 * right.m2 + left.m3 * right.m3;
-	q_float m4 = left.m0 * right.m4 + left.m2 * right.m5;
-	q_float m5 = left.m1 * right.m4 + left.m3 * right.m5;
-
-	q_matrix23 result = {
-		m0, m2, m4,
-		m1, m3, m5
-	};
-	return result;
-}
-
-// Multiply Matrix24 function
-QM_API q_matrix24 qmMatrix22MultiplyMatrix24(q_matrix22 left, q_matrix24 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1;
-	q_float m2 = left.m0 * right.m2 + left.m2 * right.m3;
-	q_float m3 = left.m1 * right.m2 + left.m3 * right.m3;
-	q_float m4 = left.m0 * right.m4 + left.m2 * right.m5;
-	q_float m5 = left.m1 * right.m4 + left.m3 * right.m5;
-	q_float m6 = left.m0 * right.m6 + left.m2 * right.m7;
-	q_float m7 = left.m1 * right.m6 + left.m3 * right.m7;
-
-	q_matrix24 result = {
-		m0, m2, m4, m6,
-		m1, m3, m5, m7
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix22 qmMatrix22Transpose(q_matrix22 mat)
-{
-	q_matrix22 result = {
-		mat.m0, mat.m1,
-		mat.m2, mat.m3
-	};
-	return result;
-}
-
-// Inverse function
-QM_API q_matrix22 qmMatrix22Inverse(q_matrix22 mat)
-{
-	q_float det = mat.m0 * mat.m3 - mat.m1 * mat.m2; // qmMatrix22Determinant(mat)
-	q_float inv = 1 / det;
-
-	q_matrix22 result = {
-		mat.m3 * inv, -mat.m2 * inv,
-		-mat.m1 * inv, mat.m0 * inv
-	};
-	return result;
-}
-
-// Determinant function
-QM_API q_float qmMatrix22Determinant(q_matrix22 mat)
-{
-	return mat.m0 * mat.m3 - mat.m1 * mat.m2;
-}
-
-// Trace function
-QM_API q_float qmMatrix22Trace(q_matrix22 mat)
-{
-	return mat.m0 + mat.m3;
-}
-
-// Equal function
-QM_API q_bool qmMatrix22Equal(q_matrix22 left, q_matrix22 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3)
-	);
-}
-
-//// Matrix23 functions ////
-
-// Zero matrix function
-QM_API q_matrix23 qmMatrix23Zero(q_void)
-{
-	q_matrix23 result = {
-		0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix23 qmMatrix23One(q_void)
-{
-	q_matrix23 result = {
-		1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix23 qmMatrix23Add(q_matrix23 left, q_matrix23 right)
-{
-	q_matrix23 result = {
-		left.m0 + right.m0, left.m2 + right.m2, left.m4 + right.m4,
-		left.m1 + right.m1, left.m3 + right.m3, left.m5 + right.m5
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix23 qmMatrix23Subtract(q_matrix23 left, q_matrix23 right)
-{
-	q_matrix23 result = {
-		left.m0 - right.m0, left.m2 - right.m2, left.m4 - right.m4,
-		left.m1 - right.m1, left.m3 - right.m3, left.m5 - right.m5
-	};
-	return result;
-}
-
-// Multiply Vector3 function
-QM_API q_vector2 qmMatrix23MultiplyVector3(q_matrix23 mat, q_vector3 vec)
-{
-	q_vector2 result = {
-		mat.m0 * vec.x + mat.m2 * vec.y + mat.m4 * vec.z,
-		mat.m1 * vec.x + mat.m3 * vec.y + mat.m5 * vec.z
-	};
-	return result;
-}
-
-// Multiply Matrix32 function
-QM_API q_matrix22 qmMatrix23MultiplyMatrix32(q_matrix23 left, q_matrix32 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2;
-	q_float m2 = left.m0 * right.m3 + left.m2 * right.m4 + left.m4 * right.m5;
-	q_float m3 = left.m1 * right.m3 + left.m3 * right.m4 + left.m5 * right.m5;
-
-	q_matrix22 result = {
-		m0, m2,
-		m1, m3
-	};
-	return result;
-}
-
-// Multiply Matrix33 function
-QM_API q_matrix23 qmMatrix23MultiplyMatrix33(q_matrix23 left, q_matrix33 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2;
-	q_float m2 = left.m0 * right.m3 + left.m2 * right.m4 + left.m4 * right.m5;
-	q_float m3 = left.m1 * right.m3 + left.m3 * right.m4 + left.m5 * right.m5;
-	q_float m4 = left.m0 * right.m6 + left.m2 * right.m7 + left.m4 * right.m8;
-	q_float m5 = left.m1 * right.m6 + left.m3 * right.m7 + left.m5 * right.m8;
-
-	q_matrix23 result = {
-		m0, m2, m4,
-		m1, m3, m5
-	};
-	return result;
-}
-
-// Multiply Matrix34 function
-QM_API q_matrix24 qmMatrix23MultiplyMatrix34(q_matrix23 left, q_matrix34 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2;
-	q_float m2 = left.m0 * right.m3 + left.m2 * right.m4 + left.m4 * right.m5;
-	q_float m3 = left.m1 * right.m3 + left.m3 * right.m4 + left.m5 * right.m5;
-	q_float m4 = left.m0 * right.m6 + left.m2 * right.m7 + left.m4 * right.m8;
-	q_float m5 = left.m1 * right.m6 + left.m3 * right.m7 + left.m5 * right.m8;
-	q_float m6 = left.m0 * right.m9 + left.m2 * right.m10 + left.m4 * right.m11;
-	q_float m7 = left.m1 * right.m9 + left.m3 * right.m10 + left.m5 * right.m11;
-
-	q_matrix24 result = {
-		m0, m2, m4, m6,
-		m1, m3, m5, m7
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix32 qmMatrix23Transpose(q_matrix23 mat)
-{
-	q_matrix32 result = {
-		mat.m0, mat.m1,
-		mat.m2, mat.m3,
-		mat.m4, mat.m5
-	};
-	return result;
-}
-
-// Equal function
-QM_API q_bool qmMatrix23Equal(q_matrix23 left, q_matrix23 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5)
-	);
-}
-
-//// Matrix24 functions ////
-
-// Zero matrix function
-QM_API q_matrix24 qmMatrix24Zero(q_void)
-{
-	q_matrix24 result = {
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix24 qmMatrix24One(q_void)
-{
-	q_matrix24 result = {
-		1.0f, 1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix24 qmMatrix24Add(q_matrix24 left, q_matrix24 right)
-{
-	q_matrix24 result = {
-		left.m0 + right.m0, left.m2 + right.m2, left.m4 + right.m4, left.m6 + right.m6,
-		left.m1 + right.m1, left.m3 + right.m3, left.m5 + right.m5, left.m7 + right.m7
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix24 qmMatrix24Subtract(q_matrix24 left, q_matrix24 right)
-{
-	q_matrix24 result = {
-		left.m0 - right.m0, left.m2 - right.m2, left.m4 - right.m4, left.m6 - right.m6,
-		left.m1 - right.m1, left.m3 - right.m3, left.m5 - right.m5, left.m7 - right.m7
-	};
-	return result;
-}
-
-// Multiply Vector4 function
-QM_API q_vector2 qmMatrix24MultiplyVector4(q_matrix24 mat, q_vector4 vec)
-{
-	q_vector2 result = {
-		mat.m0 * vec.x + mat.m2 * vec.y + mat.m4 * vec.z + mat.m6 * vec.w,
-		mat.m1 * vec.x + mat.m3 * vec.y + mat.m5 * vec.z + mat.m7 * vec.w
-	};
-	return result;
-}
-
-// Multiply Matrix42 function
-QM_API q_matrix22 qmMatrix24MultiplyMatrix42(q_matrix24 left, q_matrix42 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2 + left.m6 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2 + left.m7 * right.m3;
-	q_float m2 = left.m0 * right.m4 + left.m2 * right.m5 + left.m4 * right.m6 + left.m6 * right.m7;
-	q_float m3 = left.m1 * right.m4 + left.m3 * right.m5 + left.m5 * right.m6 + left.m7 * right.m7;
-
-	q_matrix22 result = {
-		m0, m2,
-		m1, m3
-	};
-	return result;
-}
-
-// Multiply Matrix43 function
-QM_API q_matrix23 qmMatrix24MultiplyMatrix43(q_matrix24 left, q_matrix43 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2 + left.m6 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2 + left.m7 * right.m3;
-	q_float m2 = left.m0 * right.m4 + left.m2 * right.m5 + left.m4 * right.m6 + left.m6 * right.m7;
-	q_float m3 = left.m1 * right.m4 + left.m3 * right.m5 + left.m5 * right.m6 + left.m7 * right.m7;
-	q_float m4 = left.m0 * right.m8 + left.m2 * right.m9 + left.m4 * right.m10 + left.m6 * right.m11;
-	q_float m5 = left.m1 * right.m8 + left.m3 * right.m9 + left.m5 * right.m10 + left.m7 * right.m11;
-
-	q_matrix23 result = {
-		m0, m2, m4,
-		m1, m3, m5
-	};
-	return result;
-}
-
-// Multiply Matrix44 function
-QM_API q_matrix24 qmMatrix24MultiplyMatrix44(q_matrix24 left, q_matrix44 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2 + left.m6 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2 + left.m7 * right.m3;
-	q_float m2 = left.m0 * right.m4 + left.m2 * right.m5 + left.m4 * right.m6 + left.m6 * right.m7;
-	q_float m3 = left.m1 * right.m4 + left.m3 * right.m5 + left.m5 * right.m6 + left.m7 * right.m7;
-	q_float m4 = left.m0 * right.m8 + left.m2 * right.m9 + left.m4 * right.m10 + left.m6 * right.m11;
-	q_float m5 = left.m1 * right.m8 + left.m3 * right.m9 + left.m5 * right.m10 + left.m7 * right.m11;
-	q_float m6 = left.m0 * right.m12 + left.m2 * right.m13 + left.m4 * right.m14 + left.m6 * right.m15;
-	q_float m7 = left.m1 * right.m12 + left.m3 * right.m13 + left.m5 * right.m14 + left.m7 * right.m15;
-
-	q_matrix24 result = {
-		m0, m2, m4, m6,
-		m1, m3, m5, m7
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix42 qmMatrix24Transpose(q_matrix24 mat)
-{
-	q_matrix42 result = {
-		mat.m0, mat.m1,
-		mat.m2, mat.m3,
-		mat.m4, mat.m5,
-		mat.m6, mat.m7
-	};
-	return result;
-}
-
-// Equal function
-QM_API q_bool qmMatrix24Equal(q_matrix24 left, q_matrix24 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5) &&
-		equalf(left.m6, right.m6) &&
-		equalf(left.m7, right.m7)
-	);
-}
-
-//// Matrix32 functions ////
-
-// Zero matrix function
-QM_API q_matrix32 qmMatrix32Zero(q_void)
-{
-	q_matrix32 result = {
-		0.0f, 0.0f,
-		0.0f, 0.0f,
-		0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix32 qmMatrix32One(q_void)
-{
-	q_matrix32 result = {
-		1.0f, 1.0f,
-		1.0f, 1.0f,
-		1.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix32 qmMatrix32Add(q_matrix32 left, q_matrix32 right)
-{
-	q_matrix32 result = {
-		left.m0 + right.m0, left.m3 + right.m3,
-		left.m1 + right.m1, left.m4 + right.m4,
-		left.m2 + right.m2, left.m5 + right.m5
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix32 qmMatrix32Subtract(q_matrix32 left, q_matrix32 right)
-{
-	q_matrix32 result = {
-		left.m0 - right.m0, left.m3 - right.m3,
-		left.m1 - right.m1, left.m4 - right.m4,
-		left.m2 - right.m2, left.m5 - right.m5
-	};
-	return result;
-}
-
-// Multiply Vector2 function
-QM_API q_vector3 qmMatrix32MultiplyVector2(q_matrix32 mat, q_vector2 vec)
-{
-	q_vector3 result = {
-		mat.m0 * vec.x + mat.m3 * vec.y,
-		mat.m1 * vec.x + mat.m4 * vec.y,
-		mat.m2 * vec.x + mat.m5 * vec.y
-	};
-	return result;
-}
-
-// Multiply Matrix22 function
-QM_API q_matrix32 qmMatrix32MultiplyMatrix22(q_matrix32 left, q_matrix22 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1;
-	q_float m3 = left.m0 * right.m2 + left.m3 * right.m3;
-	q_float m4 = left.m1 * right.m2 + left.m4 * right.m3;
-	q_float m5 = left.m2 * right.m2 + left.m5 * right.m3;
-
-	q_matrix32 result = {
-		m0, m3,
-		m1, m4,
-		m2, m5
-	};
-	return result;
-}
-
-// Multiply Matrix23 function
-QM_API q_matrix33 qmMatrix32MultiplyMatrix23(q_matrix32 left, q_matrix23 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1;
-	q_float m3 = left.m0 * right.m2 + left.m3 * right.m3;
-	q_float m4 = left.m1 * right.m2 + left.m4 * right.m3;
-	q_float m5 = left.m2 * right.m2 + left.m5 * right.m3;
-	q_float m6 = left.m0 * right.m4 + left.m3 * right.m5;
-	q_float m7 = left.m1 * right.m4 + left.m4 * right.m5;
-	q_float m8 = left.m2 * right.m4 + left.m5 * right.m5;
-
-	q_matrix33 result = {
-		m0, m3, m6,
-		m1, m4, m7,
-		m2, m5, m8
-	};
-	return result;
-}
-
-// Multiply Matrix24 function
-QM_API q_matrix34 qmMatrix32MultiplyMatrix24(q_matrix32 left, q_matrix24 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1;
-	q_float m3 = left.m0 * right.m2 + left.m3 * right.m3;
-	q_float m4 = left.m1 * right.m2 + left.m4 * right.m3;
-	q_float m5 = left.m2 * right.m2 + left.m5 * right.m3;
-	q_float m6 = left.m0 * right.m4 + left.m3 * right.m5;
-	q_float m7 = left.m1 * right.m4 + left.m4 * right.m5;
-	q_float m8 = left.m2 * right.m4 + left.m5 * right.m5;
-	q_float m9 = left.m0 * right.m6 + left.m3 * right.m7;
-	q_float m10 = left.m1 * right.m6 + left.m4 * right.m7;
-	q_float m11 = left.m2 * right.m6 + left.m5 * right.m7;
-
-	q_matrix34 result = {
-		m0, m3, m6, m9,
-		m1, m4, m7, m10,
-		m2, m5, m8, m11
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix23 qmMatrix32Transpose(q_matrix32 mat)
-{
-	q_matrix23 result = {
-		mat.m0, mat.m1, mat.m2,
-		mat.m3, mat.m4, mat.m5
-	};
-	return result;
-}
-
-// Equal function
-QM_API q_bool qmMatrix32Equal(q_matrix32 left, q_matrix32 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5)
-	);
-}
-
-//// Matrix33 functions ////
-
-// Zero matrix function
-QM_API q_matrix33 qmMatrix33Zero(q_void)
-{
-	q_matrix33 result = {
-		0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix33 qmMatrix33One(q_void)
-{
-	q_matrix33 result = {
-		1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f
-	};
-	return result;
-}
-
-// Identity matrix function
-QM_API q_matrix33 qmMatrix33Identity(q_void)
-{
-	q_matrix33 result = {
-		1.0f, 0.0f, 0.0f,
-		0.0f, 1.0f, 0.0f,
-		0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix33 qmMatrix33Add(q_matrix33 left, q_matrix33 right)
-{
-	q_matrix33 result = {
-		left.m0 + right.m0, left.m3 + right.m3, left.m6 + right.m6,
-		left.m1 + right.m1, left.m4 + right.m4, left.m7 + right.m7,
-		left.m2 + right.m2, left.m5 + right.m5, left.m8 + right.m8
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix33 qmMatrix33Subtract(q_matrix33 left, q_matrix33 right)
-{
-	q_matrix33 result = {
-		left.m0 - right.m0, left.m3 - right.m3, left.m6 - right.m6,
-		left.m1 - right.m1, left.m4 - right.m4, left.m7 - right.m7,
-		left.m2 - right.m2, left.m5 - right.m5, left.m8 - right.m8
-	};
-	return result;
-}
-
-// Multiply Vector3 function
-QM_API q_vector3 qmMatrix33MultiplyVector3(q_matrix33 mat, q_vector3 vec)
-{
-	q_vector3 result = {
-		mat.m0 * vec.x + mat.m3 * vec.y + mat.m6 * vec.z,
-		mat.m1 * vec.x + mat.m4 * vec.y + mat.m7 * vec.z,
-		mat.m2 * vec.x + mat.m5 * vec.y + mat.m8 * vec.z
-	};
-	return result;
-}
-
-// Multiply Matrix32 function
-QM_API q_matrix32 qmMatrix33MultiplyMatrix32(q_matrix33 left, q_matrix32 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2;
-	q_float m3 = left.m0 * right.m3 + left.m3 * right.m4 + left.m6 * right.m5;
-	q_float m4 = left.m1 * right.m3 + left.m4 * right.m4 + left.m7 * right.m5;
-	q_float m5 = left.m2 * right.m3 + left.m5 * right.m4 + left.m8 * right.m5;
-
-	q_matrix32 result = {
-		m0, m3,
-		m1, m4,
-		m2, m5
-	};
-	return result;
-}
-
-// Multiply Matrix33 function
-QM_API q_matrix33 qmMatrix33MultiplyMatrix33(q_matrix33 left, q_matrix33 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2;
-	q_float m3 = left.m0 * right.m3 + left.m3 * right.m4 + left.m6 * right.m5;
-	q_float m4 = left.m1 * right.m3 + left.m4 * right.m4 + left.m7 * right.m5;
-	q_float m5 = left.m2 * right.m3 + left.m5 * right.m4 + left.m8 * right.m5;
-	q_float m6 = left.m0 * right.m6 + left.m3 * right.m7 + left.m6 * right.m8;
-	q_float m7 = left.m1 * right.m6 + left.m4 * right.m7 + left.m7 * right.m8;
-	q_float m8 = left.m2 * right.m6 + left.m5 * right.m7 + left.m8 * right.m8;
-
-	q_matrix33 result = {
-		m0, m3, m6,
-		m1, m4, m7,
-		m2, m5, m8
-	};
-	return result;
-}
-
-// Multiply Matrix34 function
-QM_API q_matrix34 qmMatrix33MultiplyMatrix34(q_matrix33 left, q_matrix34 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2;
-	q_float m3 = left.m0 * right.m3 + left.m3 * right.m4 + left.m6 * right.m5;
-	q_float m4 = left.m1 * right.m3 + left.m4 * right.m4 + left.m7 * right.m5;
-	q_float m5 = left.m2 * right.m3 + left.m5 * right.m4 + left.m8 * right.m5;
-	q_float m6 = left.m0 * right.m6 + left.m3 * right.m7 + left.m6 * right.m8;
-	q_float m7 = left.m1 * right.m6 + left.m4 * right.m7 + left.m7 * right.m8;
-	q_float m8 = left.m2 * right.m6 + left.m5 * right.m7 + left.m8 * right.m8;
-	q_float m9 = left.m0 * right.m9 + left.m3 * right.m10 + left.m6 * right.m11;
-	q_float m10 = left.m1 * right.m9 + left.m4 * right.m10 + left.m7 * right.m11;
-	q_float m11 = left.m2 * right.m9 + left.m5 * right.m10 + left.m8 * right.m11;
-
-	q_matrix34 result = {
-		m0, m3, m6, m9,
-		m1, m4, m7, m10,
-		m2, m5, m8, m11
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix33 qmMatrix33Transpose(q_matrix33 mat)
-{
-	q_matrix33 result = {
-		mat.m0, mat.m1, mat.m2,
-		mat.m3, mat.m4, mat.m5,
-		mat.m6, mat.m7, mat.m8
-	};
-	return result;
-}
-
-// Inverse function
-QM_API q_matrix33 qmMatrix33Inverse(q_matrix33 mat)
-{
-	q_float det = ( // qmMatrix33Determinant(mat)
-		mat.m0 * mat.m4 * mat.m8 +
-		mat.m1 * mat.m5 * mat.m6 +
-		mat.m2 * mat.m3 * mat.m7 -
-		mat.m0 * mat.m5 * mat.m7 -
-		mat.m1 * mat.m3 * mat.m8 -
-		mat.m2 * mat.m4 * mat.m6
-	);
-	q_float inv = 1 / det;
-
-	q_float m0 = (mat.m4 * mat.m8 - mat.m5 * mat.m7) * inv;
-	q_float m1 = (mat.m2 * mat.m7 - mat.m1 * mat.m8) * inv;
-	q_float m2 = (mat.m1 * mat.m5 - mat.m2 * mat.m4) * inv;
-	q_float m3 = (mat.m5 * mat.m6 - mat.m3 * mat.m8) * inv;
-	q_float m4 = (mat.m0 * mat.m8 - mat.m2 * mat.m6) * inv;
-	q_float m5 = (mat.m2 * mat.m3 - mat.m0 * mat.m5) * inv;
-	q_float m6 = (mat.m3 * mat.m7 - mat.m4 * mat.m6) * inv;
-	q_float m7 = (mat.m1 * mat.m6 - mat.m0 * mat.m7) * inv;
-	q_float m8 = (mat.m0 * mat.m4 - mat.m1 * mat.m3) * inv;
-
-	q_matrix33 result = {
-		m0, m3, m6,
-		m1, m4, m7,
-		m2, m5, m8
-	};
-	return result;
-}
-
-// Determinant function
-QM_API q_float qmMatrix33Determinant(q_matrix33 mat)
-{
-	return (
-		mat.m0 * mat.m4 * mat.m8 +
-		mat.m1 * mat.m5 * mat.m6 +
-		mat.m2 * mat.m3 * mat.m7 -
-		mat.m0 * mat.m5 * mat.m7 -
-		mat.m1 * mat.m3 * mat.m8 -
-		mat.m2 * mat.m4 * mat.m6
-	);
-}
-
-// Trace function
-QM_API q_float qmMatrix33Trace(q_matrix33 mat)
-{
-	return mat.m0 + mat.m4 + mat.m8;
-}
-
-// Equal function
-QM_API q_bool qmMatrix33Equal(q_matrix33 left, q_matrix33 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5) &&
-		equalf(left.m6, right.m6) &&
-		equalf(left.m7, right.m7) &&
-		equalf(left.m8, right.m8)
-	);
-}
-
-//// Matrix34 functions ////
-
-// Zero matrix function
-QM_API q_matrix34 qmMatrix34Zero(q_void)
-{
-	q_matrix34 result = {
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix34 qmMatrix34One(q_void)
-{
-	q_matrix34 result = {
-		1.0f, 1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix34 qmMatrix34Add(q_matrix34 left, q_matrix34 right)
-{
-	q_matrix34 result = {
-		left.m0 + right.m0, left.m3 + right.m3, left.m6 + right.m6, left.m9 + right.m9,
-		left.m1 + right.m1, left.m4 + right.m4, left.m7 + right.m7, left.m10 + right.m10,
-		left.m2 + right.m2, left.m5 + right.m5, left.m8 + right.m8, left.m11 + right.m11
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix34 qmMatrix34Subtract(q_matrix34 left, q_matrix34 right)
-{
-	q_matrix34 result = {
-		left.m0 - right.m0, left.m3 - right.m3, left.m6 - right.m6, left.m9 - right.m9,
-		left.m1 - right.m1, left.m4 - right.m4, left.m7 - right.m7, left.m10 - right.m10,
-		left.m2 - right.m2, left.m5 - right.m5, left.m8 - right.m8, left.m11 - right.m11
-	};
-	return result;
-}
-
-// Multiply Vector4 function
-QM_API q_vector3 qmMatrix34MultiplyVector4(q_matrix34 mat, q_vector4 vec)
-{
-	q_vector3 result = {
-		mat.m0 * vec.x + mat.m3 * vec.y + mat.m6 * vec.z + mat.m9 * vec.w,
-		mat.m1 * vec.x + mat.m4 * vec.y + mat.m7 * vec.z + mat.m10 * vec.w,
-		mat.m2 * vec.x + mat.m5 * vec.y + mat.m8 * vec.z + mat.m11 * vec.w
-	};
-	return result;
-}
-
-// Multiply Matrix42 function
-QM_API q_matrix32 qmMatrix34MultiplyMatrix42(q_matrix34 left, q_matrix42 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2 + left.m9 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2 + left.m10 * right.m3;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2 + left.m11 * right.m3;
-	q_float m3 = left.m0 * right.m4 + left.m3 * right.m5 + left.m6 * right.m6 + left.m9 * right.m7;
-	q_float m4 = left.m1 * right.m4 + left.m4 * right.m5 + left.m7 * right.m6 + left.m10 * right.m7;
-	q_float m5 = left.m2 * right.m4 + left.m5 * right.m5 + left.m8 * right.m6 + left.m11 * right.m7;
-
-	q_matrix32 result = {
-		m0, m3,
-		m1, m4,
-		m2, m5
-	};
-	return result;
-}
-
-// Multiply Matrix43 function
-QM_API q_matrix33 qmMatrix34MultiplyMatrix43(q_matrix34 left, q_matrix43 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2 + left.m9 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2 + left.m10 * right.m3;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2 + left.m11 * right.m3;
-	q_float m3 = left.m0 * right.m4 + left.m3 * right.m5 + left.m6 * right.m6 + left.m9 * right.m7;
-	q_float m4 = left.m1 * right.m4 + left.m4 * right.m5 + left.m7 * right.m6 + left.m10 * right.m7;
-	q_float m5 = left.m2 * right.m4 + left.m5 * right.m5 + left.m8 * right.m6 + left.m11 * right.m7;
-	q_float m6 = left.m0 * right.m8 + left.m3 * right.m9 + left.m6 * right.m10 + left.m9 * right.m11;
-	q_float m7 = left.m1 * right.m8 + left.m4 * right.m9 + left.m7 * right.m10 + left.m10 * right.m11;
-	q_float m8 = left.m2 * right.m8 + left.m5 * right.m9 + left.m8 * right.m10 + left.m11 * right.m11;
-
-	q_matrix33 result = {
-		m0, m3, m6,
-		m1, m4, m7,
-		m2, m5, m8
-	};
-	return result;
-}
-
-// Multiply Matrix44 function
-QM_API q_matrix34 qmMatrix34MultiplyMatrix44(q_matrix34 left, q_matrix44 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2 + left.m9 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2 + left.m10 * right.m3;
-	q_float m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2 + left.m11 * right.m3;
-	q_float m3 = left.m0 * right.m4 + left.m3 * right.m5 + left.m6 * right.m6 + left.m9 * right.m7;
-	q_float m4 = left.m1 * right.m4 + left.m4 * right.m5 + left.m7 * right.m6 + left.m10 * right.m7;
-	q_float m5 = left.m2 * right.m4 + left.m5 * right.m5 + left.m8 * right.m6 + left.m11 * right.m7;
-	q_float m6 = left.m0 * right.m8 + left.m3 * right.m9 + left.m6 * right.m10 + left.m9 * right.m11;
-	q_float m7 = left.m1 * right.m8 + left.m4 * right.m9 + left.m7 * right.m10 + left.m10 * right.m11;
-	q_float m8 = left.m2 * right.m8 + left.m5 * right.m9 + left.m8 * right.m10 + left.m11 * right.m11;
-	q_float m9 = left.m0 * right.m12 + left.m3 * right.m13 + left.m6 * right.m14 + left.m9 * right.m15;
-	q_float m10 = left.m1 * right.m12 + left.m4 * right.m13 + left.m7 * right.m14 + left.m10 * right.m15;
-	q_float m11 = left.m2 * right.m12 + left.m5 * right.m13 + left.m8 * right.m14 + left.m11 * right.m15;
-
-	q_matrix34 result = {
-		m0, m3, m6, m9,
-		m1, m4, m7, m10,
-		m2, m5, m8, m11
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix43 qmMatrix34Transpose(q_matrix34 mat)
-{
-	q_matrix43 result = {
-		mat.m0, mat.m1, mat.m2,
-		mat.m3, mat.m4, mat.m5,
-		mat.m6, mat.m7, mat.m8,
-		mat.m9, mat.m10, mat.m11
-	};
-	return result;
-}
-
-// Equal function
-QM_API q_bool qmMatrix34Equal(q_matrix34 left, q_matrix34 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5) &&
-		equalf(left.m6, right.m6) &&
-		equalf(left.m7, right.m7) &&
-		equalf(left.m8, right.m8) &&
-		equalf(left.m9, right.m9) &&
-		equalf(left.m10, right.m10) &&
-		equalf(left.m11, right.m11)
-	);
-}
-
-//// Matrix42 functions ////
-
-// Zero matrix function
-QM_API q_matrix42 qmMatrix42Zero(q_void)
-{
-	q_matrix42 result = {
-		0.0f, 0.0f,
-		0.0f, 0.0f,
-		0.0f, 0.0f,
-		0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix42 qmMatrix42One(q_void)
-{
-	q_matrix42 result = {
-		1.0f, 1.0f,
-		1.0f, 1.0f,
-		1.0f, 1.0f,
-		1.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix42 qmMatrix42Add(q_matrix42 left, q_matrix42 right)
-{
-	q_matrix42 result = {
-		left.m0 + right.m0, left.m4 + right.m4,
-		left.m1 + right.m1, left.m5 + right.m5,
-		left.m2 + right.m2, left.m6 + right.m6,
-		left.m3 + right.m3, left.m7 + right.m7
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix42 qmMatrix42Subtract(q_matrix42 left, q_matrix42 right)
-{
-	q_matrix42 result = {
-		left.m0 - right.m0, left.m4 - right.m4,
-		left.m1 - right.m1, left.m5 - right.m5,
-		left.m2 - right.m2, left.m6 - right.m6,
-		left.m3 - right.m3, left.m7 - right.m7
-	};
-	return result;
-}
-
-// Multiply Vector2 function
-QM_API q_vector4 qmMatrix42MultiplyVector2(q_matrix42 mat, q_vector2 vec)
-{
-	q_vector4 result = {
-		mat.m0 * vec.x + mat.m4 * vec.y,
-		mat.m1 * vec.x + mat.m5 * vec.y,
-		mat.m2 * vec.x + mat.m6 * vec.y,
-		mat.m3 * vec.x + mat.m7 * vec.y
-	};
-	return result;
-}
-
-// Multiply Matrix22 function
-QM_API q_matrix42 qmMatrix42MultiplyMatrix22(q_matrix42 left, q_matrix22 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1;
-	q_float m4 = left.m0 * right.m2 + left.m4 * right.m3;
-	q_float m5 = left.m1 * right.m2 + left.m5 * right.m3;
-	q_float m6 = left.m2 * right.m2 + left.m6 * right.m3;
-	q_float m7 = left.m3 * right.m2 + left.m7 * right.m3;
-
-	q_matrix42 result = {
-		m0, m4,
-		m1, m5,
-		m2, m6,
-		m3, m7
-	};
-	return result;
-}
-
-// Multiply Matrix23 function
-QM_API q_matrix43 qmMatrix42MultiplyMatrix23(q_matrix42 left, q_matrix23 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1;
-	q_float m4 = left.m0 * right.m2 + left.m4 * right.m3;
-	q_float m5 = left.m1 * right.m2 + left.m5 * right.m3;
-	q_float m6 = left.m2 * right.m2 + left.m6 * right.m3;
-	q_float m7 = left.m3 * right.m2 + left.m7 * right.m3;
-	q_float m8 = left.m0 * right.m4 + left.m4 * right.m5;
-	q_float m9 = left.m1 * right.m4 + left.m5 * right.m5;
-	q_float m10 = left.m2 * right.m4 + left.m6 * right.m5;
-	q_float m11 = left.m3 * right.m4 + left.m7 * right.m5;
-
-	q_matrix43 result = {
-		m0, m4, m8,
-		m1, m5, m9,
-		m2, m6, m10,
-		m3, m7, m11
-	};
-	return result;
-}
-
-// Multiply Matrix24 function
-QM_API q_matrix44 qmMatrix42MultiplyMatrix24(q_matrix42 left, q_matrix24 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1;
-	q_float m4 = left.m0 * right.m2 + left.m4 * right.m3;
-	q_float m5 = left.m1 * right.m2 + left.m5 * right.m3;
-	q_float m6 = left.m2 * right.m2 + left.m6 * right.m3;
-	q_float m7 = left.m3 * right.m2 + left.m7 * right.m3;
-	q_float m8 = left.m0 * right.m4 + left.m4 * right.m5;
-	q_float m9 = left.m1 * right.m4 + left.m5 * right.m5;
-	q_float m10 = left.m2 * right.m4 + left.m6 * right.m5;
-	q_float m11 = left.m3 * right.m4 + left.m7 * right.m5;
-	q_float m12 = left.m0 * right.m6 + left.m4 * right.m7;
-	q_float m13 = left.m1 * right.m6 + left.m5 * right.m7;
-	q_float m14 = left.m2 * right.m6 + left.m6 * right.m7;
-	q_float m15 = left.m3 * right.m6 + left.m7 * right.m7;
-
-	q_matrix44 result = {
-		m0, m4, m8, m12,
-		m1, m5, m9, m13,
-		m2, m6, m10, m14,
-		m3, m7, m11, m15
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix24 qmMatrix42Transpose(q_matrix42 mat)
-{
-	q_matrix24 result = {
-		mat.m0, mat.m1, mat.m2, mat.m3,
-		mat.m4, mat.m5, mat.m6, mat.m7
-	};
-	return result;
-}
-
-// Equal function
-QM_API q_bool qmMatrix42Equal(q_matrix42 left, q_matrix42 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5) &&
-		equalf(left.m6, right.m6) &&
-		equalf(left.m7, right.m7)
-	);
-}
-
-//// Matrix43 functions ////
-
-// Zero matrix function
-QM_API q_matrix43 qmMatrix43Zero(q_void)
-{
-	q_matrix43 result = {
-		0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix43 qmMatrix43One(q_void)
-{
-	q_matrix43 result = {
-		1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix43 qmMatrix43Add(q_matrix43 left, q_matrix43 right)
-{
-	q_matrix43 result = {
-		left.m0 + right.m0, left.m4 + right.m4, left.m8 + right.m8,
-		left.m1 + right.m1, left.m5 + right.m5, left.m9 + right.m9,
-		left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10,
-		left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix43 qmMatrix43Subtract(q_matrix43 left, q_matrix43 right)
-{
-	q_matrix43 result = {
-		left.m0 - right.m0, left.m4 - right.m4, left.m8 - right.m8,
-		left.m1 - right.m1, left.m5 - right.m5, left.m9 - right.m9,
-		left.m2 - right.m2, left.m6 - right.m6, left.m10 - right.m10,
-		left.m3 - right.m3, left.m7 - right.m7, left.m11 - right.m11
-	};
-	return result;
-}
-
-// Multiply Vector3 function
-QM_API q_vector4 qmMatrix43MultiplyVector3(q_matrix43 mat, q_vector3 vec)
-{
-	q_vector4 result = {
-		mat.m0 * vec.x + mat.m4 * vec.y + mat.m8 * vec.z,
-		mat.m1 * vec.x + mat.m5 * vec.y + mat.m9 * vec.z,
-		mat.m2 * vec.x + mat.m6 * vec.y + mat.m10 * vec.z,
-		mat.m3 * vec.x + mat.m7 * vec.y + mat.m11 * vec.z
-	};
-	return result;
-}
-
-// Multiply Matrix32 function
-QM_API q_matrix42 qmMatrix43MultiplyMatrix32(q_matrix43 left, q_matrix32 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2;
-	q_float m4 = left.m0 * right.m3 + left.m4 * right.m4 + left.m8 * right.m5;
-	q_float m5 = left.m1 * right.m3 + left.m5 * right.m4 + left.m9 * right.m5;
-	q_float m6 = left.m2 * right.m3 + left.m6 * right.m4 + left.m10 * right.m5;
-	q_float m7 = left.m3 * right.m3 + left.m7 * right.m4 + left.m11 * right.m5;
-
-	q_matrix42 result = {
-		m0, m4,
-		m1, m5,
-		m2, m6,
-		m3, m7
-	};
-	return result;
-}
-
-// Multiply Matrix33 function
-QM_API q_matrix43 qmMatrix43MultiplyMatrix33(q_matrix43 left, q_matrix33 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2;
-	q_float m4 = left.m0 * right.m3 + left.m4 * right.m4 + left.m8 * right.m5;
-	q_float m5 = left.m1 * right.m3 + left.m5 * right.m4 + left.m9 * right.m5;
-	q_float m6 = left.m2 * right.m3 + left.m6 * right.m4 + left.m10 * right.m5;
-	q_float m7 = left.m3 * right.m3 + left.m7 * right.m4 + left.m11 * right.m5;
-	q_float m8 = left.m0 * right.m6 + left.m4 * right.m7 + left.m8 * right.m8;
-	q_float m9 = left.m1 * right.m6 + left.m5 * right.m7 + left.m9 * right.m8;
-	q_float m10 = left.m2 * right.m6 + left.m6 * right.m7 + left.m10 * right.m8;
-	q_float m11 = left.m3 * right.m6 + left.m7 * right.m7 + left.m11 * right.m8;
-
-	q_matrix43 result = {
-		m0, m4, m8,
-		m1, m5, m9,
-		m2, m6, m10,
-		m3, m7, m11
-	};
-	return result;
-}
-
-// Multiply Matrix34 function
-QM_API q_matrix44 qmMatrix43MultiplyMatrix34(q_matrix43 left, q_matrix34 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2;
-	q_float m4 = left.m0 * right.m3 + left.m4 * right.m4 + left.m8 * right.m5;
-	q_float m5 = left.m1 * right.m3 + left.m5 * right.m4 + left.m9 * right.m5;
-	q_float m6 = left.m2 * right.m3 + left.m6 * right.m4 + left.m10 * right.m5;
-	q_float m7 = left.m3 * right.m3 + left.m7 * right.m4 + left.m11 * right.m5;
-	q_float m8 = left.m0 * right.m6 + left.m4 * right.m7 + left.m8 * right.m8;
-	q_float m9 = left.m1 * right.m6 + left.m5 * right.m7 + left.m9 * right.m8;
-	q_float m10 = left.m2 * right.m6 + left.m6 * right.m7 + left.m10 * right.m8;
-	q_float m11 = left.m3 * right.m6 + left.m7 * right.m7 + left.m11 * right.m8;
-	q_float m12 = left.m0 * right.m9 + left.m4 * right.m10 + left.m8 * right.m11;
-	q_float m13 = left.m1 * right.m9 + left.m5 * right.m10 + left.m9 * right.m11;
-	q_float m14 = left.m2 * right.m9 + left.m6 * right.m10 + left.m10 * right.m11;
-	q_float m15 = left.m3 * right.m9 + left.m7 * right.m10 + left.m11 * right.m11;
-
-	q_matrix44 result = {
-		m0, m4, m8, m12,
-		m1, m5, m9, m13,
-		m2, m6, m10, m14,
-		m3, m7, m11, m15
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix34 qmMatrix43Transpose(q_matrix43 mat)
-{
-	q_matrix34 result = {
-		mat.m0, mat.m1, mat.m2, mat.m3,
-		mat.m4, mat.m5, mat.m6, mat.m7,
-		mat.m8, mat.m9, mat.m10, mat.m11
-	};
-	return result;
-}
-
-// Equal function
-QM_API q_bool qmMatrix43Equal(q_matrix43 left, q_matrix43 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5) &&
-		equalf(left.m6, right.m6) &&
-		equalf(left.m7, right.m7) &&
-		equalf(left.m8, right.m8) &&
-		equalf(left.m9, right.m9) &&
-		equalf(left.m10, right.m10) &&
-		equalf(left.m11, right.m11)
-	);
-}
-
-//// Matrix44 functions ////
-
-// Zero matrix function
-QM_API q_matrix44 qmMatrix44Zero(q_void)
-{
-	q_matrix44 result = {
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 0.0f
-	};
-	return result;
-}
-
-// One matrix function
-QM_API q_matrix44 qmMatrix44One(q_void)
-{
-	q_matrix44 result = {
-		1.0f, 1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f, 1.0f,
-		1.0f, 1.0f, 1.0f, 1.0f
-	};
-	return result;
-}
-
-// Identity matrix function
-QM_API q_matrix44 qmMatrix44Identity(q_void)
-{
-	q_matrix44 result = {
-		1.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, 1.0f, 0.0f, 0.0f,
-		0.0f, 0.0f, 1.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Add function
-QM_API q_matrix44 qmMatrix44Add(q_matrix44 left, q_matrix44 right)
-{
-	q_matrix44 result = {
-		left.m0 + right.m0, left.m4 + right.m4, left.m8 + right.m8, left.m12 + right.m12,
-		left.m1 + right.m1, left.m5 + right.m5, left.m9 + right.m9, left.m13 + right.m13,
-		left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10, left.m14 + right.m14,
-		left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11, left.m15 + right.m15
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_matrix44 qmMatrix44Subtract(q_matrix44 left, q_matrix44 right)
-{
-	q_matrix44 result = {
-		left.m0 + right.m0, left.m4 + right.m4, left.m8 + right.m8, left.m12 + right.m12,
-		left.m1 + right.m1, left.m5 + right.m5, left.m9 + right.m9, left.m13 + right.m13,
-		left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10, left.m14 + right.m14,
-		left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11, left.m15 + right.m15};
-	return result;
-}
-
-// Multiply Vector4 function
-QM_API q_vector4 qmMatrix44MultiplyVector4(q_matrix44 mat, q_vector4 vec)
-{
-	q_vector4 result = {
-		mat.m0 * vec.x + mat.m4 * vec.y + mat.m8 * vec.z + mat.m12 * vec.w,
-		mat.m1 * vec.x + mat.m5 * vec.y + mat.m9 * vec.z + mat.m13 * vec.w,
-		mat.m2 * vec.x + mat.m6 * vec.y + mat.m10 * vec.z + mat.m14 * vec.w,
-		mat.m3 * vec.x + mat.m7 * vec.y + mat.m11 * vec.z + mat.m15 * vec.w
-	};
-	return result;
-}
-
-// Multiply Matrix42 function
-QM_API q_matrix42 qmMatrix44MultiplyMatrix42(q_matrix44 left, q_matrix42 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2 + left.m12 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2 + left.m13 * right.m3;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2 + left.m14 * right.m3;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2 + left.m15 * right.m3;
-	q_float m4 = left.m0 * right.m4 + left.m4 * right.m5 + left.m8 * right.m6 + left.m12 * right.m7;
-	q_float m5 = left.m1 * right.m4 + left.m5 * right.m5 + left.m9 * right.m6 + left.m13 * right.m7;
-	q_float m6 = left.m2 * right.m4 + left.m6 * right.m5 + left.m10 * right.m6 + left.m14 * right.m7;
-	q_float m7 = left.m3 * right.m4 + left.m7 * right.m5 + left.m11 * right.m6 + left.m15 * right.m7;
-
-	q_matrix42 result = {
-		m0, m4,
-		m1, m5,
-		m2, m6,
-		m3, m7
-	};
-	return result;
-}
-
-// Multiply Matrix43 function
-QM_API q_matrix43 qmMatrix44MultiplyMatrix43(q_matrix44 left, q_matrix43 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2 + left.m12 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2 + left.m13 * right.m3;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2 + left.m14 * right.m3;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2 + left.m15 * right.m3;
-	q_float m4 = left.m0 * right.m4 + left.m4 * right.m5 + left.m8 * right.m6 + left.m12 * right.m7;
-	q_float m5 = left.m1 * right.m4 + left.m5 * right.m5 + left.m9 * right.m6 + left.m13 * right.m7;
-	q_float m6 = left.m2 * right.m4 + left.m6 * right.m5 + left.m10 * right.m6 + left.m14 * right.m7;
-	q_float m7 = left.m3 * right.m4 + left.m7 * right.m5 + left.m11 * right.m6 + left.m15 * right.m7;
-	q_float m8 = left.m0 * right.m8 + left.m4 * right.m9 + left.m8 * right.m10 + left.m12 * right.m11;
-	q_float m9 = left.m1 * right.m8 + left.m5 * right.m9 + left.m9 * right.m10 + left.m13 * right.m11;
-	q_float m10 = left.m2 * right.m8 + left.m6 * right.m9 + left.m10 * right.m10 + left.m14 * right.m11;
-	q_float m11 = left.m3 * right.m8 + left.m7 * right.m9 + left.m11 * right.m10 + left.m15 * right.m11;
-
-	q_matrix43 result = {
-		m0, m4, m8,
-		m1, m5, m9,
-		m2, m6, m10,
-		m3, m7, m11
-	};
-	return result;
-}
-
-// Multiply Matrix44 function
-QM_API q_matrix44 qmMatrix44MultiplyMatrix44(q_matrix44 left, q_matrix44 right)
-{
-	q_float m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2 + left.m12 * right.m3;
-	q_float m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2 + left.m13 * right.m3;
-	q_float m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2 + left.m14 * right.m3;
-	q_float m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2 + left.m15 * right.m3;
-	q_float m4 = left.m0 * right.m4 + left.m4 * right.m5 + left.m8 * right.m6 + left.m12 * right.m7;
-	q_float m5 = left.m1 * right.m4 + left.m5 * right.m5 + left.m9 * right.m6 + left.m13 * right.m7;
-	q_float m6 = left.m2 * right.m4 + left.m6 * right.m5 + left.m10 * right.m6 + left.m14 * right.m7;
-	q_float m7 = left.m3 * right.m4 + left.m7 * right.m5 + left.m11 * right.m6 + left.m15 * right.m7;
-	q_float m8 = left.m0 * right.m8 + left.m4 * right.m9 + left.m8 * right.m10 + left.m12 * right.m11;
-	q_float m9 = left.m1 * right.m8 + left.m5 * right.m9 + left.m9 * right.m10 + left.m13 * right.m11;
-	q_float m10 = left.m2 * right.m8 + left.m6 * right.m9 + left.m10 * right.m10 + left.m14 * right.m11;
-	q_float m11 = left.m3 * right.m8 + left.m7 * right.m9 + left.m11 * right.m10 + left.m15 * right.m11;
-	q_float m12 = left.m0 * right.m12 + left.m4 * right.m13 + left.m8 * right.m14 + left.m12 * right.m15;
-	q_float m13 = left.m1 * right.m12 + left.m5 * right.m13 + left.m9 * right.m14 + left.m13 * right.m15;
-	q_float m14 = left.m2 * right.m12 + left.m6 * right.m13 + left.m10 * right.m14 + left.m14 * right.m15;
-	q_float m15 = left.m3 * right.m12 + left.m7 * right.m13 + left.m11 * right.m14 + left.m15 * right.m15;
-
-	q_matrix44 result = {
-		m0, m4, m8, m12,
-		m1, m5, m9, m13,
-		m2, m6, m10, m14,
-		m3, m7, m11, m15
-	};
-	return result;
-}
-
-// Transpose function
-QM_API q_matrix44 qmMatrix44Transpose(q_matrix44 mat)
-{
-	q_matrix44 result = {
-		mat.m0, mat.m1, mat.m2, mat.m3,
-		mat.m4, mat.m5, mat.m6, mat.m7,
-		mat.m8, mat.m9, mat.m10, mat.m11,
-		mat.m12, mat.m13, mat.m14, mat.m15
-	};
-	return result;
-}
-
-// Inverse function
-QM_API q_matrix44 qmMatrix44Inverse(q_matrix44 mat)
-{
-	q_float det = ( // qmMatrix44Determinant(mat)
-		mat.m0 * mat.m5 * mat.m10 * mat.m15 +
-		mat.m0 * mat.m6 * mat.m11 * mat.m13 +
-		mat.m0 * mat.m7 * mat.m9 * mat.m14 +
-		mat.m1 * mat.m4 * mat.m11 * mat.m14 +
-		mat.m1 * mat.m6 * mat.m8 * mat.m15 +
-		mat.m1 * mat.m7 * mat.m10 * mat.m12 +
-		mat.m2 * mat.m4 * mat.m9 * mat.m15 +
-		mat.m2 * mat.m5 * mat.m11 * mat.m12 +
-		mat.m2 * mat.m7 * mat.m8 * mat.m13 +
-		mat.m3 * mat.m4 * mat.m10 * mat.m13 +
-		mat.m3 * mat.m5 * mat.m8 * mat.m14 +
-		mat.m3 * mat.m6 * mat.m9 * mat.m12 -
-		mat.m0 * mat.m5 * mat.m11 * mat.m14 -
-		mat.m0 * mat.m6 * mat.m9 * mat.m15 -
-		mat.m0 * mat.m7 * mat.m10 * mat.m13 -
-		mat.m1 * mat.m4 * mat.m10 * mat.m15 -
-		mat.m1 * mat.m6 * mat.m11 * mat.m12 -
-		mat.m1 * mat.m7 * mat.m8 * mat.m14 -
-		mat.m2 * mat.m4 * mat.m11 * mat.m13 -
-		mat.m2 * mat.m5 * mat.m8 * mat.m15 -
-		mat.m2 * mat.m7 * mat.m9 * mat.m12 -
-		mat.m3 * mat.m4 * mat.m9 * mat.m14 -
-		mat.m3 * mat.m5 * mat.m10 * mat.m12 -
-		mat.m3 * mat.m6 * mat.m8 * mat.m13
-	);
-	q_float inv = 1 / det;
-
-	q_float m0 = (
-		mat.m5 * mat.m10 * mat.m15 +
-		mat.m6 * mat.m11 * mat.m13 +
-		mat.m7 * mat.m9 * mat.m14 -
-		mat.m5 * mat.m11 * mat.m14 -
-		mat.m6 * mat.m9 * mat.m15 -
-		mat.m7 * mat.m10 * mat.m13
-	) * inv;
-	q_float m1 = (
-		mat.m1 * mat.m11 * mat.m14 +
-		mat.m2 * mat.m9 * mat.m15 +
-		mat.m3 * mat.m10 * mat.m13 -
-		mat.m1 * mat.m10 * mat.m15 -
-		mat.m2 * mat.m11 * mat.m13 -
-		mat.m3 * mat.m9 * mat.m14
-	) * inv;
-	q_float m2 = (
-		mat.m1 * mat.m6 * mat.m15 +
-		mat.m2 * mat.m7 * mat.m13 +
-		mat.m3 * mat.m5 * mat.m14 -
-		mat.m1 * mat.m7 * mat.m14 -
-		mat.m2 * mat.m5 * mat.m15 -
-		mat.m3 * mat.m6 * mat.m13
-	) * inv;
-	q_float m3 = (
-		mat.m1 * mat.m7 * mat.m10 +
-		mat.m2 * mat.m5 * mat.m11 +
-		mat.m3 * mat.m6 * mat.m9 -
-		mat.m1 * mat.m6 * mat.m11 -
-		mat.m2 * mat.m7 * mat.m9 -
-		mat.m3 * mat.m5 * mat.m10
-	) * inv;
-	q_float m4 = (
-		mat.m4 * mat.m11 * mat.m14 +
-		mat.m6 * mat.m8 * mat.m15 +
-		mat.m7 * mat.m10 * mat.m12 -
-		mat.m4 * mat.m10 * mat.m15 -
-		mat.m6 * mat.m11 * mat.m12 -
-		mat.m7 * mat.m8 * mat.m14
-	) * inv;
-	q_float m5 = (
-		mat.m0 * mat.m10 * mat.m15 +
-		mat.m2 * mat.m11 * mat.m12 +
-		mat.m3 * mat.m8 * mat.m14 -
-		mat.m0 * mat.m11 * mat.m14 -
-		mat.m2 * mat.m8 * mat.m15 -
-		mat.m3 * mat.m10 * mat.m12
-	) * inv;
-	q_float m6 = (
-		mat.m0 * mat.m7 * mat.m14 +
-		mat.m2 * mat.m4 * mat.m15 +
-		mat.m3 * mat.m6 * mat.m12 -
-		mat.m0 * mat.m6 * mat.m15 -
-		mat.m2 * mat.m7 * mat.m12 -
-		mat.m3 * mat.m4 * mat.m14
-	) * inv;
-	q_float m7 = (
-		mat.m0 * mat.m6 * mat.m11 +
-		mat.m2 * mat.m7 * mat.m8 +
-		mat.m3 * mat.m4 * mat.m10 -
-		mat.m0 * mat.m7 * mat.m10 -
-		mat.m2 * mat.m4 * mat.m11 -
-		mat.m3 * mat.m6 * mat.m8
-	) * inv;
-	q_float m8 = (
-		mat.m4 * mat.m9 * mat.m15 +
-		mat.m5 * mat.m11 * mat.m12 +
-		mat.m7 * mat.m8 * mat.m13 -
-		mat.m4 * mat.m11 * mat.m13 -
-		mat.m5 * mat.m8 * mat.m15 -
-		mat.m7 * mat.m9 * mat.m12
-	) * inv;
-	q_float m9 = (
-		mat.m0 * mat.m11 * mat.m13 +
-		mat.m1 * mat.m8 * mat.m15 +
-		mat.m3 * mat.m9 * mat.m12 -
-		mat.m0 * mat.m9 * mat.m15 -
-		mat.m1 * mat.m11 * mat.m12 -
-		mat.m3 * mat.m8 * mat.m13
-	) * inv;
-	q_float m10 = (
-		mat.m0 * mat.m5 * mat.m15 +
-		mat.m1 * mat.m7 * mat.m12 +
-		mat.m3 * mat.m4 * mat.m13 -
-		mat.m0 * mat.m7 * mat.m13 -
-		mat.m1 * mat.m4 * mat.m15 -
-		mat.m3 * mat.m5 * mat.m12
-	) * inv;
-	q_float m11 = (
-		mat.m0 * mat.m7 * mat.m9 +
-		mat.m1 * mat.m4 * mat.m11 +
-		mat.m3 * mat.m5 * mat.m8 -
-		mat.m0 * mat.m5 * mat.m11 -
-		mat.m1 * mat.m7 * mat.m8 -
-		mat.m3 * mat.m4 * mat.m9
-	) * inv;
-	q_float m12 = (
-		mat.m5 * mat.m10 * mat.m13 +
-		mat.m6 * mat.m8 * mat.m14 +
-		mat.m7 * mat.m9 * mat.m12 -
-		mat.m5 * mat.m9 * mat.m14 -
-		mat.m6 * mat.m10 * mat.m12 -
-		mat.m7 * mat.m8 * mat.m13
-	) * inv;
-	q_float m13 = (
-		mat.m0 * mat.m9 * mat.m14 +
-		mat.m1 * mat.m10 * mat.m12 +
-		mat.m2 * mat.m8 * mat.m13 -
-		mat.m0 * mat.m10 * mat.m13 -
-		mat.m1 * mat.m8 * mat.m14 -
-		mat.m2 * mat.m9 * mat.m12
-	) * inv;
-	q_float m14 = (
-		mat.m2 * mat.m5 * mat.m12 +
-		mat.m0 * mat.m6 * mat.m13 +
-		mat.m1 * mat.m4 * mat.m14 -
-		mat.m1 * mat.m6 * mat.m12 -
-		mat.m2 * mat.m4 * mat.m13 -
-		mat.m0 * mat.m5 * mat.m14
-	) * inv;
-	q_float m15 = (
-		mat.m0 * mat.m5 * mat.m10 +
-		mat.m1 * mat.m6 * mat.m8 +
-		mat.m2 * mat.m4 * mat.m9 -
-		mat.m0 * mat.m6 * mat.m9 -
-		mat.m1 * mat.m4 * mat.m10 -
-		mat.m2 * mat.m5 * mat.m8
-	) * inv;
-
-	q_matrix44 result = {
-		m0, m4, m8, m12,
-		m1, m5, m9, m13,
-		m2, m6, m10, m14,
-		m3, m7, m11, m15
-	};
-	return result;
-}
-
-// Translation matrix
-QM_API q_matrix44 qmMatrix44Translate(q_float x, q_float y, q_float z)
-{
-	q_matrix44 result = {
-		1.0f, 0.0f, 0.0f, x,
-		0.0f, 1.0f, 0.0f, y,
-		0.0f, 0.0f, 1.0f, z,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Rotation by given axis matrix
-QM_API q_matrix44 qmMatrix44Rotate(q_vector3 axis, q_float angle)
-{
-	q_float alen = sqrtf(sqf(axis.x) + sqf(axis.y) + sqf(axis.z)); // qmVector3Length(axis)
-	if (alen > 0.0f) // qmVector3DivideScalar(axis, alen)
-	{
-		axis.x /= alen;
-		axis.y /= alen;
-		axis.z /= alen;
-	}
-
-	q_float s = sinf(angle);
-	q_float c = cosf(angle);
-	q_float t = 1.0f - c;
-
-	q_matrix44 result = {
-		axis.x * axis.x * t + c, axis.y * axis.x * t + axis.z * s, axis.z * axis.x * t - axis.y * s, 0.0f,
-		axis.x * axis.y * t - axis.z * s, axis.y * axis.y * t + c, axis.z * axis.y * t - axis.x * s, 0.0f,
-		axis.x * axis.z * t + axis.y * s, axis.y * axis.z * t - axis.x * s, axis.z * axis.z * t + c, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Rotation by x-axis matrix
-QM_API q_matrix44 qmMatrix44RotateX(q_float angle)
-{
-	q_float s = sinf(angle);
-	q_float c = cosf(angle);
-
-	q_matrix44 result = {
-		1.0f, 0.0f, 0.0f, 0.0f,
-		0.0f, c, -s, 0.0f,
-		0.0f, s, c, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Rotation by y-axis matrix
-QM_API q_matrix44 qmMatrix44RotateY(q_float angle)
-{
-	q_float s = sinf(angle);
-	q_float c = cosf(angle);
-
-	q_matrix44 result = {
-		c, 0.0f, s, 0.0f,
-		0.0f, 1.0f, 0.0f, 0.0f,
-		-s, 0.0f, c, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Rotation by z-axis matrix
-QM_API q_matrix44 qmMatrix44RotateZ(q_float angle)
-{
-	q_float s = sinf(angle);
-	q_float c = cosf(angle);
-
-	q_matrix44 result = {
-		c, -s, 0.0f, 0.0f,
-		s, c, 0.0f, 0.0f,
-		0.0f, 0.0f, 1.0f, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Rotation by angle vector matrix
-QM_API q_matrix44 qmMatrix44RotateXYZ(q_vector3 angle)
-{
-	q_float sx = sinf(angle.x);
-	q_float cx = cosf(angle.x);
-	q_float sy = sinf(angle.y);
-	q_float cy = cosf(angle.y);
-	q_float sz = sinf(angle.z);
-	q_float cz = cosf(angle.z);
-
-	q_matrix44 result = {
-		cy * cz, cy * sz, -sy, 0.0f,
-		sx * sy * cz - cx * sz, sx * sy * sz + cx * cz, sx * cy, 0.0f,
-		cx * sy * cz + sx * sz, cx * sy * sz - sx * cz, cx * cy, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Scaling matrix
-QM_API q_matrix44 qmMatrix44Scale(q_float x, q_float y, q_float z)
-{
-	q_matrix44 result = {
-		x, 0.0f, 0.0f, 0.0f,
-		0.0f, y, 0.0f, 0.0f,
-		0.0f, 0.0f, z, 0.0f,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Frustum matrix
-QM_API q_matrix44 qmMatrix44Frustum(q_float left, q_float right, q_float top, q_float bottom, q_float near, q_float far)
-{
-	q_float dx = right - left;
-	q_float dy = top - bottom;
-	q_float dz = far - near;
-
-	q_matrix44 result = {
-		near * 2.0f / dx, 0.0f, (left + right) / dx, 0.0f,
-		0.0f, near * 2.0f / dy, (top + bottom) / dy, 0.0f,
-		0.0f, 0.0f, -(near + far) / dz, -near * far * 2.0f / dz,
-		0.0f, 0.0f, -1.0f, 0.0f
-	};
-	return result;
-}
-
-// Perspective projection matrix
-QM_API q_matrix44 qmMatrix44Perspective(q_float fov, q_float aspect, q_float near, q_float far)
-{
-	q_float top = near * tan(fov * 0.5f);
-	q_float bottom = -top;
-	q_float right = top * aspect;
-	q_float left = -right;
-
-	// qmMatrix44Frustum(left, right, top, bottom, near, far)
-	q_float dx = right - left;
-	q_float dy = top - bottom;
-	q_float dz = far - near;
-
-	q_matrix44 result = {
-		near * 2.0f / dx, 0.0f, (left + right) / dx, 0.0f,
-		0.0f, near * 2.0f / dy, (top + bottom) / dy, 0.0f,
-		0.0f, 0.0f, -(near + far) / dz, -near * far * 2.0f / dz,
-		0.0f, 0.0f, -1.0f, 0.0f
-	};
-	return result;
-}
-
-// Orthographic projection matrix
-QM_API q_matrix44 qmMatrix44Orthographic(q_float left, q_float right, q_float top, q_float bottom, q_float near, q_float far)
-{
-	q_float dx = right - left;
-	q_float dy = top - bottom;
-	q_float dz = far - near;
-
-	q_matrix44 result = {
-		2.0f / dx, 0.0f, 0.0f, -(left + right) / dx,
-		0.0f, 2.0f / dy, 0.0f, -(top + bottom) / dy,
-		0.0f, 0.0f, -2.0f / dz, -(near + far) / dz,
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Camera look-at matrix
-QM_API q_matrix44 qmMatrix44LookAt(q_vector3 source, q_vector3 target, q_vector3 up)
-{
-	q_float len = 0.0f;
-
-	q_vector3 vz = { source.x - target.x, source.y - target.y, source.z - target.z }; // qmVector3Subtract(source, target)
-
-	// qmVector3Normalize(vz)
-	len = sqrtf(sqf(vz.x) + sqf(vz.y) + sqf(vz.z));
-	if (len > 0.0f)
-	{
-		vz.x /= len;
-		vz.y /= len;
-		vz.z /= len;
-	}
-
-	q_vector3 vx = { up.y * vz.z - up.z * vz.y, up.z * vz.x - up.x * vz.z, up.x * vz.y - up.y * vz.x }; // qmVector3CrossProduct(up, vz)
-
-	// qmVector3Normalize(vx)
-	len = sqrtf(sqf(vx.x) + sqf(vx.y) + sqf(vx.z));
-	if (len > 0.0f)
-	{
-		vx.x /= len;
-		vx.y /= len;
-		vx.z /= len;
-	}
-
-	q_vector3 vy = { vz.y * vx.z - vz.z * vx.y, vz.z * vx.x - vz.x * vx.z, vz.x * vx.y - vz.y * vx.x }; // qmVector3CrossProduct(vz, vx)
-
-	q_matrix44 result = {
-		vx.x, vx.y, vx.z, -(vx.x * source.x + vx.y * source.y + vx.z * source.z), // qmVector3DotProduct(vx, source)
-		vy.x, vy.y, vy.z, -(vy.x * source.x + vy.y * source.y + vy.z * source.z), // qmVector3DotProduct(vy, source)
-		vz.x, vz.y, vz.z, -(vz.x * source.x + vz.y * source.y + vz.z * source.z), // qmVector3DotProduct(vz, source)
-		0.0f, 0.0f, 0.0f, 1.0f
-	};
-	return result;
-}
-
-// Determinant function
-QM_API q_float qmMatrix44Determinant(q_matrix44 mat)
-{
-	return (
-		mat.m0 * mat.m5 * mat.m10 * mat.m15 +
-		mat.m0 * mat.m6 * mat.m11 * mat.m13 +
-		mat.m0 * mat.m7 * mat.m9 * mat.m14 +
-		mat.m1 * mat.m4 * mat.m11 * mat.m14 +
-		mat.m1 * mat.m6 * mat.m8 * mat.m15 +
-		mat.m1 * mat.m7 * mat.m10 * mat.m12 +
-		mat.m2 * mat.m4 * mat.m9 * mat.m15 +
-		mat.m2 * mat.m5 * mat.m11 * mat.m12 +
-		mat.m2 * mat.m7 * mat.m8 * mat.m13 +
-		mat.m3 * mat.m4 * mat.m10 * mat.m13 +
-		mat.m3 * mat.m5 * mat.m8 * mat.m14 +
-		mat.m3 * mat.m6 * mat.m9 * mat.m12 -
-		mat.m0 * mat.m5 * mat.m11 * mat.m14 -
-		mat.m0 * mat.m6 * mat.m9 * mat.m15 -
-		mat.m0 * mat.m7 * mat.m10 * mat.m13 -
-		mat.m1 * mat.m4 * mat.m10 * mat.m15 -
-		mat.m1 * mat.m6 * mat.m11 * mat.m12 -
-		mat.m1 * mat.m7 * mat.m8 * mat.m14 -
-		mat.m2 * mat.m4 * mat.m11 * mat.m13 -
-		mat.m2 * mat.m5 * mat.m8 * mat.m15 -
-		mat.m2 * mat.m7 * mat.m9 * mat.m12 -
-		mat.m3 * mat.m4 * mat.m9 * mat.m14 -
-		mat.m3 * mat.m5 * mat.m10 * mat.m12 -
-		mat.m3 * mat.m6 * mat.m8 * mat.m13
-	);
-}
-
-// Trace function
-QM_API q_float qmMatrix44Trace(q_matrix44 mat)
-{
-	return mat.m0 + mat.m5 + mat.m10 + mat.m15;
-}
-
-// Equal function
-QM_API q_bool qmMatrix44Equal(q_matrix44 left, q_matrix44 right)
-{
-	return Q_BOOL(
-		equalf(left.m0, right.m0) &&
-		equalf(left.m1, right.m1) &&
-		equalf(left.m2, right.m2) &&
-		equalf(left.m3, right.m3) &&
-		equalf(left.m4, right.m4) &&
-		equalf(left.m5, right.m5) &&
-		equalf(left.m6, right.m6) &&
-		equalf(left.m7, right.m7) &&
-		equalf(left.m8, right.m8) &&
-		equalf(left.m9, right.m9) &&
-		equalf(left.m10, right.m10) &&
-		equalf(left.m11, right.m11) &&
-		equalf(left.m12, right.m12) &&
-		equalf(left.m13, right.m13) &&
-		equalf(left.m14, right.m14) &&
-		equalf(left.m15, right.m15)
-	);
-}
-
-//// Quaternion functions ////
-
-// Identity function
-QM_API q_quaternion qmQuaternionIdentity(q_void)
-{
-	q_quaternion result = {0.0f, 0.0f, 0.0f, 1.0f};
-	return result;
-}
-
-// Add function
-QM_API q_quaternion qmQuaternionAdd(q_quaternion left, q_quaternion right)
-{
-	q_quaternion result = {
-		left.x + right.x,
-		left.y + right.y,
-		left.z + right.z,
-		left.w + right.w
-	};
-	return result;
-}
-
-// Scalar add function
-QM_API q_quaternion qmQuaternionAddScalar(q_quaternion quat, q_float scl)
-{
-	q_quaternion result = {
-		quat.x + scl,
-		quat.y + scl,
-		quat.z + scl,
-		quat.w + scl
-	};
-	return result;
-}
-
-// Subtract function
-QM_API q_quaternion qmQuaternionSubtract(q_quaternion left, q_quaternion right)
-{
-	q_quaternion result = {
-		left.x - right.x,
-		left.y - right.y,
-		left.z - right.z,
-		left.w - right.w
-	};
-	return result;
-}
-
-// Scalar subtract function
-QM_API q_quaternion qmQuaternionSubtractScalar(q_quaternion quat, q_float scl)
-{
-	q_quaternion result = {
-		quat.x - scl,
-		quat.y - scl,
-		quat.z - scl,
-		quat.w - scl
-	};
-	return result;
-}
-
-// Multiply function
-QM_API q_quaternion qmQuaternionMultiply(q_quaternion left, q_quaternion right)
-{
-	q_quaternion result = {
-		left.x * right.w + left.w * right.x + left.y * right.z - left.z * right.y,
-		left.y * right.w + left.w * right.y + left.z * right.x - left.x * right.z,
-		left.z * right.w + left.w * right.z + left.x * right.y - left.y * right.x,
-		left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z
-	};
-	return result;
-}
-
-// Scale function
-QM_API q_quaternion qmQuaternionScale(q_quaternion quat, q_float scl)
-{
-	q_quaternion result = {
-		quat.x * scl,
-		quat.y * scl,
-		quat.z * scl,
-		quat.w * scl
-	};
-	return result;
-}
-
-// Divide function
-QM_API q_quaternion qmQuaternionDivide(q_quaternion left, q_quaternion right)
-{
-	q_quaternion result = {
-		left.x / right.x,
-		left.y / right.y,
-		left.z / right.z,
-		left.w / right.w
-	};
-	return result;
-}
-
-// Normalize function
-QM_API q_quaternion qmQuaternionNormalize(q_quaternion quat)
-{
-	q_float length = sqrt(sqf(quat.x) + sqf(quat.y) + sqf(quat.z) + sqf(quat.w)); // qmQuaternionLength(quat)
-	if (length == 0.0f)
-	{
-		return quat;
-	}
-
-	q_quaternion result = { // qmQuaternionScale(quat, 1 / length)
-		quat.x / length,
-		quat.y / length,
-		quat.z / length,
-		quat.w / length
-	};
-	return result;
-}
-
-// Invert function
-QM_API q_quaternion qmQuaternionInvert(q_quaternion quat)
-{
-	q_float length = sqrt(sqf(quat.x) + sqf(quat.y) + sqf(quat.z) + sqf(quat.w)); // qmQuaternionLength(quat)
-	if (length == 0.0f)
-	{
-		return quat;
-	}
+// Array functions transform count vectors with the matrix held in registers. With stream set,
+// results are written with non-temporal stores when the output is 16-byte aligned. The matrix
+// array variant uses mat[index[i]] for element i, or mat[i] when index is null.
+Q_API q_void qmMatrix44MultiplyVector4Array(q_vector4 *result, q_matrix44 mat, const q_vector4 *vec, q_uint count, q_bool stream);
+Q_API q_void qmMatrix44ArrayMultiplyVector4Array(q_vector4 *result, const q_matrix44 *mat, const q_uint *index, const q_vector4 *vec, q_uint count, q_bool stream);
 
-	q_quaternion result = { // qmQuaternionScale(quat, -1 / length)
-		-quat.x / length,
-		-quat.y / length,
-		-quat.z / length,
-		-quat.w / length
-	};
-	return result;
-}
+//// Quaternion array functions ////
 
-// Linear interpolation function
-QM_API q_quaternion qmQuaternionLerp(q_float value, q_quaternion start, q_quaternion end)
-{
-	q_quaternion result = {
-		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
-		start.y + value * (end.y - start.y), // qmFloatLerp(value, start.y, end.y)
-		start.z + value * (end.z - start.z), // qmFloatLerp(value, start.z, end.z)
-		start.w + value * (end.w - start.w)  // qmFloatLerp(value, start.w, end.w)
-	};
-	return result;
-}
+// Rotate count vectors by a unit quaternion as qmQuaternionRotateVector3 does. The result may
+// alias the input exactly.
+Q_API q_void qmQuaternionRotateVector3Array(q_vector3 *result, q_quaternion quat, const q_vector3 *vec, q_uint count);
 
-// Normalized linear interpolation function
-QM_API q_quaternion qmQuaternionNlerp(q_float value, q_quaternion start, q_quaternion end)
-{
-	q_quaternion lerp = { // qmQuaternionLerp(value, start, end)
-		start.x + value * (end.x - start.x),
-		start.y + value * (end.y - start.y),
-		start.z + value * (end.z - start.z),
-		start.w + value * (end.w - start.w)
-	};
+//// Dual quaternion array functions ////
 
-	q_float length = sqrt(sqf(lerp.x) + sqf(lerp.y) + sqf(lerp.z) + sqf(lerp.w)); // qmQuaternionLength(lerp)
-	if (length == 0.0f)
-	{
-		return lerp;
-	}
+// Dual quaternion linear blend skinning of count vertices, each with influences entries in the
+// joint and weight arrays that index the pose. Weights should sum to one per vertex. Normals are
+// rotated when both normal pointers are set. Results may alias their inputs exactly.
+Q_API q_void qmDualQuatSkinVector3Array(q_vector3 *result, q_vector3 *normalResult, const q_vector3 *vec, const q_vector3 *normal, const q_dualquat *pose, const q_uint *joint, const q_float *weight, q_uint influences, q_uint count);
 
-	q_quaternion result = { // qmQuaternionScale(lerp, 1 / length)
-		lerp.x / length,
-		lerp.y / length,
-		lerp.z / length,
-		lerp.w / length
-	};
-	return result;
-}
+//// Frustum batch functions ////
 
-// Spherical linear interpolation function
-QM_API q_quaternion qmQuaternionSlerp(q_float value, q_quaternion start, q_quaternion end)
-{
-	float cosHalf = start.x * end.x + start.y * end.y + start.z * end.z + start.w * end.w;
-	if (cosHalf < 0.0f)
-	{
-		// qmQuaternionScale(end, -1)
-		end.x *= -1.0f;
-		end.y *= -1.0f;
-		end.z *= -1.0f;
-		end.w *= -1.0f;
+// Cull functions test count spheres or axis-aligned boxes held as structure-of-arrays centers
+// with radii or half extents, as qmFrustumIntersectsSphere and qmFrustumIntersectsAabb do. They
+// write the indices of the ones that intersect the frustum to visible in increasing order and
+// return how many there are, so visible needs room for the count of the center batch.
+Q_API q_uint qmFrustumCullSphereBatch(q_uint *visible, q_frustum frustum, q_vector3_batch center, const q_float *radius);
+Q_API q_uint qmFrustumCullAabbBatch(q_uint *visible, q_frustum frustum, q_vector3_batch center, q_vector3_batch extent);
 
-		cosHalf *= -1.0f;
-	}
-	if (fabsf(cosHalf) >= 1.0f)
-	{
-		return start;
-	}
+//// Bounding volume batch functions ////
 
-	float half = acosf(cosHalf);
-	float sinHalf = sqrtf(1.0f - sqf(cosHalf));
-	if (fabsf(sinHalf) < Q_EPSILON)
-	{
-		q_quaternion result = { // qmQuaternionLerp(0.5, start, end)
-			(start.x + end.x) * 0.5f,
-			(start.y + end.y) * 0.5f,
-			(start.z + end.z) * 0.5f,
-			(start.w + end.w) * 0.5f
-		};
-		return result;
-	}
-	else
-	{
-		float ra = sinf((1.0f - value) * half) / sinHalf;
-		float rb = sinf(value * half) / sinHalf;
-		q_quaternion result = {
-			start.x * ra + end.x * rb,
-			start.y * ra + end.y * rb,
-			start.z * ra + end.z * rb,
-			start.w * ra + end.w * rb
-		};
-		return result;
-	}
-}
+// Intersection batch functions test one volume against count others held as structure-of-arrays,
+// as the scalar intersection functions do. They write the indices of the ones hit to hit in
+// increasing order and return how many there are, so hit needs room for the count of the first
+// batch. The ray function also writes the entry distance of each hit when distance is set.
+Q_API q_uint qmAabbIntersectsAabbBatch(q_uint *hit, q_aabb aabb, q_vector3_batch min, q_vector3_batch max);
+Q_API q_uint qmSphereIntersectsSphereBatch(q_uint *hit, q_sphere sphere, q_vector3_batch center, const q_float *radius);
+Q_API q_uint qmObbIntersectsObbBatch(q_uint *hit, q_obb obb, q_obb_batch other);
+Q_API q_uint qmRayIntersectsAabbBatch(q_uint *hit, q_floatp distance, q_ray ray, q_vector3_batch min, q_vector3_batch max);
 
-// Length function
-QM_API q_float qmQuaternionLength(q_quaternion quat)
-{
-	return sqrtf(sqf(quat.x) + sqf(quat.y) + sqf(quat.z) + sqf(quat.w));
-}
+//// Kernel dispatch ////
 
-// Equal function
-QM_API q_bool qmQuaternionEqual(q_quaternion left, q_quaternion right)
-{
-	return Q_BOOL(
-		equalf(left.x, right.x) &&
-		equalf(left.y, right.y) &&
-		equalf(left.z, right.z) &&
-		equalf(left.w, right.w)
-	);
-}
+// Batch and array functions run the variant selected from CPUID at startup, or the one named
+// by the QUITE_MATH_ISA environment variable. Variants may round differently where they fuse
+// multiplies and adds. Wider variants are only built by GCC and Clang for x86.
+Q_API q_bool qmDispatchSupported(q_math_isa isa);
+Q_API q_math_isa qmDispatchGetIsa(q_void);
+Q_API q_bool qmDispatchSetIsa(q_math_isa isa);
+Q_API q_math_isa qmDispatchBestIsa(q_void);
+Q_API q_str qmDispatchIsaName(q_math_isa isa);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,4453 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qmathtemplate.h
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// No include guard, qmath.h includes this once per precision after defining:
+//   QMT_REAL                    scalar type
+//   QMT_TYPE(name)              vector, matrix or quaternion type
+//   QMT_FUNCTION(type, name)    function of a type
+//   QMT_SCALAR_FUNCTION(name)   function of the scalar type
+//   QMT_HELPER(name)            internal function
+//   QMT_MATH(name)              libm function
+//   QMT_EPSILON                 tolerance of the equal functions
+//   QMT_SIMD                    defined when the SIMD helpers below exist
+//   QMT_SIMD_TYPE               register type
+//   QMT_SIMD_OP(name)           register function
+//   QMT_SWIZZLE(v, x, y, z, w)  register swizzle
+// Float literals in this file are exact in both precisions.
+
+//// Internal functions ////
+
+// Square function
+QM_INTERNAL QMT_REAL QMT_HELPER(sq)(QMT_REAL x)
+{
+	return x * x;
+}
+
+// Cube function
+QM_INTERNAL QMT_REAL QMT_HELPER(cb)(QMT_REAL x)
+{
+	return x * x * x;
+}
+
+// Equal function
+QM_INTERNAL q_bool QMT_HELPER(equal)(QMT_REAL l, QMT_REAL r)
+{
+	return Q_BOOL(QMT_MATH(fabs)(l - r) <= QMT_MATH(fmax)(QMT_MATH(fmax)(QMT_MATH(fabs)(l), QMT_MATH(fabs)(r)), 1.0f) * QMT_EPSILON);
+}
+
+// Quaternion product function
+QM_INTERNAL QMT_TYPE(quaternion) QMT_HELPER(quatmul)(QMT_TYPE(quaternion) left, QMT_TYPE(quaternion) right)
+{
+	QMT_TYPE(quaternion) result = {
+		left.x * right.w + left.w * right.x + left.y * right.z - left.z * right.y,
+		left.y * right.w + left.w * right.y + left.z * right.x - left.x * right.z,
+		left.z * right.w + left.w * right.z + left.x * right.y - left.y * right.x,
+		left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z
+	};
+	return result;
+}
+
+//// Scalar functions ////
+
+// Clamp function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(Clamp)(QMT_REAL value, QMT_REAL min, QMT_REAL max)
+{
+	if (max < min)
+	{
+		return value;
+	}
+	return QMT_MATH(fmin)(QMT_MATH(fmax)(value, min), max);
+}
+
+// Wrap function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(Wrap)(QMT_REAL value, QMT_REAL min, QMT_REAL max)
+{
+	if (max <= min)
+	{
+		return value;
+	}
+	return value - (max - min) * QMT_MATH(floor)((value - min) / (max - min));
+}
+
+// Linear interpolate function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(Lerp)(QMT_REAL value, QMT_REAL start, QMT_REAL end)
+{
+	return start + value * (end - start);
+}
+
+// Normalize function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(Normalize)(QMT_REAL value, QMT_REAL start, QMT_REAL end)
+{
+	return (value - start) * (end - start);
+}
+
+// Remap function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(Remap)(QMT_REAL value, QMT_REAL inStart, QMT_REAL inEnd, QMT_REAL outStart, QMT_REAL outEnd)
+{
+	if (inStart == inEnd || outStart == outEnd)
+	{
+		return value;
+	}
+	return (value - inStart) * (outEnd - outStart) / (inEnd - inStart) + outStart;
+}
+
+// Reciprocal square root function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(InvSqrt)(QMT_REAL value)
+{
+	return QMT_HELPER(invsqrt)(value);
+}
+
+// Sine and cosine function
+QM_API q_void QMT_SCALAR_FUNCTION(SinCos)(QMT_REAL angle, QMT_REAL *sine, QMT_REAL *cosine)
+{
+	QMT_HELPER(sinecosine)(angle, sine, cosine);
+}
+
+// Arc cosine function
+QM_API QMT_REAL QMT_SCALAR_FUNCTION(Acos)(QMT_REAL value)
+{
+	return QMT_HELPER(arccosine)(value);
+}
+
+// Equal function
+QM_API q_bool QMT_SCALAR_FUNCTION(Equal)(QMT_REAL left, QMT_REAL right)
+{
+	return Q_BOOL(QMT_HELPER(equal)(left, right));
+}
+
+//// Vector2 functions ////
+
+// Zero vector function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Zero)(q_void)
+{
+	QMT_TYPE(vector2) result = {0.0f, 0.0f};
+	return result;
+}
+
+// One vector function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, One)(q_void)
+{
+	QMT_TYPE(vector2) result = {1.0f, 1.0f};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Add)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_TYPE(vector2) result = {
+		left.x + right.x,
+		left.y + right.y
+	};
+	return result;
+}
+
+// Scalar add function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, AddScalar)(QMT_TYPE(vector2) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector2) result = {
+		vec.x + scl,
+		vec.y + scl
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Subtract)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_TYPE(vector2) result = {
+		left.x - right.x,
+		left.y - right.y
+	};
+	return result;
+}
+
+// Scalar subtract function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, SubtractScalar)(QMT_TYPE(vector2) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector2) result = {
+		vec.x - scl,
+		vec.y - scl
+	};
+	return result;
+}
+
+// Multiply function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Multiply)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_TYPE(vector2) result = {
+		left.x * right.x,
+		left.y * right.y
+	};
+	return result;
+}
+
+// Scale function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Scale)(QMT_TYPE(vector2) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector2) result = {
+		vec.x * scl,
+		vec.y * scl
+	};
+	return result;
+}
+
+// Negate function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Negate)(QMT_TYPE(vector2) vec)
+{
+	QMT_TYPE(vector2) result = {
+		-vec.x,
+		-vec.y
+	};
+	return result;
+}
+
+// Divide function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Divide)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_TYPE(vector2) result = {
+		left.x / right.x,
+		left.y / right.y
+	};
+	return result;
+}
+
+// Scalar divide function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, DivideScalar)(QMT_TYPE(vector2) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector2) result = {
+		vec.x / scl,
+		vec.y / scl
+	};
+	return result;
+}
+
+// Normalize function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Normalize)(QMT_TYPE(vector2) vec)
+{
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y)); // qmVector2Length(vec)
+	if (length == 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector2) result = { // qmVector2DivideScale(vec, length)
+		vec.x / length,
+		vec.y / length
+	};
+	return result;
+}
+
+// Invert function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Invert)(QMT_TYPE(vector2) vec)
+{
+	QMT_TYPE(vector2) result = {
+		1.0f / vec.x,
+		1.0f / vec.y
+	};
+	return result;
+}
+
+// Minimum function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Min)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_TYPE(vector2) result = {
+		QMT_MATH(fmin)(left.x, right.x),
+		QMT_MATH(fmin)(left.y, right.y)
+	};
+	return result;
+}
+
+// Maximum function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Max)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_TYPE(vector2) result = {
+		QMT_MATH(fmax)(left.x, right.x),
+		QMT_MATH(fmax)(left.y, right.y)
+	};
+	return result;
+}
+
+// Clamp function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Clamp)(QMT_TYPE(vector2) vec, QMT_TYPE(vector2) min, QMT_TYPE(vector2) max)
+{
+	QMT_TYPE(vector2) result = {
+		max.x < min.x ? vec.x : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.x, min.x), max.x), // qmFloatClamp(vec.x, min.x, max.x)
+		max.y < min.y ? vec.y : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.y, min.y), max.y)  // qmFloatClamp(vec.y, min.y, max.y)
+	};
+	return result;
+}
+
+// Clamp on vector magnitude function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, ClampMag)(QMT_TYPE(vector2) vec, QMT_REAL min, QMT_REAL max)
+{
+	if (max < min)
+	{
+		return vec;
+	}
+
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y)); // qmVector2Length(vec)
+	if (length == 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_REAL scl = 1.0f;
+	if (length < min)
+	{
+		scl = min / length;
+	}
+	if (length > max)
+	{
+		scl = max / length;
+	}
+
+	QMT_TYPE(vector2) result = { // qmVector2Scale(vec, scl)
+		vec.x * scl,
+		vec.y * scl
+	};
+	return result;
+}
+
+// Linear interpolation function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Lerp)(QMT_REAL value, QMT_TYPE(vector2) start, QMT_TYPE(vector2) end)
+{
+	QMT_TYPE(vector2) result = {
+		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
+		start.y + value * (end.y - start.y)  // qmFloatLerp(value, start.y, end.y)
+	};
+	return result;
+}
+
+// Reflection function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Reflect)(QMT_TYPE(vector2) vec, QMT_TYPE(vector2) normal)
+{
+	QMT_REAL dot = vec.x * normal.x + vec.y * normal.y; // qmVector2DotProduct(vec, normal)
+
+	QMT_TYPE(vector2) result = {
+		vec.x - normal.x * 2.0f * dot,
+		vec.y - normal.y * 2.0f * dot
+	};
+	return result;
+}
+
+// Refraction function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Refract)(QMT_TYPE(vector2) vec, QMT_TYPE(vector2) normal, QMT_REAL index)
+{
+	QMT_REAL dot = vec.x * normal.x + vec.y * normal.y; // qmVector2DotProduct(vec, normal)
+	QMT_REAL diff = 1.0f - QMT_HELPER(sq)(index) * (1.0f - QMT_HELPER(sq)(dot));
+	if (diff < 0)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector2) result = {
+		vec.x * index - normal.x * (dot * index + QMT_MATH(sqrt)(diff)),
+		vec.y * index - normal.y * (dot * index + QMT_MATH(sqrt)(diff))
+	};
+	return result;
+}
+
+// Move function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Move)(QMT_TYPE(vector2) vec, QMT_TYPE(vector2) target, QMT_REAL dist)
+{
+	if (dist <= 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_REAL cdist = QMT_MATH(sqrt)(QMT_HELPER(sq)(target.x - vec.x) + QMT_HELPER(sq)(target.y - vec.y)); // qmVector2Distance(target, vec)
+	if (cdist > dist)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector2) result = {
+		vec.x + dist / cdist * (target.x - vec.x),
+		vec.y + dist / cdist * (target.y - vec.y)
+	};
+	return result;
+}
+
+// Rotate function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Vector2, Rotate)(QMT_TYPE(vector2) vec, QMT_REAL angle)
+{
+	QMT_REAL sin, cos;
+	QMT_HELPER(sinecosine)(angle, &sin, &cos);
+
+	QMT_TYPE(vector2) result = {
+		vec.x * cos - vec.y * sin,
+		vec.x * sin + vec.y * cos
+	};
+	return result;
+}
+
+// Length function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, Length)(QMT_TYPE(vector2) vec)
+{
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y));
+}
+
+// Squared length function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, LengthSq)(QMT_TYPE(vector2) vec)
+{
+	return QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y);
+}
+
+// Dot product function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, DotProduct)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	return left.x * right.x + left.y * right.y;
+}
+
+// Distance function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, Distance)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(left.x - right.x) + QMT_HELPER(sq)(left.y - right.y));
+}
+
+// Squared distance function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, DistanceSq)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	return QMT_HELPER(sq)(left.x - right.x) + QMT_HELPER(sq)(left.y - right.y);
+}
+
+// Angle function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, Angle)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	QMT_REAL det = left.x * right.y - left.y * right.x;
+	QMT_REAL dot = left.x * right.x + left.y * right.y; // qmVector2DotProduct(left, right)
+	return QMT_MATH(atan2)(det, dot);
+}
+
+// Line angle function
+QM_API QMT_REAL QMT_FUNCTION(Vector2, LineAngle)(QMT_TYPE(vector2) start, QMT_TYPE(vector2) end)
+{
+	return -QMT_MATH(atan2)(end.y - start.y, end.x - start.x);
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Vector2, Equal)(QMT_TYPE(vector2) left, QMT_TYPE(vector2) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.x, right.x) &&
+		QMT_HELPER(equal)(left.y, right.y)
+	);
+}
+
+//// Vector3 functions ////
+
+// Zero vector function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Zero)(q_void)
+{
+	QMT_TYPE(vector3) result = {0.0f, 0.0f, 0.0f};
+	return result;
+}
+
+// One vector function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, One)(q_void)
+{
+	QMT_TYPE(vector3) result = {1.0f, 1.0f, 1.0f};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Add)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		left.x + right.x,
+		left.y + right.y,
+		left.z + right.z
+	};
+	return result;
+}
+
+// Scalar add function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, AddScalar)(QMT_TYPE(vector3) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector3) result = {
+		vec.x + scl,
+		vec.y + scl,
+		vec.z + scl
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Subtract)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		left.x - right.x,
+		left.y - right.y,
+		left.z - right.z
+	};
+	return result;
+}
+
+// Scalar subtract function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, SubtractScalar)(QMT_TYPE(vector3) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector3) result = {
+		vec.x - scl,
+		vec.y - scl,
+		vec.z - scl
+	};
+	return result;
+}
+
+// Multiply function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Multiply)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		left.x * right.x,
+		left.y * right.y,
+		left.z * right.z
+	};
+	return result;
+}
+
+// Scale function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Scale)(QMT_TYPE(vector3) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector3) result = {
+		vec.x * scl,
+		vec.y * scl,
+		vec.z * scl
+	};
+	return result;
+}
+
+// Negate function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Negate)(QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(vector3) result = {
+		-vec.x,
+		-vec.y,
+		-vec.z
+	};
+	return result;
+}
+
+// Divide function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Divide)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		left.x / right.x,
+		left.y / right.y,
+		left.z / right.z
+	};
+	return result;
+}
+
+// Scalar divide function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, DivideScalar)(QMT_TYPE(vector3) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector3) result = {
+		vec.x / scl,
+		vec.y / scl,
+		vec.z / scl
+	};
+	return result;
+}
+
+// Normalize function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Normalize)(QMT_TYPE(vector3) vec)
+{
+#if defined(Q_MATH_FAST)
+	QMT_REAL squared = QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z);
+	if (squared == 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_REAL inv = QMT_HELPER(invsqrt)(squared);
+	QMT_TYPE(vector3) result = { // qmVector3Scale(vec, inv)
+		vec.x * inv,
+		vec.y * inv,
+		vec.z * inv
+	};
+	return result;
+#else
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z)); // qmVector3Length(vec)
+	if (length == 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector3) result = { // qmVector3DivideScale(vec, length)
+		vec.x / length,
+		vec.y / length,
+		vec.z / length
+	};
+	return result;
+#endif /* Q_MATH_FAST */
+}
+
+// Orthonormalize function
+QM_API q_void QMT_FUNCTION(Vector3, Orthonormalize)(QMT_TYPE(vector3) *left, QMT_TYPE(vector3) *right)
+{
+	QMT_TYPE(vector3) vec = *left;
+	QMT_REAL len = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z)); // qmVector3Length(vec)
+	if (len > 0.0f) // qmVector3DivideScale(left, len)
+	{
+		left->x /= len;
+		left->y /= len;
+		left->z /= len;
+	}
+
+	QMT_TYPE(vector3) lcross = { // qmVector3CrossProduct(left, right)
+		left->y * right->z - left->z * right->y,
+		left->z * right->x - left->x * right->z,
+		left->x * right->y - left->y * right->x
+	};
+	vec = lcross;
+	len = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z)); // qmVector3Length(vec)
+	if (len > 0.0f) // qmVector3DivideScale(lcross, len)
+	{
+		lcross.x /= len;
+		lcross.y /= len;
+		lcross.z /= len;
+	}
+
+	QMT_TYPE(vector3) rcross = { // qmVector3CrossProduct(lcross, left)
+		lcross.y * left->z - lcross.z * left->y,
+		lcross.z * left->x - lcross.x * left->z,
+		lcross.x * left->y - lcross.y * left->x
+	};
+	*right = rcross;
+}
+
+// Invert function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Invert)(QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(vector3) result = {
+		1.0f / vec.x,
+		1.0f / vec.y,
+		1.0f / vec.z
+	};
+	return result;
+}
+
+// Minimum function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Min)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		QMT_MATH(fmin)(left.x, right.x),
+		QMT_MATH(fmin)(left.y, right.y),
+		QMT_MATH(fmin)(left.z, right.z)
+	};
+	return result;
+}
+
+// Maximum function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Max)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		QMT_MATH(fmax)(left.x, right.x),
+		QMT_MATH(fmax)(left.y, right.y),
+		QMT_MATH(fmax)(left.z, right.z)
+	};
+	return result;
+}
+
+// Clamp function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Clamp)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) min, QMT_TYPE(vector3) max)
+{
+	QMT_TYPE(vector3) result = {
+		max.x < min.x ? vec.x : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.x, min.x), max.x), // qmFloatClamp(vec.x, min.x, max.x)
+		max.y < min.y ? vec.y : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.y, min.y), max.y), // qmFloatClamp(vec.y, min.y, max.y)
+		max.z < min.z ? vec.z : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.z, min.z), max.z)  // qmFloatClamp(vec.z, min.z, max.z)
+	};
+	return result;
+}
+
+// Clamp on vector magnitude function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, ClampMag)(QMT_TYPE(vector3) vec, QMT_REAL min, QMT_REAL max)
+{
+	if (max < min)
+	{
+		return vec;
+	}
+
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z)); // qmVector3Length(vec)
+	if (length <= 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_REAL scl = 1.0f;
+	if (length < min)
+	{
+		scl = min / length;
+	}
+	if (length > max)
+	{
+		scl = max / length;
+	}
+
+	QMT_TYPE(vector3) result = { // qmVector3Scale(vec, scl)
+		vec.x * scl,
+		vec.y * scl,
+		vec.z * scl
+	};
+	return result;
+}
+
+// Linear interpolation function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Lerp)(QMT_REAL value, QMT_TYPE(vector3) start, QMT_TYPE(vector3) end)
+{
+	QMT_TYPE(vector3) result = {
+		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
+		start.y + value * (end.y - start.y), // qmFloatLerp(value, start.y, end.y)
+		start.z + value * (end.z - start.z)  // qmFloatLerp(value, start.z, end.z)
+	};
+	return result;
+}
+
+// Cubic hermite interpolation function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, CubicHermite)(QMT_REAL value, QMT_TYPE(vector3) left, QMT_TYPE(vector3) ltan, QMT_TYPE(vector3) right, QMT_TYPE(vector3) rtan)
+{
+	QMT_REAL p0 = QMT_HELPER(cb)(value) * 2.0f - QMT_HELPER(sq)(value) * 3.0f + 1.0f;
+	QMT_REAL p1 = QMT_HELPER(cb)(value) - QMT_HELPER(sq)(value) * 2.0f + value;
+	QMT_REAL p2 = QMT_HELPER(cb)(value) * -2.0f + QMT_HELPER(sq)(value) * 3.0f;
+	QMT_REAL p3 = QMT_HELPER(cb)(value) - QMT_HELPER(sq)(value);
+
+	QMT_TYPE(vector3) result = {
+		p0 * left.x + p1 * ltan.x + p2 * right.x + p3 * rtan.x,
+		p0 * left.y + p1 * ltan.y + p2 * right.y + p3 * rtan.y,
+		p0 * left.z + p1 * ltan.z + p2 * right.z + p3 * rtan.z,
+	};
+	return result;
+}
+
+// Cross product function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, CrossProduct)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) result = {
+		left.y * right.z - left.z * right.y,
+		left.z * right.x - left.x * right.z,
+		left.x * right.y - left.y * right.x
+	};
+	return result;
+}
+
+// Perpendicular function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Perpendicular)(QMT_TYPE(vector3) vec)
+{
+	QMT_REAL min = QMT_MATH(fabs)(vec.x);
+	QMT_TYPE(vector3) axis = {1.0f, 0.0f, 0.0f};
+	if (QMT_MATH(fabs)(vec.y) < min)
+	{
+		QMT_TYPE(vector3) a = {0.0f, 1.0f, 0.0f};
+		min = QMT_MATH(fabs)(vec.y);
+		axis = a;
+	}
+	if (QMT_MATH(fabs)(vec.z) < min)
+	{
+		QMT_TYPE(vector3) a = {0.0f, 0.0f, 1.0f};
+		axis = a;
+	}
+
+	QMT_TYPE(vector3) result = { // qmVector3CrossProduct(vec, axis)
+		vec.y * axis.z - vec.z * axis.y,
+		vec.z * axis.x - vec.x * axis.z,
+		vec.x * axis.y - vec.y * axis.x
+	};
+	return result;
+}
+
+// Barycenter function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Barycenter)(QMT_TYPE(vector3) plane, QMT_TYPE(vector3) v1, QMT_TYPE(vector3) v2, QMT_TYPE(vector3) v3)
+{
+	QMT_TYPE(vector3) s1 = { // qmVector3Subtract(v2, v1)
+		v2.x - v1.x,
+		v2.y - v1.y,
+		v2.z - v1.z
+	};
+	QMT_TYPE(vector3) s2 = { // qmVector3Subtract(v3, v1)
+		v3.x - v1.x,
+		v3.y - v1.y,
+		v3.z - v1.z
+	};
+	QMT_TYPE(vector3) s3 = { // qmVector3Subtract(plane, v1)
+		plane.x - v1.x,
+		plane.y - v1.y,
+		plane.z - v1.z
+	};
+
+	QMT_REAL fs1 = QMT_HELPER(sq)(s1.x) + QMT_HELPER(sq)(s1.y) + QMT_HELPER(sq)(s1.z);       // qmVector3DistanceSq(s1)
+	QMT_REAL fs2 = QMT_HELPER(sq)(s2.x) + QMT_HELPER(sq)(s2.y) + QMT_HELPER(sq)(s2.z);       // qmVector3DistanceSq(s2)
+	QMT_REAL dot = s1.x * s2.x + s1.y * s2.y + s1.z * s2.z; // qmVector3DotProduct(s1, s2)
+	QMT_REAL dp1 = s1.x * s3.x + s1.y * s3.y + s1.z * s3.z; // qmVector3DotProduct(s1, s3)
+	QMT_REAL dp2 = s2.x * s3.x + s2.y * s3.y + s2.z * s3.z; // qmVector3DotProduct(s2, s3)
+
+	QMT_REAL y = (fs2 * dp1 - dot * dp2) / (fs1 * fs2 - QMT_HELPER(sq)(dot));
+	QMT_REAL z = (fs1 * dp2 - dot * dp1) / (fs1 * fs2 - QMT_HELPER(sq)(dot));
+	QMT_TYPE(vector3) result = {
+		1.0f - y - z,
+		y,
+		z
+	};
+	return result;
+}
+
+// Reflection function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Reflect)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) normal)
+{
+	QMT_REAL dot = vec.x * normal.x + vec.y * normal.y + vec.z * normal.z; // qmVector3DotProduct(vec, normal)
+
+	QMT_TYPE(vector3) result = {
+		vec.x - normal.x * 2.0f * dot,
+		vec.y - normal.y * 2.0f * dot,
+		vec.z - normal.z * 2.0f * dot
+	};
+	return result;
+}
+
+// Refraction function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Refract)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) normal, QMT_REAL index)
+{
+	QMT_REAL dot = vec.x * normal.x + vec.y * normal.y + vec.z * normal.z; // qmVector3DotProduct(vec, normal)
+	QMT_REAL diff = 1.0f - QMT_HELPER(sq)(index) * (1.0f - QMT_HELPER(sq)(dot));
+	if (diff < 0)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector3) result = {
+		vec.x * index - normal.x * (dot * index + QMT_MATH(sqrt)(diff)),
+		vec.y * index - normal.y * (dot * index + QMT_MATH(sqrt)(diff)),
+		vec.z * index - normal.z * (dot * index + QMT_MATH(sqrt)(diff))
+	};
+	return result;
+}
+
+// Projection function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Project)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) target)
+{
+	QMT_REAL dot = vec.x * target.x + vec.y * target.y + vec.z * target.z; // qmVector3DotProduct(vec, target)
+	QMT_REAL len = QMT_HELPER(sq)(target.x) + QMT_HELPER(sq)(target.y) + QMT_HELPER(sq)(target.z);          // qmVector3LengthSq(target)
+	QMT_REAL mag = dot / len;
+
+	QMT_TYPE(vector3) result = { // qmVector3Scale(target, mag)
+		target.x * mag,
+		target.y * mag,
+		target.z * mag
+	};
+	return result;
+}
+
+// Rejection function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Reject)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) target)
+{
+	QMT_REAL dot = vec.x * target.x + vec.y * target.y + vec.z * target.z; // qmVector3DotProduct(vec, target)
+	QMT_REAL len = QMT_HELPER(sq)(target.x) + QMT_HELPER(sq)(target.y) + QMT_HELPER(sq)(target.z);          // qmVector3LengthSq(target)
+	QMT_REAL mag = dot / len;
+
+	QMT_TYPE(vector3) result = { // qmVector3Subtract(vec, qmVector3Scale(target, mag))
+		vec.x - target.x * mag,
+		vec.y - target.y * mag,
+		vec.z - target.z * mag
+	};
+	return result;
+}
+
+// Rotate by axis function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, RotateByAxis)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) axis, QMT_REAL angle)
+{
+	QMT_REAL alen = QMT_MATH(sqrt)(QMT_HELPER(sq)(axis.x) + QMT_HELPER(sq)(axis.y) + QMT_HELPER(sq)(axis.z)); // qmVector3Length(axis)
+	if (alen > 0.0f) // qmVector3DivideScalar(axis, alen)
+	{
+		axis.x /= alen;
+		axis.y /= alen;
+		axis.z /= alen;
+	}
+
+	angle /= 2.0f;
+	QMT_REAL a, c;
+	QMT_HELPER(sinecosine)(angle, &a, &c);
+	QMT_TYPE(vector3) w = { // qmVector3Scale(axis, a)
+		axis.x * a,
+		axis.y * a,
+		axis.z * a
+	};
+	a = c;
+
+	QMT_TYPE(vector3) cross = { // qmVector3CrossProduct(w, vec)
+		w.y * vec.z - w.z * vec.y,
+		w.z * vec.x - w.x * vec.z,
+		w.x * vec.y - w.y * vec.x
+	};
+	QMT_TYPE(vector3) dcross = { // qmVector3CrossProduct(w, cross)
+		w.y * cross.z - w.z * cross.y,
+		w.z * cross.x - w.x * cross.z,
+		w.x * cross.y - w.y * cross.x
+	};
+
+	QMT_TYPE(vector3) result = {
+		cross.x * 2.0f * a + dcross.x * 2.0f,
+		cross.y * 2.0f * a + dcross.y * 2.0f,
+		cross.z * 2.0f * a + dcross.z * 2.0f
+	};
+	return result;
+}
+
+// Move function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Vector3, Move)(QMT_TYPE(vector3) vec, QMT_TYPE(vector3) target, QMT_REAL dist)
+{
+	if (dist <= 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_REAL cdist = QMT_MATH(sqrt)(QMT_HELPER(sq)(target.x - vec.x) + QMT_HELPER(sq)(target.y - vec.y) + QMT_HELPER(sq)(target.z - vec.z)); // qmVector3Distance(target, vec)
+	if (cdist > dist)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector3) result = {
+		vec.x + dist / cdist * (target.x - vec.x),
+		vec.y + dist / cdist * (target.y - vec.y),
+		vec.z + dist / cdist * (target.z - vec.z)
+	};
+	return result;
+}
+
+// Length function
+QM_API QMT_REAL QMT_FUNCTION(Vector3, Length)(QMT_TYPE(vector3) vec)
+{
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z));
+}
+
+// Squared length function
+QM_API QMT_REAL QMT_FUNCTION(Vector3, LengthSq)(QMT_TYPE(vector3) vec)
+{
+	return QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z);
+}
+
+// Dot product function
+QM_API QMT_REAL QMT_FUNCTION(Vector3, DotProduct)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	return left.x * right.x + left.y * right.y + left.z * right.z;
+}
+
+// Distance function
+QM_API QMT_REAL QMT_FUNCTION(Vector3, Distance)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(left.x - right.x) + QMT_HELPER(sq)(left.y - right.y) + QMT_HELPER(sq)(left.z - right.z));
+}
+
+// Squared distance function
+QM_API QMT_REAL QMT_FUNCTION(Vector3, DistanceSq)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	return QMT_HELPER(sq)(left.x - right.x) + QMT_HELPER(sq)(left.y - right.y) + QMT_HELPER(sq)(left.z - right.z);
+}
+
+// Angle function
+QM_API QMT_REAL QMT_FUNCTION(Vector3, Angle)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	QMT_TYPE(vector3) cross = { // qmVector3CrossProduct(left, right)
+		left.y * right.z - left.z * right.y,
+		left.z * right.x - left.x * right.z,
+		left.x * right.y - left.y * right.x
+	};
+
+	QMT_REAL len = QMT_MATH(sqrt)(QMT_HELPER(sq)(cross.x) + QMT_HELPER(sq)(cross.y) + QMT_HELPER(sq)(cross.z));      // qmVector3Length(cross)
+	QMT_REAL dot = left.x * right.x + left.y * right.y + left.z * right.z; // qmVector3DotProduct(left, right)
+	return QMT_MATH(atan2)(len, dot);
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Vector3, Equal)(QMT_TYPE(vector3) left, QMT_TYPE(vector3) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.x, right.x) &&
+		QMT_HELPER(equal)(left.y, right.y) &&
+		QMT_HELPER(equal)(left.z, right.z)
+	);
+}
+
+//// Vector4 functions ////
+
+// Zero vector function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Zero)(q_void)
+{
+	QMT_TYPE(vector4) result = {0.0f, 0.0f, 0.0f, 0.0f};
+	return result;
+}
+
+// One vector function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, One)(q_void)
+{
+	QMT_TYPE(vector4) result = {1.0f, 1.0f, 1.0f, 1.0f};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Add)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(add)(QMT_SIMD_OP(load)(left), QMT_SIMD_OP(load)(right)));
+#else
+	QMT_TYPE(vector4) result = {
+		left.x + right.x,
+		left.y + right.y,
+		left.z + right.z,
+		left.w + right.w
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Scalar add function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, AddScalar)(QMT_TYPE(vector4) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector4) result = {
+		vec.x + scl,
+		vec.y + scl,
+		vec.z + scl,
+		vec.w + scl
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Subtract)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(sub)(QMT_SIMD_OP(load)(left), QMT_SIMD_OP(load)(right)));
+#else
+	QMT_TYPE(vector4) result = {
+		left.x - right.x,
+		left.y - right.y,
+		left.z - right.z,
+		left.w - right.w
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Scalar subtract function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, SubtractScalar)(QMT_TYPE(vector4) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector4) result = {
+		vec.x - scl,
+		vec.y - scl,
+		vec.z - scl,
+		vec.w - scl
+	};
+	return result;
+}
+
+// Multiply function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Multiply)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(mul)(QMT_SIMD_OP(load)(left), QMT_SIMD_OP(load)(right)));
+#else
+	QMT_TYPE(vector4) result = {
+		left.x * right.x,
+		left.y * right.y,
+		left.z * right.z,
+		left.w * right.w
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Scale function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Scale)(QMT_TYPE(vector4) vec, QMT_REAL scl)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(mul)(QMT_SIMD_OP(load)(vec), QMT_SIMD_OP(splat)(scl)));
+#else
+	QMT_TYPE(vector4) result = {
+		vec.x * scl,
+		vec.y * scl,
+		vec.z * scl,
+		vec.w * scl
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Negate function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Negate)(QMT_TYPE(vector4) vec)
+{
+	QMT_TYPE(vector4) result = {
+		-vec.x,
+		-vec.y,
+		-vec.z,
+		-vec.w
+	};
+	return result;
+}
+
+// Divide function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Divide)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+	QMT_TYPE(vector4) result = {
+		left.x / right.x,
+		left.y / right.y,
+		left.z / right.z,
+		left.w / right.w
+	};
+	return result;
+}
+
+// Scalar divide function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, DivideScalar)(QMT_TYPE(vector4) vec, QMT_REAL scl)
+{
+	QMT_TYPE(vector4) result = {
+		vec.x / scl,
+		vec.y / scl,
+		vec.z / scl,
+		vec.w / scl
+	};
+	return result;
+}
+
+// Normalize function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Normalize)(QMT_TYPE(vector4) vec)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE reg = QMT_SIMD_OP(load)(vec);
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_SIMD_OP(dot)(reg, reg)); // qmVector4Length(vec)
+	if (length == 0.0f)
+	{
+		return vec;
+	}
+
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(div)(reg, QMT_SIMD_OP(splat)(length))); // qmVector4DivideScale(vec, length)
+#else
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z) + QMT_HELPER(sq)(vec.w)); // qmVector4Length(vec)
+	if (length == 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector4) result = { // qmVector4DivideScale(vec, length)
+		vec.x / length,
+		vec.y / length,
+		vec.z / length,
+		vec.w / length
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Invert function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Invert)(QMT_TYPE(vector4) vec)
+{
+	QMT_TYPE(vector4) result = {
+		1.0f / vec.x,
+		1.0f / vec.y,
+		1.0f / vec.z,
+		1.0f / vec.w
+	};
+	return result;
+}
+
+// Minimum function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Min)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+	QMT_TYPE(vector4) result = {
+		QMT_MATH(fmin)(left.x, right.x),
+		QMT_MATH(fmin)(left.y, right.y),
+		QMT_MATH(fmin)(left.z, right.z),
+		QMT_MATH(fmin)(left.w, right.w)
+	};
+	return result;
+}
+
+// Maximum function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Max)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+	QMT_TYPE(vector4) result = {
+		QMT_MATH(fmax)(left.x, right.x),
+		QMT_MATH(fmax)(left.y, right.y),
+		QMT_MATH(fmax)(left.z, right.z),
+		QMT_MATH(fmax)(left.w, right.w)
+	};
+	return result;
+}
+
+// Clamp function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Clamp)(QMT_TYPE(vector4) vec, QMT_TYPE(vector4) min, QMT_TYPE(vector4) max)
+{
+	QMT_TYPE(vector4) result = {
+		max.x < min.x ? vec.x : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.x, min.x), max.x), // qmFloatClamp(vec.x, min.x, max.x)
+		max.y < min.y ? vec.y : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.y, min.y), max.y), // qmFloatClamp(vec.y, min.y, max.y)
+		max.z < min.z ? vec.z : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.z, min.z), max.z), // qmFloatClamp(vec.z, min.z, max.z)
+		max.w < min.w ? vec.w : QMT_MATH(fmin)(QMT_MATH(fmax)(vec.w, min.w), max.w)  // qmFloatClamp(vec.w, min.w, max.w)
+	};
+	return result;
+}
+
+// Linear interpolation function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Lerp)(QMT_REAL value, QMT_TYPE(vector4) start, QMT_TYPE(vector4) end)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE from = QMT_SIMD_OP(load)(start);
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(add)(from, QMT_SIMD_OP(mul)(QMT_SIMD_OP(splat)(value), QMT_SIMD_OP(sub)(QMT_SIMD_OP(load)(end), from))));
+#else
+	QMT_TYPE(vector4) result = {
+		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
+		start.y + value * (end.y - start.y), // qmFloatLerp(value, start.y, end.y)
+		start.z + value * (end.z - start.z), // qmFloatLerp(value, start.z, end.z)
+		start.w + value * (end.w - start.w)  // qmFloatLerp(value, start.w, end.w)
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Move function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Vector4, Move)(QMT_TYPE(vector4) vec, QMT_TYPE(vector4) target, QMT_REAL dist)
+{
+	if (dist <= 0.0f)
+	{
+		return vec;
+	}
+
+	QMT_REAL cdist = QMT_MATH(sqrt)(QMT_HELPER(sq)(target.x - vec.x) + QMT_HELPER(sq)(target.y - vec.y) + QMT_HELPER(sq)(target.z - vec.z) + QMT_HELPER(sq)(target.w - vec.w)); // qmVector4Distance(target, vec)
+	if (cdist > dist)
+	{
+		return vec;
+	}
+
+	QMT_TYPE(vector4) result = {
+		vec.x + dist / cdist * (target.x - vec.x),
+		vec.y + dist / cdist * (target.y - vec.y),
+		vec.z + dist / cdist * (target.z - vec.z),
+		vec.w + dist / cdist * (target.w - vec.w)
+	};
+	return result;
+}
+
+// Length function
+QM_API QMT_REAL QMT_FUNCTION(Vector4, Length)(QMT_TYPE(vector4) vec)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE reg = QMT_SIMD_OP(load)(vec);
+	return QMT_MATH(sqrt)(QMT_SIMD_OP(dot)(reg, reg));
+#else
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z) + QMT_HELPER(sq)(vec.w));
+#endif /* QMT_SIMD */
+}
+
+// Squared length function
+QM_API QMT_REAL QMT_FUNCTION(Vector4, LengthSq)(QMT_TYPE(vector4) vec)
+{
+	return QMT_HELPER(sq)(vec.x) + QMT_HELPER(sq)(vec.y) + QMT_HELPER(sq)(vec.z) + QMT_HELPER(sq)(vec.w);
+}
+
+// Dot product function
+QM_API QMT_REAL QMT_FUNCTION(Vector4, DotProduct)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(dot)(QMT_SIMD_OP(load)(left), QMT_SIMD_OP(load)(right));
+#else
+	return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
+#endif /* QMT_SIMD */
+}
+
+// Distance function
+QM_API QMT_REAL QMT_FUNCTION(Vector4, Distance)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(left.x - right.x) + QMT_HELPER(sq)(left.y - right.y) + QMT_HELPER(sq)(left.z - right.z) + QMT_HELPER(sq)(left.w - right.w));
+}
+
+// Squared distance function
+QM_API QMT_REAL QMT_FUNCTION(Vector4, DistanceSq)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+	return QMT_HELPER(sq)(left.x - right.x) + QMT_HELPER(sq)(left.y - right.y) + QMT_HELPER(sq)(left.z - right.z) + QMT_HELPER(sq)(left.w - right.w);
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Vector4, Equal)(QMT_TYPE(vector4) left, QMT_TYPE(vector4) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.x, right.x) &&
+		QMT_HELPER(equal)(left.y, right.y) &&
+		QMT_HELPER(equal)(left.z, right.z) &&
+		QMT_HELPER(equal)(left.w, right.w)
+	);
+}
+
+//// Matrix22 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, Zero)(q_void)
+{
+	QMT_TYPE(matrix22) result = {
+		0.0f, 0.0f,
+		0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, One)(q_void)
+{
+	QMT_TYPE(matrix22) result = {
+		1.0f, 1.0f,
+		1.0f, 1.0f
+	};
+	return result;
+}
+
+// Identity matrix function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, Identity)(q_void)
+{
+	QMT_TYPE(matrix22) result = {
+		1.0f, 0.0f,
+		0.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, Add)(QMT_TYPE(matrix22) left, QMT_TYPE(matrix22) right)
+{
+	QMT_TYPE(matrix22) result = {
+		left.m0 + right.m0, left.m2 + right.m2,
+		left.m1 + right.m1, left.m3 + right.m3
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, Subtract)(QMT_TYPE(matrix22) left, QMT_TYPE(matrix22) right)
+{
+	QMT_TYPE(matrix22) result = {
+		left.m0 - right.m0, left.m2 - right.m2,
+		left.m1 - right.m1, left.m3 - right.m3
+	};
+	return result;
+}
+
+// Multiply Vector2 function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Matrix22, MultiplyVector2)(QMT_TYPE(matrix22) mat, QMT_TYPE(vector2) vec)
+{
+	QMT_TYPE(vector2) result = {
+		mat.m0 * vec.x + mat.m2 * vec.y,
+		mat.m1 * vec.x + mat.m3 * vec.y
+	};
+	return result;
+}
+
+// Multiply Matrix22 function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, MultiplyMatrix22)(QMT_TYPE(matrix22) left, QMT_TYPE(matrix22) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1;
+	QMT_REAL m2 = left.m0 * right.m2 + left.m2 * right.m3;
+	QMT_REAL m3 = left.m1 * right.m2 + left.m3 * right.m3;
+
+	QMT_TYPE(matrix22) result = {
+		m0, m2,
+		m1, m3
+	};
+	return result;
+}
+
+// Multiply Matrix23 function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix22, MultiplyMatrix23)(QMT_TYPE(matrix22) left, QMT_TYPE(matrix23) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1;
+	QMT_REAL m2 = left.m0 * right.m2 + left.m2 * right.m3;
+	QMT_REAL m3 = left.m1 * right.m2 + left.m3 * right.m3;
+	QMT_REAL m4 = left.m0 * right.m4 + left.m2 * right.m5;
+	QMT_REAL m5 = left.m1 * right.m4 + left.m3 * right.m5;
+
+	QMT_TYPE(matrix23) result = {
+		m0, m2, m4,
+		m1, m3, m5
+	};
+	return result;
+}
+
+// Multiply Matrix24 function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix22, MultiplyMatrix24)(QMT_TYPE(matrix22) left, QMT_TYPE(matrix24) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1;
+	QMT_REAL m2 = left.m0 * right.m2 + left.m2 * right.m3;
+	QMT_REAL m3 = left.m1 * right.m2 + left.m3 * right.m3;
+	QMT_REAL m4 = left.m0 * right.m4 + left.m2 * right.m5;
+	QMT_REAL m5 = left.m1 * right.m4 + left.m3 * right.m5;
+	QMT_REAL m6 = left.m0 * right.m6 + left.m2 * right.m7;
+	QMT_REAL m7 = left.m1 * right.m6 + left.m3 * right.m7;
+
+	QMT_TYPE(matrix24) result = {
+		m0, m2, m4, m6,
+		m1, m3, m5, m7
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, Transpose)(QMT_TYPE(matrix22) mat)
+{
+	QMT_TYPE(matrix22) result = {
+		mat.m0, mat.m1,
+		mat.m2, mat.m3
+	};
+	return result;
+}
+
+// Inverse function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix22, Inverse)(QMT_TYPE(matrix22) mat)
+{
+	QMT_REAL det = mat.m0 * mat.m3 - mat.m1 * mat.m2; // qmMatrix22Determinant(mat)
+	QMT_REAL inv = 1 / det;
+
+	QMT_TYPE(matrix22) result = {
+		mat.m3 * inv, -mat.m2 * inv,
+		-mat.m1 * inv, mat.m0 * inv
+	};
+	return result;
+}
+
+// Determinant function
+QM_API QMT_REAL QMT_FUNCTION(Matrix22, Determinant)(QMT_TYPE(matrix22) mat)
+{
+	return mat.m0 * mat.m3 - mat.m1 * mat.m2;
+}
+
+// Trace function
+QM_API QMT_REAL QMT_FUNCTION(Matrix22, Trace)(QMT_TYPE(matrix22) mat)
+{
+	return mat.m0 + mat.m3;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix22, Equal)(QMT_TYPE(matrix22) left, QMT_TYPE(matrix22) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3)
+	);
+}
+
+//// Matrix23 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix23, Zero)(q_void)
+{
+	QMT_TYPE(matrix23) result = {
+		0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix23, One)(q_void)
+{
+	QMT_TYPE(matrix23) result = {
+		1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix23, Add)(QMT_TYPE(matrix23) left, QMT_TYPE(matrix23) right)
+{
+	QMT_TYPE(matrix23) result = {
+		left.m0 + right.m0, left.m2 + right.m2, left.m4 + right.m4,
+		left.m1 + right.m1, left.m3 + right.m3, left.m5 + right.m5
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix23, Subtract)(QMT_TYPE(matrix23) left, QMT_TYPE(matrix23) right)
+{
+	QMT_TYPE(matrix23) result = {
+		left.m0 - right.m0, left.m2 - right.m2, left.m4 - right.m4,
+		left.m1 - right.m1, left.m3 - right.m3, left.m5 - right.m5
+	};
+	return result;
+}
+
+// Multiply Vector3 function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Matrix23, MultiplyVector3)(QMT_TYPE(matrix23) mat, QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(vector2) result = {
+		mat.m0 * vec.x + mat.m2 * vec.y + mat.m4 * vec.z,
+		mat.m1 * vec.x + mat.m3 * vec.y + mat.m5 * vec.z
+	};
+	return result;
+}
+
+// Multiply Matrix32 function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix23, MultiplyMatrix32)(QMT_TYPE(matrix23) left, QMT_TYPE(matrix32) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2;
+	QMT_REAL m2 = left.m0 * right.m3 + left.m2 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m3 = left.m1 * right.m3 + left.m3 * right.m4 + left.m5 * right.m5;
+
+	QMT_TYPE(matrix22) result = {
+		m0, m2,
+		m1, m3
+	};
+	return result;
+}
+
+// Multiply Matrix33 function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix23, MultiplyMatrix33)(QMT_TYPE(matrix23) left, QMT_TYPE(matrix33) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2;
+	QMT_REAL m2 = left.m0 * right.m3 + left.m2 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m3 = left.m1 * right.m3 + left.m3 * right.m4 + left.m5 * right.m5;
+	QMT_REAL m4 = left.m0 * right.m6 + left.m2 * right.m7 + left.m4 * right.m8;
+	QMT_REAL m5 = left.m1 * right.m6 + left.m3 * right.m7 + left.m5 * right.m8;
+
+	QMT_TYPE(matrix23) result = {
+		m0, m2, m4,
+		m1, m3, m5
+	};
+	return result;
+}
+
+// Multiply Matrix34 function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix23, MultiplyMatrix34)(QMT_TYPE(matrix23) left, QMT_TYPE(matrix34) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2;
+	QMT_REAL m2 = left.m0 * right.m3 + left.m2 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m3 = left.m1 * right.m3 + left.m3 * right.m4 + left.m5 * right.m5;
+	QMT_REAL m4 = left.m0 * right.m6 + left.m2 * right.m7 + left.m4 * right.m8;
+	QMT_REAL m5 = left.m1 * right.m6 + left.m3 * right.m7 + left.m5 * right.m8;
+	QMT_REAL m6 = left.m0 * right.m9 + left.m2 * right.m10 + left.m4 * right.m11;
+	QMT_REAL m7 = left.m1 * right.m9 + left.m3 * right.m10 + left.m5 * right.m11;
+
+	QMT_TYPE(matrix24) result = {
+		m0, m2, m4, m6,
+		m1, m3, m5, m7
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix23, Transpose)(QMT_TYPE(matrix23) mat)
+{
+	QMT_TYPE(matrix32) result = {
+		mat.m0, mat.m1,
+		mat.m2, mat.m3,
+		mat.m4, mat.m5
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix23, Equal)(QMT_TYPE(matrix23) left, QMT_TYPE(matrix23) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5)
+	);
+}
+
+//// Matrix24 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix24, Zero)(q_void)
+{
+	QMT_TYPE(matrix24) result = {
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix24, One)(q_void)
+{
+	QMT_TYPE(matrix24) result = {
+		1.0f, 1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix24, Add)(QMT_TYPE(matrix24) left, QMT_TYPE(matrix24) right)
+{
+	QMT_TYPE(matrix24) result = {
+		left.m0 + right.m0, left.m2 + right.m2, left.m4 + right.m4, left.m6 + right.m6,
+		left.m1 + right.m1, left.m3 + right.m3, left.m5 + right.m5, left.m7 + right.m7
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix24, Subtract)(QMT_TYPE(matrix24) left, QMT_TYPE(matrix24) right)
+{
+	QMT_TYPE(matrix24) result = {
+		left.m0 - right.m0, left.m2 - right.m2, left.m4 - right.m4, left.m6 - right.m6,
+		left.m1 - right.m1, left.m3 - right.m3, left.m5 - right.m5, left.m7 - right.m7
+	};
+	return result;
+}
+
+// Multiply Vector4 function
+QM_API QMT_TYPE(vector2) QMT_FUNCTION(Matrix24, MultiplyVector4)(QMT_TYPE(matrix24) mat, QMT_TYPE(vector4) vec)
+{
+	QMT_TYPE(vector2) result = {
+		mat.m0 * vec.x + mat.m2 * vec.y + mat.m4 * vec.z + mat.m6 * vec.w,
+		mat.m1 * vec.x + mat.m3 * vec.y + mat.m5 * vec.z + mat.m7 * vec.w
+	};
+	return result;
+}
+
+// Multiply Matrix42 function
+QM_API QMT_TYPE(matrix22) QMT_FUNCTION(Matrix24, MultiplyMatrix42)(QMT_TYPE(matrix24) left, QMT_TYPE(matrix42) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2 + left.m6 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2 + left.m7 * right.m3;
+	QMT_REAL m2 = left.m0 * right.m4 + left.m2 * right.m5 + left.m4 * right.m6 + left.m6 * right.m7;
+	QMT_REAL m3 = left.m1 * right.m4 + left.m3 * right.m5 + left.m5 * right.m6 + left.m7 * right.m7;
+
+	QMT_TYPE(matrix22) result = {
+		m0, m2,
+		m1, m3
+	};
+	return result;
+}
+
+// Multiply Matrix43 function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix24, MultiplyMatrix43)(QMT_TYPE(matrix24) left, QMT_TYPE(matrix43) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2 + left.m6 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2 + left.m7 * right.m3;
+	QMT_REAL m2 = left.m0 * right.m4 + left.m2 * right.m5 + left.m4 * right.m6 + left.m6 * right.m7;
+	QMT_REAL m3 = left.m1 * right.m4 + left.m3 * right.m5 + left.m5 * right.m6 + left.m7 * right.m7;
+	QMT_REAL m4 = left.m0 * right.m8 + left.m2 * right.m9 + left.m4 * right.m10 + left.m6 * right.m11;
+	QMT_REAL m5 = left.m1 * right.m8 + left.m3 * right.m9 + left.m5 * right.m10 + left.m7 * right.m11;
+
+	QMT_TYPE(matrix23) result = {
+		m0, m2, m4,
+		m1, m3, m5
+	};
+	return result;
+}
+
+// Multiply Matrix44 function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix24, MultiplyMatrix44)(QMT_TYPE(matrix24) left, QMT_TYPE(matrix44) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m2 * right.m1 + left.m4 * right.m2 + left.m6 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m3 * right.m1 + left.m5 * right.m2 + left.m7 * right.m3;
+	QMT_REAL m2 = left.m0 * right.m4 + left.m2 * right.m5 + left.m4 * right.m6 + left.m6 * right.m7;
+	QMT_REAL m3 = left.m1 * right.m4 + left.m3 * right.m5 + left.m5 * right.m6 + left.m7 * right.m7;
+	QMT_REAL m4 = left.m0 * right.m8 + left.m2 * right.m9 + left.m4 * right.m10 + left.m6 * right.m11;
+	QMT_REAL m5 = left.m1 * right.m8 + left.m3 * right.m9 + left.m5 * right.m10 + left.m7 * right.m11;
+	QMT_REAL m6 = left.m0 * right.m12 + left.m2 * right.m13 + left.m4 * right.m14 + left.m6 * right.m15;
+	QMT_REAL m7 = left.m1 * right.m12 + left.m3 * right.m13 + left.m5 * right.m14 + left.m7 * right.m15;
+
+	QMT_TYPE(matrix24) result = {
+		m0, m2, m4, m6,
+		m1, m3, m5, m7
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix24, Transpose)(QMT_TYPE(matrix24) mat)
+{
+	QMT_TYPE(matrix42) result = {
+		mat.m0, mat.m1,
+		mat.m2, mat.m3,
+		mat.m4, mat.m5,
+		mat.m6, mat.m7
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix24, Equal)(QMT_TYPE(matrix24) left, QMT_TYPE(matrix24) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5) &&
+		QMT_HELPER(equal)(left.m6, right.m6) &&
+		QMT_HELPER(equal)(left.m7, right.m7)
+	);
+}
+
+//// Matrix32 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix32, Zero)(q_void)
+{
+	QMT_TYPE(matrix32) result = {
+		0.0f, 0.0f,
+		0.0f, 0.0f,
+		0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix32, One)(q_void)
+{
+	QMT_TYPE(matrix32) result = {
+		1.0f, 1.0f,
+		1.0f, 1.0f,
+		1.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix32, Add)(QMT_TYPE(matrix32) left, QMT_TYPE(matrix32) right)
+{
+	QMT_TYPE(matrix32) result = {
+		left.m0 + right.m0, left.m3 + right.m3,
+		left.m1 + right.m1, left.m4 + right.m4,
+		left.m2 + right.m2, left.m5 + right.m5
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix32, Subtract)(QMT_TYPE(matrix32) left, QMT_TYPE(matrix32) right)
+{
+	QMT_TYPE(matrix32) result = {
+		left.m0 - right.m0, left.m3 - right.m3,
+		left.m1 - right.m1, left.m4 - right.m4,
+		left.m2 - right.m2, left.m5 - right.m5
+	};
+	return result;
+}
+
+// Multiply Vector2 function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Matrix32, MultiplyVector2)(QMT_TYPE(matrix32) mat, QMT_TYPE(vector2) vec)
+{
+	QMT_TYPE(vector3) result = {
+		mat.m0 * vec.x + mat.m3 * vec.y,
+		mat.m1 * vec.x + mat.m4 * vec.y,
+		mat.m2 * vec.x + mat.m5 * vec.y
+	};
+	return result;
+}
+
+// Multiply Matrix22 function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix32, MultiplyMatrix22)(QMT_TYPE(matrix32) left, QMT_TYPE(matrix22) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1;
+	QMT_REAL m3 = left.m0 * right.m2 + left.m3 * right.m3;
+	QMT_REAL m4 = left.m1 * right.m2 + left.m4 * right.m3;
+	QMT_REAL m5 = left.m2 * right.m2 + left.m5 * right.m3;
+
+	QMT_TYPE(matrix32) result = {
+		m0, m3,
+		m1, m4,
+		m2, m5
+	};
+	return result;
+}
+
+// Multiply Matrix23 function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix32, MultiplyMatrix23)(QMT_TYPE(matrix32) left, QMT_TYPE(matrix23) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1;
+	QMT_REAL m3 = left.m0 * right.m2 + left.m3 * right.m3;
+	QMT_REAL m4 = left.m1 * right.m2 + left.m4 * right.m3;
+	QMT_REAL m5 = left.m2 * right.m2 + left.m5 * right.m3;
+	QMT_REAL m6 = left.m0 * right.m4 + left.m3 * right.m5;
+	QMT_REAL m7 = left.m1 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m8 = left.m2 * right.m4 + left.m5 * right.m5;
+
+	QMT_TYPE(matrix33) result = {
+		m0, m3, m6,
+		m1, m4, m7,
+		m2, m5, m8
+	};
+	return result;
+}
+
+// Multiply Matrix24 function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix32, MultiplyMatrix24)(QMT_TYPE(matrix32) left, QMT_TYPE(matrix24) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1;
+	QMT_REAL m3 = left.m0 * right.m2 + left.m3 * right.m3;
+	QMT_REAL m4 = left.m1 * right.m2 + left.m4 * right.m3;
+	QMT_REAL m5 = left.m2 * right.m2 + left.m5 * right.m3;
+	QMT_REAL m6 = left.m0 * right.m4 + left.m3 * right.m5;
+	QMT_REAL m7 = left.m1 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m8 = left.m2 * right.m4 + left.m5 * right.m5;
+	QMT_REAL m9 = left.m0 * right.m6 + left.m3 * right.m7;
+	QMT_REAL m10 = left.m1 * right.m6 + left.m4 * right.m7;
+	QMT_REAL m11 = left.m2 * right.m6 + left.m5 * right.m7;
+
+	QMT_TYPE(matrix34) result = {
+		m0, m3, m6, m9,
+		m1, m4, m7, m10,
+		m2, m5, m8, m11
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix23) QMT_FUNCTION(Matrix32, Transpose)(QMT_TYPE(matrix32) mat)
+{
+	QMT_TYPE(matrix23) result = {
+		mat.m0, mat.m1, mat.m2,
+		mat.m3, mat.m4, mat.m5
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix32, Equal)(QMT_TYPE(matrix32) left, QMT_TYPE(matrix32) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5)
+	);
+}
+
+//// Matrix33 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, Zero)(q_void)
+{
+	QMT_TYPE(matrix33) result = {
+		0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, One)(q_void)
+{
+	QMT_TYPE(matrix33) result = {
+		1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f
+	};
+	return result;
+}
+
+// Identity matrix function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, Identity)(q_void)
+{
+	QMT_TYPE(matrix33) result = {
+		1.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, Add)(QMT_TYPE(matrix33) left, QMT_TYPE(matrix33) right)
+{
+	QMT_TYPE(matrix33) result = {
+		left.m0 + right.m0, left.m3 + right.m3, left.m6 + right.m6,
+		left.m1 + right.m1, left.m4 + right.m4, left.m7 + right.m7,
+		left.m2 + right.m2, left.m5 + right.m5, left.m8 + right.m8
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, Subtract)(QMT_TYPE(matrix33) left, QMT_TYPE(matrix33) right)
+{
+	QMT_TYPE(matrix33) result = {
+		left.m0 - right.m0, left.m3 - right.m3, left.m6 - right.m6,
+		left.m1 - right.m1, left.m4 - right.m4, left.m7 - right.m7,
+		left.m2 - right.m2, left.m5 - right.m5, left.m8 - right.m8
+	};
+	return result;
+}
+
+// Multiply Vector3 function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Matrix33, MultiplyVector3)(QMT_TYPE(matrix33) mat, QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(vector3) result = {
+		mat.m0 * vec.x + mat.m3 * vec.y + mat.m6 * vec.z,
+		mat.m1 * vec.x + mat.m4 * vec.y + mat.m7 * vec.z,
+		mat.m2 * vec.x + mat.m5 * vec.y + mat.m8 * vec.z
+	};
+	return result;
+}
+
+// Multiply Matrix32 function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix33, MultiplyMatrix32)(QMT_TYPE(matrix33) left, QMT_TYPE(matrix32) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2;
+	QMT_REAL m3 = left.m0 * right.m3 + left.m3 * right.m4 + left.m6 * right.m5;
+	QMT_REAL m4 = left.m1 * right.m3 + left.m4 * right.m4 + left.m7 * right.m5;
+	QMT_REAL m5 = left.m2 * right.m3 + left.m5 * right.m4 + left.m8 * right.m5;
+
+	QMT_TYPE(matrix32) result = {
+		m0, m3,
+		m1, m4,
+		m2, m5
+	};
+	return result;
+}
+
+// Multiply Matrix33 function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, MultiplyMatrix33)(QMT_TYPE(matrix33) left, QMT_TYPE(matrix33) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2;
+	QMT_REAL m3 = left.m0 * right.m3 + left.m3 * right.m4 + left.m6 * right.m5;
+	QMT_REAL m4 = left.m1 * right.m3 + left.m4 * right.m4 + left.m7 * right.m5;
+	QMT_REAL m5 = left.m2 * right.m3 + left.m5 * right.m4 + left.m8 * right.m5;
+	QMT_REAL m6 = left.m0 * right.m6 + left.m3 * right.m7 + left.m6 * right.m8;
+	QMT_REAL m7 = left.m1 * right.m6 + left.m4 * right.m7 + left.m7 * right.m8;
+	QMT_REAL m8 = left.m2 * right.m6 + left.m5 * right.m7 + left.m8 * right.m8;
+
+	QMT_TYPE(matrix33) result = {
+		m0, m3, m6,
+		m1, m4, m7,
+		m2, m5, m8
+	};
+	return result;
+}
+
+// Multiply Matrix34 function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix33, MultiplyMatrix34)(QMT_TYPE(matrix33) left, QMT_TYPE(matrix34) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2;
+	QMT_REAL m3 = left.m0 * right.m3 + left.m3 * right.m4 + left.m6 * right.m5;
+	QMT_REAL m4 = left.m1 * right.m3 + left.m4 * right.m4 + left.m7 * right.m5;
+	QMT_REAL m5 = left.m2 * right.m3 + left.m5 * right.m4 + left.m8 * right.m5;
+	QMT_REAL m6 = left.m0 * right.m6 + left.m3 * right.m7 + left.m6 * right.m8;
+	QMT_REAL m7 = left.m1 * right.m6 + left.m4 * right.m7 + left.m7 * right.m8;
+	QMT_REAL m8 = left.m2 * right.m6 + left.m5 * right.m7 + left.m8 * right.m8;
+	QMT_REAL m9 = left.m0 * right.m9 + left.m3 * right.m10 + left.m6 * right.m11;
+	QMT_REAL m10 = left.m1 * right.m9 + left.m4 * right.m10 + left.m7 * right.m11;
+	QMT_REAL m11 = left.m2 * right.m9 + left.m5 * right.m10 + left.m8 * right.m11;
+
+	QMT_TYPE(matrix34) result = {
+		m0, m3, m6, m9,
+		m1, m4, m7, m10,
+		m2, m5, m8, m11
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, Transpose)(QMT_TYPE(matrix33) mat)
+{
+	QMT_TYPE(matrix33) result = {
+		mat.m0, mat.m1, mat.m2,
+		mat.m3, mat.m4, mat.m5,
+		mat.m6, mat.m7, mat.m8
+	};
+	return result;
+}
+
+// Inverse function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix33, Inverse)(QMT_TYPE(matrix33) mat)
+{
+	QMT_REAL det = ( // qmMatrix33Determinant(mat)
+		mat.m0 * mat.m4 * mat.m8 +
+		mat.m1 * mat.m5 * mat.m6 +
+		mat.m2 * mat.m3 * mat.m7 -
+		mat.m0 * mat.m5 * mat.m7 -
+		mat.m1 * mat.m3 * mat.m8 -
+		mat.m2 * mat.m4 * mat.m6
+	);
+	QMT_REAL inv = 1 / det;
+
+	QMT_REAL m0 = (mat.m4 * mat.m8 - mat.m5 * mat.m7) * inv;
+	QMT_REAL m1 = (mat.m2 * mat.m7 - mat.m1 * mat.m8) * inv;
+	QMT_REAL m2 = (mat.m1 * mat.m5 - mat.m2 * mat.m4) * inv;
+	QMT_REAL m3 = (mat.m5 * mat.m6 - mat.m3 * mat.m8) * inv;
+	QMT_REAL m4 = (mat.m0 * mat.m8 - mat.m2 * mat.m6) * inv;
+	QMT_REAL m5 = (mat.m2 * mat.m3 - mat.m0 * mat.m5) * inv;
+	QMT_REAL m6 = (mat.m3 * mat.m7 - mat.m4 * mat.m6) * inv;
+	QMT_REAL m7 = (mat.m1 * mat.m6 - mat.m0 * mat.m7) * inv;
+	QMT_REAL m8 = (mat.m0 * mat.m4 - mat.m1 * mat.m3) * inv;
+
+	QMT_TYPE(matrix33) result = {
+		m0, m3, m6,
+		m1, m4, m7,
+		m2, m5, m8
+	};
+	return result;
+}
+
+// Determinant function
+QM_API QMT_REAL QMT_FUNCTION(Matrix33, Determinant)(QMT_TYPE(matrix33) mat)
+{
+	return (
+		mat.m0 * mat.m4 * mat.m8 +
+		mat.m1 * mat.m5 * mat.m6 +
+		mat.m2 * mat.m3 * mat.m7 -
+		mat.m0 * mat.m5 * mat.m7 -
+		mat.m1 * mat.m3 * mat.m8 -
+		mat.m2 * mat.m4 * mat.m6
+	);
+}
+
+// Trace function
+QM_API QMT_REAL QMT_FUNCTION(Matrix33, Trace)(QMT_TYPE(matrix33) mat)
+{
+	return mat.m0 + mat.m4 + mat.m8;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix33, Equal)(QMT_TYPE(matrix33) left, QMT_TYPE(matrix33) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5) &&
+		QMT_HELPER(equal)(left.m6, right.m6) &&
+		QMT_HELPER(equal)(left.m7, right.m7) &&
+		QMT_HELPER(equal)(left.m8, right.m8)
+	);
+}
+
+//// Matrix34 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix34, Zero)(q_void)
+{
+	QMT_TYPE(matrix34) result = {
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix34, One)(q_void)
+{
+	QMT_TYPE(matrix34) result = {
+		1.0f, 1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix34, Add)(QMT_TYPE(matrix34) left, QMT_TYPE(matrix34) right)
+{
+	QMT_TYPE(matrix34) result = {
+		left.m0 + right.m0, left.m3 + right.m3, left.m6 + right.m6, left.m9 + right.m9,
+		left.m1 + right.m1, left.m4 + right.m4, left.m7 + right.m7, left.m10 + right.m10,
+		left.m2 + right.m2, left.m5 + right.m5, left.m8 + right.m8, left.m11 + right.m11
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix34, Subtract)(QMT_TYPE(matrix34) left, QMT_TYPE(matrix34) right)
+{
+	QMT_TYPE(matrix34) result = {
+		left.m0 - right.m0, left.m3 - right.m3, left.m6 - right.m6, left.m9 - right.m9,
+		left.m1 - right.m1, left.m4 - right.m4, left.m7 - right.m7, left.m10 - right.m10,
+		left.m2 - right.m2, left.m5 - right.m5, left.m8 - right.m8, left.m11 - right.m11
+	};
+	return result;
+}
+
+// Multiply Vector4 function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Matrix34, MultiplyVector4)(QMT_TYPE(matrix34) mat, QMT_TYPE(vector4) vec)
+{
+	QMT_TYPE(vector3) result = {
+		mat.m0 * vec.x + mat.m3 * vec.y + mat.m6 * vec.z + mat.m9 * vec.w,
+		mat.m1 * vec.x + mat.m4 * vec.y + mat.m7 * vec.z + mat.m10 * vec.w,
+		mat.m2 * vec.x + mat.m5 * vec.y + mat.m8 * vec.z + mat.m11 * vec.w
+	};
+	return result;
+}
+
+// Multiply Matrix42 function
+QM_API QMT_TYPE(matrix32) QMT_FUNCTION(Matrix34, MultiplyMatrix42)(QMT_TYPE(matrix34) left, QMT_TYPE(matrix42) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2 + left.m9 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2 + left.m10 * right.m3;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2 + left.m11 * right.m3;
+	QMT_REAL m3 = left.m0 * right.m4 + left.m3 * right.m5 + left.m6 * right.m6 + left.m9 * right.m7;
+	QMT_REAL m4 = left.m1 * right.m4 + left.m4 * right.m5 + left.m7 * right.m6 + left.m10 * right.m7;
+	QMT_REAL m5 = left.m2 * right.m4 + left.m5 * right.m5 + left.m8 * right.m6 + left.m11 * right.m7;
+
+	QMT_TYPE(matrix32) result = {
+		m0, m3,
+		m1, m4,
+		m2, m5
+	};
+	return result;
+}
+
+// Multiply Matrix43 function
+QM_API QMT_TYPE(matrix33) QMT_FUNCTION(Matrix34, MultiplyMatrix43)(QMT_TYPE(matrix34) left, QMT_TYPE(matrix43) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2 + left.m9 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2 + left.m10 * right.m3;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2 + left.m11 * right.m3;
+	QMT_REAL m3 = left.m0 * right.m4 + left.m3 * right.m5 + left.m6 * right.m6 + left.m9 * right.m7;
+	QMT_REAL m4 = left.m1 * right.m4 + left.m4 * right.m5 + left.m7 * right.m6 + left.m10 * right.m7;
+	QMT_REAL m5 = left.m2 * right.m4 + left.m5 * right.m5 + left.m8 * right.m6 + left.m11 * right.m7;
+	QMT_REAL m6 = left.m0 * right.m8 + left.m3 * right.m9 + left.m6 * right.m10 + left.m9 * right.m11;
+	QMT_REAL m7 = left.m1 * right.m8 + left.m4 * right.m9 + left.m7 * right.m10 + left.m10 * right.m11;
+	QMT_REAL m8 = left.m2 * right.m8 + left.m5 * right.m9 + left.m8 * right.m10 + left.m11 * right.m11;
+
+	QMT_TYPE(matrix33) result = {
+		m0, m3, m6,
+		m1, m4, m7,
+		m2, m5, m8
+	};
+	return result;
+}
+
+// Multiply Matrix44 function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix34, MultiplyMatrix44)(QMT_TYPE(matrix34) left, QMT_TYPE(matrix44) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m3 * right.m1 + left.m6 * right.m2 + left.m9 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m4 * right.m1 + left.m7 * right.m2 + left.m10 * right.m3;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m5 * right.m1 + left.m8 * right.m2 + left.m11 * right.m3;
+	QMT_REAL m3 = left.m0 * right.m4 + left.m3 * right.m5 + left.m6 * right.m6 + left.m9 * right.m7;
+	QMT_REAL m4 = left.m1 * right.m4 + left.m4 * right.m5 + left.m7 * right.m6 + left.m10 * right.m7;
+	QMT_REAL m5 = left.m2 * right.m4 + left.m5 * right.m5 + left.m8 * right.m6 + left.m11 * right.m7;
+	QMT_REAL m6 = left.m0 * right.m8 + left.m3 * right.m9 + left.m6 * right.m10 + left.m9 * right.m11;
+	QMT_REAL m7 = left.m1 * right.m8 + left.m4 * right.m9 + left.m7 * right.m10 + left.m10 * right.m11;
+	QMT_REAL m8 = left.m2 * right.m8 + left.m5 * right.m9 + left.m8 * right.m10 + left.m11 * right.m11;
+	QMT_REAL m9 = left.m0 * right.m12 + left.m3 * right.m13 + left.m6 * right.m14 + left.m9 * right.m15;
+	QMT_REAL m10 = left.m1 * right.m12 + left.m4 * right.m13 + left.m7 * right.m14 + left.m10 * right.m15;
+	QMT_REAL m11 = left.m2 * right.m12 + left.m5 * right.m13 + left.m8 * right.m14 + left.m11 * right.m15;
+
+	QMT_TYPE(matrix34) result = {
+		m0, m3, m6, m9,
+		m1, m4, m7, m10,
+		m2, m5, m8, m11
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix34, Transpose)(QMT_TYPE(matrix34) mat)
+{
+	QMT_TYPE(matrix43) result = {
+		mat.m0, mat.m1, mat.m2,
+		mat.m3, mat.m4, mat.m5,
+		mat.m6, mat.m7, mat.m8,
+		mat.m9, mat.m10, mat.m11
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix34, Equal)(QMT_TYPE(matrix34) left, QMT_TYPE(matrix34) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5) &&
+		QMT_HELPER(equal)(left.m6, right.m6) &&
+		QMT_HELPER(equal)(left.m7, right.m7) &&
+		QMT_HELPER(equal)(left.m8, right.m8) &&
+		QMT_HELPER(equal)(left.m9, right.m9) &&
+		QMT_HELPER(equal)(left.m10, right.m10) &&
+		QMT_HELPER(equal)(left.m11, right.m11)
+	);
+}
+
+//// Matrix42 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix42, Zero)(q_void)
+{
+	QMT_TYPE(matrix42) result = {
+		0.0f, 0.0f,
+		0.0f, 0.0f,
+		0.0f, 0.0f,
+		0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix42, One)(q_void)
+{
+	QMT_TYPE(matrix42) result = {
+		1.0f, 1.0f,
+		1.0f, 1.0f,
+		1.0f, 1.0f,
+		1.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix42, Add)(QMT_TYPE(matrix42) left, QMT_TYPE(matrix42) right)
+{
+	QMT_TYPE(matrix42) result = {
+		left.m0 + right.m0, left.m4 + right.m4,
+		left.m1 + right.m1, left.m5 + right.m5,
+		left.m2 + right.m2, left.m6 + right.m6,
+		left.m3 + right.m3, left.m7 + right.m7
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix42, Subtract)(QMT_TYPE(matrix42) left, QMT_TYPE(matrix42) right)
+{
+	QMT_TYPE(matrix42) result = {
+		left.m0 - right.m0, left.m4 - right.m4,
+		left.m1 - right.m1, left.m5 - right.m5,
+		left.m2 - right.m2, left.m6 - right.m6,
+		left.m3 - right.m3, left.m7 - right.m7
+	};
+	return result;
+}
+
+// Multiply Vector2 function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Matrix42, MultiplyVector2)(QMT_TYPE(matrix42) mat, QMT_TYPE(vector2) vec)
+{
+	QMT_TYPE(vector4) result = {
+		mat.m0 * vec.x + mat.m4 * vec.y,
+		mat.m1 * vec.x + mat.m5 * vec.y,
+		mat.m2 * vec.x + mat.m6 * vec.y,
+		mat.m3 * vec.x + mat.m7 * vec.y
+	};
+	return result;
+}
+
+// Multiply Matrix22 function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix42, MultiplyMatrix22)(QMT_TYPE(matrix42) left, QMT_TYPE(matrix22) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1;
+	QMT_REAL m4 = left.m0 * right.m2 + left.m4 * right.m3;
+	QMT_REAL m5 = left.m1 * right.m2 + left.m5 * right.m3;
+	QMT_REAL m6 = left.m2 * right.m2 + left.m6 * right.m3;
+	QMT_REAL m7 = left.m3 * right.m2 + left.m7 * right.m3;
+
+	QMT_TYPE(matrix42) result = {
+		m0, m4,
+		m1, m5,
+		m2, m6,
+		m3, m7
+	};
+	return result;
+}
+
+// Multiply Matrix23 function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix42, MultiplyMatrix23)(QMT_TYPE(matrix42) left, QMT_TYPE(matrix23) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1;
+	QMT_REAL m4 = left.m0 * right.m2 + left.m4 * right.m3;
+	QMT_REAL m5 = left.m1 * right.m2 + left.m5 * right.m3;
+	QMT_REAL m6 = left.m2 * right.m2 + left.m6 * right.m3;
+	QMT_REAL m7 = left.m3 * right.m2 + left.m7 * right.m3;
+	QMT_REAL m8 = left.m0 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m9 = left.m1 * right.m4 + left.m5 * right.m5;
+	QMT_REAL m10 = left.m2 * right.m4 + left.m6 * right.m5;
+	QMT_REAL m11 = left.m3 * right.m4 + left.m7 * right.m5;
+
+	QMT_TYPE(matrix43) result = {
+		m0, m4, m8,
+		m1, m5, m9,
+		m2, m6, m10,
+		m3, m7, m11
+	};
+	return result;
+}
+
+// Multiply Matrix24 function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix42, MultiplyMatrix24)(QMT_TYPE(matrix42) left, QMT_TYPE(matrix24) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1;
+	QMT_REAL m4 = left.m0 * right.m2 + left.m4 * right.m3;
+	QMT_REAL m5 = left.m1 * right.m2 + left.m5 * right.m3;
+	QMT_REAL m6 = left.m2 * right.m2 + left.m6 * right.m3;
+	QMT_REAL m7 = left.m3 * right.m2 + left.m7 * right.m3;
+	QMT_REAL m8 = left.m0 * right.m4 + left.m4 * right.m5;
+	QMT_REAL m9 = left.m1 * right.m4 + left.m5 * right.m5;
+	QMT_REAL m10 = left.m2 * right.m4 + left.m6 * right.m5;
+	QMT_REAL m11 = left.m3 * right.m4 + left.m7 * right.m5;
+	QMT_REAL m12 = left.m0 * right.m6 + left.m4 * right.m7;
+	QMT_REAL m13 = left.m1 * right.m6 + left.m5 * right.m7;
+	QMT_REAL m14 = left.m2 * right.m6 + left.m6 * right.m7;
+	QMT_REAL m15 = left.m3 * right.m6 + left.m7 * right.m7;
+
+	QMT_TYPE(matrix44) result = {
+		m0, m4, m8, m12,
+		m1, m5, m9, m13,
+		m2, m6, m10, m14,
+		m3, m7, m11, m15
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix24) QMT_FUNCTION(Matrix42, Transpose)(QMT_TYPE(matrix42) mat)
+{
+	QMT_TYPE(matrix24) result = {
+		mat.m0, mat.m1, mat.m2, mat.m3,
+		mat.m4, mat.m5, mat.m6, mat.m7
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix42, Equal)(QMT_TYPE(matrix42) left, QMT_TYPE(matrix42) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5) &&
+		QMT_HELPER(equal)(left.m6, right.m6) &&
+		QMT_HELPER(equal)(left.m7, right.m7)
+	);
+}
+
+//// Matrix43 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix43, Zero)(q_void)
+{
+	QMT_TYPE(matrix43) result = {
+		0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix43, One)(q_void)
+{
+	QMT_TYPE(matrix43) result = {
+		1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix43, Add)(QMT_TYPE(matrix43) left, QMT_TYPE(matrix43) right)
+{
+	QMT_TYPE(matrix43) result = {
+		left.m0 + right.m0, left.m4 + right.m4, left.m8 + right.m8,
+		left.m1 + right.m1, left.m5 + right.m5, left.m9 + right.m9,
+		left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10,
+		left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix43, Subtract)(QMT_TYPE(matrix43) left, QMT_TYPE(matrix43) right)
+{
+	QMT_TYPE(matrix43) result = {
+		left.m0 - right.m0, left.m4 - right.m4, left.m8 - right.m8,
+		left.m1 - right.m1, left.m5 - right.m5, left.m9 - right.m9,
+		left.m2 - right.m2, left.m6 - right.m6, left.m10 - right.m10,
+		left.m3 - right.m3, left.m7 - right.m7, left.m11 - right.m11
+	};
+	return result;
+}
+
+// Multiply Vector3 function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Matrix43, MultiplyVector3)(QMT_TYPE(matrix43) mat, QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(vector4) result = {
+		mat.m0 * vec.x + mat.m4 * vec.y + mat.m8 * vec.z,
+		mat.m1 * vec.x + mat.m5 * vec.y + mat.m9 * vec.z,
+		mat.m2 * vec.x + mat.m6 * vec.y + mat.m10 * vec.z,
+		mat.m3 * vec.x + mat.m7 * vec.y + mat.m11 * vec.z
+	};
+	return result;
+}
+
+// Multiply Matrix32 function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix43, MultiplyMatrix32)(QMT_TYPE(matrix43) left, QMT_TYPE(matrix32) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2;
+	QMT_REAL m4 = left.m0 * right.m3 + left.m4 * right.m4 + left.m8 * right.m5;
+	QMT_REAL m5 = left.m1 * right.m3 + left.m5 * right.m4 + left.m9 * right.m5;
+	QMT_REAL m6 = left.m2 * right.m3 + left.m6 * right.m4 + left.m10 * right.m5;
+	QMT_REAL m7 = left.m3 * right.m3 + left.m7 * right.m4 + left.m11 * right.m5;
+
+	QMT_TYPE(matrix42) result = {
+		m0, m4,
+		m1, m5,
+		m2, m6,
+		m3, m7
+	};
+	return result;
+}
+
+// Multiply Matrix33 function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix43, MultiplyMatrix33)(QMT_TYPE(matrix43) left, QMT_TYPE(matrix33) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2;
+	QMT_REAL m4 = left.m0 * right.m3 + left.m4 * right.m4 + left.m8 * right.m5;
+	QMT_REAL m5 = left.m1 * right.m3 + left.m5 * right.m4 + left.m9 * right.m5;
+	QMT_REAL m6 = left.m2 * right.m3 + left.m6 * right.m4 + left.m10 * right.m5;
+	QMT_REAL m7 = left.m3 * right.m3 + left.m7 * right.m4 + left.m11 * right.m5;
+	QMT_REAL m8 = left.m0 * right.m6 + left.m4 * right.m7 + left.m8 * right.m8;
+	QMT_REAL m9 = left.m1 * right.m6 + left.m5 * right.m7 + left.m9 * right.m8;
+	QMT_REAL m10 = left.m2 * right.m6 + left.m6 * right.m7 + left.m10 * right.m8;
+	QMT_REAL m11 = left.m3 * right.m6 + left.m7 * right.m7 + left.m11 * right.m8;
+
+	QMT_TYPE(matrix43) result = {
+		m0, m4, m8,
+		m1, m5, m9,
+		m2, m6, m10,
+		m3, m7, m11
+	};
+	return result;
+}
+
+// Multiply Matrix34 function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix43, MultiplyMatrix34)(QMT_TYPE(matrix43) left, QMT_TYPE(matrix34) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2;
+	QMT_REAL m4 = left.m0 * right.m3 + left.m4 * right.m4 + left.m8 * right.m5;
+	QMT_REAL m5 = left.m1 * right.m3 + left.m5 * right.m4 + left.m9 * right.m5;
+	QMT_REAL m6 = left.m2 * right.m3 + left.m6 * right.m4 + left.m10 * right.m5;
+	QMT_REAL m7 = left.m3 * right.m3 + left.m7 * right.m4 + left.m11 * right.m5;
+	QMT_REAL m8 = left.m0 * right.m6 + left.m4 * right.m7 + left.m8 * right.m8;
+	QMT_REAL m9 = left.m1 * right.m6 + left.m5 * right.m7 + left.m9 * right.m8;
+	QMT_REAL m10 = left.m2 * right.m6 + left.m6 * right.m7 + left.m10 * right.m8;
+	QMT_REAL m11 = left.m3 * right.m6 + left.m7 * right.m7 + left.m11 * right.m8;
+	QMT_REAL m12 = left.m0 * right.m9 + left.m4 * right.m10 + left.m8 * right.m11;
+	QMT_REAL m13 = left.m1 * right.m9 + left.m5 * right.m10 + left.m9 * right.m11;
+	QMT_REAL m14 = left.m2 * right.m9 + left.m6 * right.m10 + left.m10 * right.m11;
+	QMT_REAL m15 = left.m3 * right.m9 + left.m7 * right.m10 + left.m11 * right.m11;
+
+	QMT_TYPE(matrix44) result = {
+		m0, m4, m8, m12,
+		m1, m5, m9, m13,
+		m2, m6, m10, m14,
+		m3, m7, m11, m15
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix34) QMT_FUNCTION(Matrix43, Transpose)(QMT_TYPE(matrix43) mat)
+{
+	QMT_TYPE(matrix34) result = {
+		mat.m0, mat.m1, mat.m2, mat.m3,
+		mat.m4, mat.m5, mat.m6, mat.m7,
+		mat.m8, mat.m9, mat.m10, mat.m11
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix43, Equal)(QMT_TYPE(matrix43) left, QMT_TYPE(matrix43) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5) &&
+		QMT_HELPER(equal)(left.m6, right.m6) &&
+		QMT_HELPER(equal)(left.m7, right.m7) &&
+		QMT_HELPER(equal)(left.m8, right.m8) &&
+		QMT_HELPER(equal)(left.m9, right.m9) &&
+		QMT_HELPER(equal)(left.m10, right.m10) &&
+		QMT_HELPER(equal)(left.m11, right.m11)
+	);
+}
+
+//// Matrix44 functions ////
+
+// Zero matrix function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Zero)(q_void)
+{
+	QMT_TYPE(matrix44) result = {
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 0.0f
+	};
+	return result;
+}
+
+// One matrix function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, One)(q_void)
+{
+	QMT_TYPE(matrix44) result = {
+		1.0f, 1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f, 1.0f,
+		1.0f, 1.0f, 1.0f, 1.0f
+	};
+	return result;
+}
+
+// Identity matrix function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Identity)(q_void)
+{
+	QMT_TYPE(matrix44) result = {
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Add)(QMT_TYPE(matrix44) left, QMT_TYPE(matrix44) right)
+{
+	QMT_TYPE(matrix44) result = {
+		left.m0 + right.m0, left.m4 + right.m4, left.m8 + right.m8, left.m12 + right.m12,
+		left.m1 + right.m1, left.m5 + right.m5, left.m9 + right.m9, left.m13 + right.m13,
+		left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10, left.m14 + right.m14,
+		left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11, left.m15 + right.m15
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Subtract)(QMT_TYPE(matrix44) left, QMT_TYPE(matrix44) right)
+{
+	QMT_TYPE(matrix44) result = {
+		left.m0 + right.m0, left.m4 + right.m4, left.m8 + right.m8, left.m12 + right.m12,
+		left.m1 + right.m1, left.m5 + right.m5, left.m9 + right.m9, left.m13 + right.m13,
+		left.m2 + right.m2, left.m6 + right.m6, left.m10 + right.m10, left.m14 + right.m14,
+		left.m3 + right.m3, left.m7 + right.m7, left.m11 + right.m11, left.m15 + right.m15};
+	return result;
+}
+
+// Multiply Vector4 function
+QM_API QMT_TYPE(vector4) QMT_FUNCTION(Matrix44, MultiplyVector4)(QMT_TYPE(matrix44) mat, QMT_TYPE(vector4) vec)
+{
+	QMT_TYPE(vector4) result = {
+		mat.m0 * vec.x + mat.m4 * vec.y + mat.m8 * vec.z + mat.m12 * vec.w,
+		mat.m1 * vec.x + mat.m5 * vec.y + mat.m9 * vec.z + mat.m13 * vec.w,
+		mat.m2 * vec.x + mat.m6 * vec.y + mat.m10 * vec.z + mat.m14 * vec.w,
+		mat.m3 * vec.x + mat.m7 * vec.y + mat.m11 * vec.z + mat.m15 * vec.w
+	};
+	return result;
+}
+
+// Multiply Matrix42 function
+QM_API QMT_TYPE(matrix42) QMT_FUNCTION(Matrix44, MultiplyMatrix42)(QMT_TYPE(matrix44) left, QMT_TYPE(matrix42) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2 + left.m12 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2 + left.m13 * right.m3;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2 + left.m14 * right.m3;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2 + left.m15 * right.m3;
+	QMT_REAL m4 = left.m0 * right.m4 + left.m4 * right.m5 + left.m8 * right.m6 + left.m12 * right.m7;
+	QMT_REAL m5 = left.m1 * right.m4 + left.m5 * right.m5 + left.m9 * right.m6 + left.m13 * right.m7;
+	QMT_REAL m6 = left.m2 * right.m4 + left.m6 * right.m5 + left.m10 * right.m6 + left.m14 * right.m7;
+	QMT_REAL m7 = left.m3 * right.m4 + left.m7 * right.m5 + left.m11 * right.m6 + left.m15 * right.m7;
+
+	QMT_TYPE(matrix42) result = {
+		m0, m4,
+		m1, m5,
+		m2, m6,
+		m3, m7
+	};
+	return result;
+}
+
+// Multiply Matrix43 function
+QM_API QMT_TYPE(matrix43) QMT_FUNCTION(Matrix44, MultiplyMatrix43)(QMT_TYPE(matrix44) left, QMT_TYPE(matrix43) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2 + left.m12 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2 + left.m13 * right.m3;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2 + left.m14 * right.m3;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2 + left.m15 * right.m3;
+	QMT_REAL m4 = left.m0 * right.m4 + left.m4 * right.m5 + left.m8 * right.m6 + left.m12 * right.m7;
+	QMT_REAL m5 = left.m1 * right.m4 + left.m5 * right.m5 + left.m9 * right.m6 + left.m13 * right.m7;
+	QMT_REAL m6 = left.m2 * right.m4 + left.m6 * right.m5 + left.m10 * right.m6 + left.m14 * right.m7;
+	QMT_REAL m7 = left.m3 * right.m4 + left.m7 * right.m5 + left.m11 * right.m6 + left.m15 * right.m7;
+	QMT_REAL m8 = left.m0 * right.m8 + left.m4 * right.m9 + left.m8 * right.m10 + left.m12 * right.m11;
+	QMT_REAL m9 = left.m1 * right.m8 + left.m5 * right.m9 + left.m9 * right.m10 + left.m13 * right.m11;
+	QMT_REAL m10 = left.m2 * right.m8 + left.m6 * right.m9 + left.m10 * right.m10 + left.m14 * right.m11;
+	QMT_REAL m11 = left.m3 * right.m8 + left.m7 * right.m9 + left.m11 * right.m10 + left.m15 * right.m11;
+
+	QMT_TYPE(matrix43) result = {
+		m0, m4, m8,
+		m1, m5, m9,
+		m2, m6, m10,
+		m3, m7, m11
+	};
+	return result;
+}
+
+// Multiply Matrix44 function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, MultiplyMatrix44)(QMT_TYPE(matrix44) left, QMT_TYPE(matrix44) right)
+{
+	QMT_REAL m0 = left.m0 * right.m0 + left.m4 * right.m1 + left.m8 * right.m2 + left.m12 * right.m3;
+	QMT_REAL m1 = left.m1 * right.m0 + left.m5 * right.m1 + left.m9 * right.m2 + left.m13 * right.m3;
+	QMT_REAL m2 = left.m2 * right.m0 + left.m6 * right.m1 + left.m10 * right.m2 + left.m14 * right.m3;
+	QMT_REAL m3 = left.m3 * right.m0 + left.m7 * right.m1 + left.m11 * right.m2 + left.m15 * right.m3;
+	QMT_REAL m4 = left.m0 * right.m4 + left.m4 * right.m5 + left.m8 * right.m6 + left.m12 * right.m7;
+	QMT_REAL m5 = left.m1 * right.m4 + left.m5 * right.m5 + left.m9 * right.m6 + left.m13 * right.m7;
+	QMT_REAL m6 = left.m2 * right.m4 + left.m6 * right.m5 + left.m10 * right.m6 + left.m14 * right.m7;
+	QMT_REAL m7 = left.m3 * right.m4 + left.m7 * right.m5 + left.m11 * right.m6 + left.m15 * right.m7;
+	QMT_REAL m8 = left.m0 * right.m8 + left.m4 * right.m9 + left.m8 * right.m10 + left.m12 * right.m11;
+	QMT_REAL m9 = left.m1 * right.m8 + left.m5 * right.m9 + left.m9 * right.m10 + left.m13 * right.m11;
+	QMT_REAL m10 = left.m2 * right.m8 + left.m6 * right.m9 + left.m10 * right.m10 + left.m14 * right.m11;
+	QMT_REAL m11 = left.m3 * right.m8 + left.m7 * right.m9 + left.m11 * right.m10 + left.m15 * right.m11;
+	QMT_REAL m12 = left.m0 * right.m12 + left.m4 * right.m13 + left.m8 * right.m14 + left.m12 * right.m15;
+	QMT_REAL m13 = left.m1 * right.m12 + left.m5 * right.m13 + left.m9 * right.m14 + left.m13 * right.m15;
+	QMT_REAL m14 = left.m2 * right.m12 + left.m6 * right.m13 + left.m10 * right.m14 + left.m14 * right.m15;
+	QMT_REAL m15 = left.m3 * right.m12 + left.m7 * right.m13 + left.m11 * right.m14 + left.m15 * right.m15;
+
+	QMT_TYPE(matrix44) result = {
+		m0, m4, m8, m12,
+		m1, m5, m9, m13,
+		m2, m6, m10, m14,
+		m3, m7, m11, m15
+	};
+	return result;
+}
+
+// Transpose function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Transpose)(QMT_TYPE(matrix44) mat)
+{
+	QMT_TYPE(matrix44) result = {
+		mat.m0, mat.m1, mat.m2, mat.m3,
+		mat.m4, mat.m5, mat.m6, mat.m7,
+		mat.m8, mat.m9, mat.m10, mat.m11,
+		mat.m12, mat.m13, mat.m14, mat.m15
+	};
+	return result;
+}
+
+// Inverse function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Inverse)(QMT_TYPE(matrix44) mat)
+{
+	// 2x2 sub-determinants of the first and last two columns, shared with qmMatrix44Determinant(mat)
+	QMT_REAL s0 = mat.m0 * mat.m5 - mat.m4 * mat.m1;
+	QMT_REAL s1 = mat.m0 * mat.m6 - mat.m4 * mat.m2;
+	QMT_REAL s2 = mat.m0 * mat.m7 - mat.m4 * mat.m3;
+	QMT_REAL s3 = mat.m1 * mat.m6 - mat.m5 * mat.m2;
+	QMT_REAL s4 = mat.m1 * mat.m7 - mat.m5 * mat.m3;
+	QMT_REAL s5 = mat.m2 * mat.m7 - mat.m6 * mat.m3;
+	QMT_REAL c0 = mat.m8 * mat.m13 - mat.m12 * mat.m9;
+	QMT_REAL c1 = mat.m8 * mat.m14 - mat.m12 * mat.m10;
+	QMT_REAL c2 = mat.m8 * mat.m15 - mat.m12 * mat.m11;
+	QMT_REAL c3 = mat.m9 * mat.m14 - mat.m13 * mat.m10;
+	QMT_REAL c4 = mat.m9 * mat.m15 - mat.m13 * mat.m11;
+	QMT_REAL c5 = mat.m10 * mat.m15 - mat.m14 * mat.m11;
+
+	QMT_REAL inv = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+#if defined(QMT_SIMD)
+	// Each group of four results expands one source column against the sub-determinants
+	QMT_SIMD_TYPE sign = QMT_SIMD_OP(set)(inv, -inv, inv, -inv);
+	QMT_SIMD_TYPE cl = QMT_SIMD_OP(set)(c5, c5, c4, c3);
+	QMT_SIMD_TYPE cm = QMT_SIMD_OP(set)(c4, c2, c2, c1);
+	QMT_SIMD_TYPE cr = QMT_SIMD_OP(set)(c3, c1, c0, c0);
+	QMT_SIMD_TYPE sl = QMT_SIMD_OP(set)(s5, s5, s4, s3);
+	QMT_SIMD_TYPE sm = QMT_SIMD_OP(set)(s4, s2, s2, s1);
+	QMT_SIMD_TYPE sr = QMT_SIMD_OP(set)(s3, s1, s0, s0);
+
+	QMT_SIMD_TYPE src[4] = {
+		QMT_SIMD_OP(set)(mat.m0, mat.m1, mat.m2, mat.m3),
+		QMT_SIMD_OP(set)(mat.m4, mat.m5, mat.m6, mat.m7),
+		QMT_SIMD_OP(set)(mat.m8, mat.m9, mat.m10, mat.m11),
+		QMT_SIMD_OP(set)(mat.m12, mat.m13, mat.m14, mat.m15)
+	};
+	QMT_TYPE(vector4) dst[4];
+	for (q_int i = 0; i < 4; i++)
+	{
+		QMT_SIMD_TYPE vec = src[i ^ 1];
+		QMT_SIMD_TYPE l = i < 2 ? cl : sl;
+		QMT_SIMD_TYPE m = i < 2 ? cm : sm;
+		QMT_SIMD_TYPE r = i < 2 ? cr : sr;
+
+		QMT_SIMD_TYPE exp = QMT_SIMD_OP(mul)(QMT_SWIZZLE(vec, 1, 0, 0, 0), l);
+		exp = QMT_SIMD_OP(sub)(exp, QMT_SIMD_OP(mul)(QMT_SWIZZLE(vec, 2, 2, 1, 1), m));
+		exp = QMT_SIMD_OP(add)(exp, QMT_SIMD_OP(mul)(QMT_SWIZZLE(vec, 3, 3, 3, 2), r));
+		exp = QMT_SIMD_OP(mul)(exp, sign);
+		dst[i] = QMT_SIMD_OP(store)(i & 1 ? QMT_SIMD_OP(mul)(exp, QMT_SIMD_OP(splat)(-1.0f)) : exp);
+	}
+
+	QMT_TYPE(matrix44) result = {
+		dst[0].x, dst[0].y, dst[0].z, dst[0].w,
+		dst[1].x, dst[1].y, dst[1].z, dst[1].w,
+		dst[2].x, dst[2].y, dst[2].z, dst[2].w,
+		dst[3].x, dst[3].y, dst[3].z, dst[3].w
+	};
+	return result;
+#else
+	QMT_TYPE(matrix44) result = {
+		(mat.m5 * c5 - mat.m6 * c4 + mat.m7 * c3) * inv,
+		(-mat.m4 * c5 + mat.m6 * c2 - mat.m7 * c1) * inv,
+		(mat.m4 * c4 - mat.m5 * c2 + mat.m7 * c0) * inv,
+		(-mat.m4 * c3 + mat.m5 * c1 - mat.m6 * c0) * inv,
+		(-mat.m1 * c5 + mat.m2 * c4 - mat.m3 * c3) * inv,
+		(mat.m0 * c5 - mat.m2 * c2 + mat.m3 * c1) * inv,
+		(-mat.m0 * c4 + mat.m1 * c2 - mat.m3 * c0) * inv,
+		(mat.m0 * c3 - mat.m1 * c1 + mat.m2 * c0) * inv,
+		(mat.m13 * s5 - mat.m14 * s4 + mat.m15 * s3) * inv,
+		(-mat.m12 * s5 + mat.m14 * s2 - mat.m15 * s1) * inv,
+		(mat.m12 * s4 - mat.m13 * s2 + mat.m15 * s0) * inv,
+		(-mat.m12 * s3 + mat.m13 * s1 - mat.m14 * s0) * inv,
+		(-mat.m9 * s5 + mat.m10 * s4 - mat.m11 * s3) * inv,
+		(mat.m8 * s5 - mat.m10 * s2 + mat.m11 * s1) * inv,
+		(-mat.m8 * s4 + mat.m9 * s2 - mat.m11 * s0) * inv,
+		(mat.m8 * s3 - mat.m9 * s1 + mat.m10 * s0) * inv
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Affine inverse function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, InverseAffine)(QMT_TYPE(matrix44) mat)
+{
+	// Assumes the bottom row is (0, 0, 0, 1), as built by the translate, rotate and scale matrices
+	QMT_TYPE(vector3) a = { mat.m0, mat.m1, mat.m2 };
+	QMT_TYPE(vector3) b = { mat.m4, mat.m5, mat.m6 };
+	QMT_TYPE(vector3) c = { mat.m8, mat.m9, mat.m10 };
+
+	QMT_TYPE(vector3) r0 = { b.y * c.z - b.z * c.y, b.z * c.x - b.x * c.z, b.x * c.y - b.y * c.x }; // qmVector3CrossProduct(b, c)
+	QMT_TYPE(vector3) r1 = { c.y * a.z - c.z * a.y, c.z * a.x - c.x * a.z, c.x * a.y - c.y * a.x }; // qmVector3CrossProduct(c, a)
+	QMT_TYPE(vector3) r2 = { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; // qmVector3CrossProduct(a, b)
+
+	QMT_REAL inv = 1.0f / (a.x * r0.x + a.y * r0.y + a.z * r0.z); // qmVector3DotProduct(a, r0)
+	r0.x *= inv; r0.y *= inv; r0.z *= inv;
+	r1.x *= inv; r1.y *= inv; r1.z *= inv;
+	r2.x *= inv; r2.y *= inv; r2.z *= inv;
+
+	QMT_TYPE(matrix44) result = {
+		r0.x, r0.y, r0.z, -(r0.x * mat.m12 + r0.y * mat.m13 + r0.z * mat.m14),
+		r1.x, r1.y, r1.z, -(r1.x * mat.m12 + r1.y * mat.m13 + r1.z * mat.m14),
+		r2.x, r2.y, r2.z, -(r2.x * mat.m12 + r2.y * mat.m13 + r2.z * mat.m14),
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rigid inverse function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, InverseRigid)(QMT_TYPE(matrix44) mat)
+{
+	// Assumes an orthonormal rotation and translation only, so the rotation inverts by transposing
+	QMT_TYPE(matrix44) result = {
+		mat.m0, mat.m1, mat.m2, -(mat.m0 * mat.m12 + mat.m1 * mat.m13 + mat.m2 * mat.m14),
+		mat.m4, mat.m5, mat.m6, -(mat.m4 * mat.m12 + mat.m5 * mat.m13 + mat.m6 * mat.m14),
+		mat.m8, mat.m9, mat.m10, -(mat.m8 * mat.m12 + mat.m9 * mat.m13 + mat.m10 * mat.m14),
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Translation matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Translate)(QMT_REAL x, QMT_REAL y, QMT_REAL z)
+{
+	QMT_TYPE(matrix44) result = {
+		1.0f, 0.0f, 0.0f, x,
+		0.0f, 1.0f, 0.0f, y,
+		0.0f, 0.0f, 1.0f, z,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rotation by given axis matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Rotate)(QMT_TYPE(vector3) axis, QMT_REAL angle)
+{
+	QMT_REAL alen = QMT_MATH(sqrt)(QMT_HELPER(sq)(axis.x) + QMT_HELPER(sq)(axis.y) + QMT_HELPER(sq)(axis.z)); // qmVector3Length(axis)
+	if (alen > 0.0f) // qmVector3DivideScalar(axis, alen)
+	{
+		axis.x /= alen;
+		axis.y /= alen;
+		axis.z /= alen;
+	}
+
+	QMT_REAL s, c;
+	QMT_HELPER(sinecosine)(angle, &s, &c);
+	QMT_REAL t = 1.0f - c;
+
+	QMT_TYPE(matrix44) result = {
+		axis.x * axis.x * t + c, axis.x * axis.y * t - axis.z * s, axis.x * axis.z * t + axis.y * s, 0.0f,
+		axis.y * axis.x * t + axis.z * s, axis.y * axis.y * t + c, axis.y * axis.z * t - axis.x * s, 0.0f,
+		axis.z * axis.x * t - axis.y * s, axis.z * axis.y * t + axis.x * s, axis.z * axis.z * t + c, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rotation by x-axis matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, RotateX)(QMT_REAL angle)
+{
+	QMT_REAL s, c;
+	QMT_HELPER(sinecosine)(angle, &s, &c);
+
+	QMT_TYPE(matrix44) result = {
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, c, -s, 0.0f,
+		0.0f, s, c, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rotation by y-axis matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, RotateY)(QMT_REAL angle)
+{
+	QMT_REAL s, c;
+	QMT_HELPER(sinecosine)(angle, &s, &c);
+
+	QMT_TYPE(matrix44) result = {
+		c, 0.0f, s, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		-s, 0.0f, c, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rotation by z-axis matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, RotateZ)(QMT_REAL angle)
+{
+	QMT_REAL s, c;
+	QMT_HELPER(sinecosine)(angle, &s, &c);
+
+	QMT_TYPE(matrix44) result = {
+		c, -s, 0.0f, 0.0f,
+		s, c, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rotation by angle vector matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, RotateXYZ)(QMT_TYPE(vector3) angle)
+{
+	QMT_REAL sx, cx, sy, cy, sz, cz;
+	QMT_HELPER(sinecosine)(angle.x, &sx, &cx);
+	QMT_HELPER(sinecosine)(angle.y, &sy, &cy);
+	QMT_HELPER(sinecosine)(angle.z, &sz, &cz);
+
+	QMT_TYPE(matrix44) result = {
+		cy * cz, cy * sz, -sy, 0.0f,
+		sx * sy * cz - cx * sz, sx * sy * sz + cx * cz, sx * cy, 0.0f,
+		cx * sy * cz + sx * sz, cx * sy * sz - sx * cz, cx * cy, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Scaling matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Scale)(QMT_REAL x, QMT_REAL y, QMT_REAL z)
+{
+	QMT_TYPE(matrix44) result = {
+		x, 0.0f, 0.0f, 0.0f,
+		0.0f, y, 0.0f, 0.0f,
+		0.0f, 0.0f, z, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Frustum matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Frustum)(QMT_REAL left, QMT_REAL right, QMT_REAL top, QMT_REAL bottom, QMT_REAL near, QMT_REAL far)
+{
+	QMT_REAL dx = right - left;
+	QMT_REAL dy = top - bottom;
+	QMT_REAL dz = far - near;
+
+	QMT_TYPE(matrix44) result = {
+		near * 2.0f / dx, 0.0f, (left + right) / dx, 0.0f,
+		0.0f, near * 2.0f / dy, (top + bottom) / dy, 0.0f,
+		0.0f, 0.0f, -(near + far) / dz, -near * far * 2.0f / dz,
+		0.0f, 0.0f, -1.0f, 0.0f
+	};
+	return result;
+}
+
+// Perspective projection matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Perspective)(QMT_REAL fov, QMT_REAL aspect, QMT_REAL near, QMT_REAL far)
+{
+	QMT_REAL top = near * tan(fov * 0.5f);
+	QMT_REAL bottom = -top;
+	QMT_REAL right = top * aspect;
+	QMT_REAL left = -right;
+
+	// qmMatrix44Frustum(left, right, top, bottom, near, far)
+	QMT_REAL dx = right - left;
+	QMT_REAL dy = top - bottom;
+	QMT_REAL dz = far - near;
+
+	QMT_TYPE(matrix44) result = {
+		near * 2.0f / dx, 0.0f, (left + right) / dx, 0.0f,
+		0.0f, near * 2.0f / dy, (top + bottom) / dy, 0.0f,
+		0.0f, 0.0f, -(near + far) / dz, -near * far * 2.0f / dz,
+		0.0f, 0.0f, -1.0f, 0.0f
+	};
+	return result;
+}
+
+// Orthographic projection matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, Orthographic)(QMT_REAL left, QMT_REAL right, QMT_REAL top, QMT_REAL bottom, QMT_REAL near, QMT_REAL far)
+{
+	QMT_REAL dx = right - left;
+	QMT_REAL dy = top - bottom;
+	QMT_REAL dz = far - near;
+
+	QMT_TYPE(matrix44) result = {
+		2.0f / dx, 0.0f, 0.0f, -(left + right) / dx,
+		0.0f, 2.0f / dy, 0.0f, -(top + bottom) / dy,
+		0.0f, 0.0f, -2.0f / dz, -(near + far) / dz,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Camera look-at matrix
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Matrix44, LookAt)(QMT_TYPE(vector3) source, QMT_TYPE(vector3) target, QMT_TYPE(vector3) up)
+{
+	QMT_REAL len = 0.0f;
+
+	QMT_TYPE(vector3) vz = { source.x - target.x, source.y - target.y, source.z - target.z }; // qmVector3Subtract(source, target)
+
+	// qmVector3Normalize(vz)
+	len = QMT_MATH(sqrt)(QMT_HELPER(sq)(vz.x) + QMT_HELPER(sq)(vz.y) + QMT_HELPER(sq)(vz.z));
+	if (len > 0.0f)
+	{
+		vz.x /= len;
+		vz.y /= len;
+		vz.z /= len;
+	}
+
+	QMT_TYPE(vector3) vx = { up.y * vz.z - up.z * vz.y, up.z * vz.x - up.x * vz.z, up.x * vz.y - up.y * vz.x }; // qmVector3CrossProduct(up, vz)
+
+	// qmVector3Normalize(vx)
+	len = QMT_MATH(sqrt)(QMT_HELPER(sq)(vx.x) + QMT_HELPER(sq)(vx.y) + QMT_HELPER(sq)(vx.z));
+	if (len > 0.0f)
+	{
+		vx.x /= len;
+		vx.y /= len;
+		vx.z /= len;
+	}
+
+	QMT_TYPE(vector3) vy = { vz.y * vx.z - vz.z * vx.y, vz.z * vx.x - vz.x * vx.z, vz.x * vx.y - vz.y * vx.x }; // qmVector3CrossProduct(vz, vx)
+
+	QMT_TYPE(matrix44) result = {
+		vx.x, vx.y, vx.z, -(vx.x * source.x + vx.y * source.y + vx.z * source.z), // qmVector3DotProduct(vx, source)
+		vy.x, vy.y, vy.z, -(vy.x * source.x + vy.y * source.y + vy.z * source.z), // qmVector3DotProduct(vy, source)
+		vz.x, vz.y, vz.z, -(vz.x * source.x + vz.y * source.y + vz.z * source.z), // qmVector3DotProduct(vz, source)
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Determinant function
+QM_API QMT_REAL QMT_FUNCTION(Matrix44, Determinant)(QMT_TYPE(matrix44) mat)
+{
+	// Laplace expansion over 2x2 sub-determinants, shared with qmMatrix44Inverse(mat)
+	QMT_REAL s0 = mat.m0 * mat.m5 - mat.m4 * mat.m1;
+	QMT_REAL s1 = mat.m0 * mat.m6 - mat.m4 * mat.m2;
+	QMT_REAL s2 = mat.m0 * mat.m7 - mat.m4 * mat.m3;
+	QMT_REAL s3 = mat.m1 * mat.m6 - mat.m5 * mat.m2;
+	QMT_REAL s4 = mat.m1 * mat.m7 - mat.m5 * mat.m3;
+	QMT_REAL s5 = mat.m2 * mat.m7 - mat.m6 * mat.m3;
+	QMT_REAL c0 = mat.m8 * mat.m13 - mat.m12 * mat.m9;
+	QMT_REAL c1 = mat.m8 * mat.m14 - mat.m12 * mat.m10;
+	QMT_REAL c2 = mat.m8 * mat.m15 - mat.m12 * mat.m11;
+	QMT_REAL c3 = mat.m9 * mat.m14 - mat.m13 * mat.m10;
+	QMT_REAL c4 = mat.m9 * mat.m15 - mat.m13 * mat.m11;
+	QMT_REAL c5 = mat.m10 * mat.m15 - mat.m14 * mat.m11;
+
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+// Trace function
+QM_API QMT_REAL QMT_FUNCTION(Matrix44, Trace)(QMT_TYPE(matrix44) mat)
+{
+	return mat.m0 + mat.m5 + mat.m10 + mat.m15;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Matrix44, Equal)(QMT_TYPE(matrix44) left, QMT_TYPE(matrix44) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.m0, right.m0) &&
+		QMT_HELPER(equal)(left.m1, right.m1) &&
+		QMT_HELPER(equal)(left.m2, right.m2) &&
+		QMT_HELPER(equal)(left.m3, right.m3) &&
+		QMT_HELPER(equal)(left.m4, right.m4) &&
+		QMT_HELPER(equal)(left.m5, right.m5) &&
+		QMT_HELPER(equal)(left.m6, right.m6) &&
+		QMT_HELPER(equal)(left.m7, right.m7) &&
+		QMT_HELPER(equal)(left.m8, right.m8) &&
+		QMT_HELPER(equal)(left.m9, right.m9) &&
+		QMT_HELPER(equal)(left.m10, right.m10) &&
+		QMT_HELPER(equal)(left.m11, right.m11) &&
+		QMT_HELPER(equal)(left.m12, right.m12) &&
+		QMT_HELPER(equal)(left.m13, right.m13) &&
+		QMT_HELPER(equal)(left.m14, right.m14) &&
+		QMT_HELPER(equal)(left.m15, right.m15)
+	);
+}
+
+//// Quaternion functions ////
+
+// Identity function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Identity)(q_void)
+{
+	QMT_TYPE(quaternion) result = {0.0f, 0.0f, 0.0f, 1.0f};
+	return result;
+}
+
+// Add function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Add)(QMT_TYPE(quaternion) left, QMT_TYPE(quaternion) right)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(add)(QMT_SIMD_OP(load)(left), QMT_SIMD_OP(load)(right)));
+#else
+	QMT_TYPE(quaternion) result = {
+		left.x + right.x,
+		left.y + right.y,
+		left.z + right.z,
+		left.w + right.w
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Scalar add function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, AddScalar)(QMT_TYPE(quaternion) quat, QMT_REAL scl)
+{
+	QMT_TYPE(quaternion) result = {
+		quat.x + scl,
+		quat.y + scl,
+		quat.z + scl,
+		quat.w + scl
+	};
+	return result;
+}
+
+// Subtract function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Subtract)(QMT_TYPE(quaternion) left, QMT_TYPE(quaternion) right)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(sub)(QMT_SIMD_OP(load)(left), QMT_SIMD_OP(load)(right)));
+#else
+	QMT_TYPE(quaternion) result = {
+		left.x - right.x,
+		left.y - right.y,
+		left.z - right.z,
+		left.w - right.w
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Scalar subtract function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, SubtractScalar)(QMT_TYPE(quaternion) quat, QMT_REAL scl)
+{
+	QMT_TYPE(quaternion) result = {
+		quat.x - scl,
+		quat.y - scl,
+		quat.z - scl,
+		quat.w - scl
+	};
+	return result;
+}
+
+// Multiply function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Multiply)(QMT_TYPE(quaternion) left, QMT_TYPE(quaternion) right)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE l = QMT_SIMD_OP(load)(left);
+	QMT_SIMD_TYPE r = QMT_SIMD_OP(load)(right);
+	QMT_SIMD_TYPE sign = QMT_SIMD_OP(set)(1.0f, 1.0f, 1.0f, -1.0f);
+
+	QMT_SIMD_TYPE result = QMT_SIMD_OP(mul)(l, QMT_SWIZZLE(r, 3, 3, 3, 3));
+	result = QMT_SIMD_OP(add)(result, QMT_SIMD_OP(mul)(QMT_SIMD_OP(mul)(QMT_SWIZZLE(l, 3, 3, 3, 0), QMT_SWIZZLE(r, 0, 1, 2, 0)), sign));
+	result = QMT_SIMD_OP(add)(result, QMT_SIMD_OP(mul)(QMT_SIMD_OP(mul)(QMT_SWIZZLE(l, 1, 2, 0, 1), QMT_SWIZZLE(r, 2, 0, 1, 1)), sign));
+	result = QMT_SIMD_OP(sub)(result, QMT_SIMD_OP(mul)(QMT_SWIZZLE(l, 2, 0, 1, 2), QMT_SWIZZLE(r, 1, 2, 0, 2)));
+	return QMT_SIMD_OP(store)(result);
+#else
+	QMT_TYPE(quaternion) result = {
+		left.x * right.w + left.w * right.x + left.y * right.z - left.z * right.y,
+		left.y * right.w + left.w * right.y + left.z * right.x - left.x * right.z,
+		left.z * right.w + left.w * right.z + left.x * right.y - left.y * right.x,
+		left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Scale function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Scale)(QMT_TYPE(quaternion) quat, QMT_REAL scl)
+{
+#if defined(QMT_SIMD)
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(mul)(QMT_SIMD_OP(load)(quat), QMT_SIMD_OP(splat)(scl)));
+#else
+	QMT_TYPE(quaternion) result = {
+		quat.x * scl,
+		quat.y * scl,
+		quat.z * scl,
+		quat.w * scl
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Divide function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Divide)(QMT_TYPE(quaternion) left, QMT_TYPE(quaternion) right)
+{
+	QMT_TYPE(quaternion) result = {
+		left.x / right.x,
+		left.y / right.y,
+		left.z / right.z,
+		left.w / right.w
+	};
+	return result;
+}
+
+// Normalize function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Normalize)(QMT_TYPE(quaternion) quat)
+{
+#if defined(QMT_SIMD) && defined(Q_MATH_FAST)
+	QMT_SIMD_TYPE reg = QMT_SIMD_OP(load)(quat);
+	QMT_REAL squared = QMT_SIMD_OP(dot)(reg, reg);
+	if (squared == 0.0f)
+	{
+		return quat;
+	}
+
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(mul)(reg, QMT_SIMD_OP(splat)(QMT_HELPER(invsqrt)(squared)))); // qmQuaternionScale(quat, 1 / length)
+#elif defined(QMT_SIMD)
+	QMT_SIMD_TYPE reg = QMT_SIMD_OP(load)(quat);
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_SIMD_OP(dot)(reg, reg)); // qmQuaternionLength(quat)
+	if (length == 0.0f)
+	{
+		return quat;
+	}
+
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(div)(reg, QMT_SIMD_OP(splat)(length))); // qmQuaternionScale(quat, 1 / length)
+#elif defined(Q_MATH_FAST)
+	QMT_REAL squared = QMT_HELPER(sq)(quat.x) + QMT_HELPER(sq)(quat.y) + QMT_HELPER(sq)(quat.z) + QMT_HELPER(sq)(quat.w);
+	if (squared == 0.0f)
+	{
+		return quat;
+	}
+
+	QMT_REAL inv = QMT_HELPER(invsqrt)(squared);
+	QMT_TYPE(quaternion) result = { // qmQuaternionScale(quat, inv)
+		quat.x * inv,
+		quat.y * inv,
+		quat.z * inv,
+		quat.w * inv
+	};
+	return result;
+#else
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(quat.x) + QMT_HELPER(sq)(quat.y) + QMT_HELPER(sq)(quat.z) + QMT_HELPER(sq)(quat.w)); // qmQuaternionLength(quat)
+	if (length == 0.0f)
+	{
+		return quat;
+	}
+
+	QMT_TYPE(quaternion) result = { // qmQuaternionScale(quat, 1 / length)
+		quat.x / length,
+		quat.y / length,
+		quat.z / length,
+		quat.w / length
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Invert function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Invert)(QMT_TYPE(quaternion) quat)
+{
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(quat.x) + QMT_HELPER(sq)(quat.y) + QMT_HELPER(sq)(quat.z) + QMT_HELPER(sq)(quat.w)); // qmQuaternionLength(quat)
+	if (length == 0.0f)
+	{
+		return quat;
+	}
+
+	QMT_TYPE(quaternion) result = { // qmQuaternionScale(quat, -1 / length)
+		-quat.x / length,
+		-quat.y / length,
+		-quat.z / length,
+		-quat.w / length
+	};
+	return result;
+}
+
+// Linear interpolation function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Lerp)(QMT_REAL value, QMT_TYPE(quaternion) start, QMT_TYPE(quaternion) end)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE from = QMT_SIMD_OP(load)(start);
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(add)(from, QMT_SIMD_OP(mul)(QMT_SIMD_OP(splat)(value), QMT_SIMD_OP(sub)(QMT_SIMD_OP(load)(end), from))));
+#else
+	QMT_TYPE(quaternion) result = {
+		start.x + value * (end.x - start.x), // qmFloatLerp(value, start.x, end.x)
+		start.y + value * (end.y - start.y), // qmFloatLerp(value, start.y, end.y)
+		start.z + value * (end.z - start.z), // qmFloatLerp(value, start.z, end.z)
+		start.w + value * (end.w - start.w)  // qmFloatLerp(value, start.w, end.w)
+	};
+	return result;
+#endif /* QMT_SIMD */
+}
+
+// Normalized linear interpolation function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Nlerp)(QMT_REAL value, QMT_TYPE(quaternion) start, QMT_TYPE(quaternion) end)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE from = QMT_SIMD_OP(load)(start);
+	QMT_SIMD_TYPE lerp = QMT_SIMD_OP(add)(from, QMT_SIMD_OP(mul)(QMT_SIMD_OP(splat)(value), QMT_SIMD_OP(sub)(QMT_SIMD_OP(load)(end), from))); // qmQuaternionLerp(value, start, end)
+
+#if defined(Q_MATH_FAST)
+	QMT_REAL squared = QMT_SIMD_OP(dot)(lerp, lerp);
+	if (squared == 0.0f)
+	{
+		return QMT_SIMD_OP(store)(lerp);
+	}
+
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(mul)(lerp, QMT_SIMD_OP(splat)(QMT_HELPER(invsqrt)(squared)))); // qmQuaternionScale(lerp, 1 / length)
+#else
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_SIMD_OP(dot)(lerp, lerp)); // qmQuaternionLength(lerp)
+	if (length == 0.0f)
+	{
+		return QMT_SIMD_OP(store)(lerp);
+	}
+
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(div)(lerp, QMT_SIMD_OP(splat)(length))); // qmQuaternionScale(lerp, 1 / length)
+#endif /* Q_MATH_FAST */
+#else
+	QMT_TYPE(quaternion) lerp = { // qmQuaternionLerp(value, start, end)
+		start.x + value * (end.x - start.x),
+		start.y + value * (end.y - start.y),
+		start.z + value * (end.z - start.z),
+		start.w + value * (end.w - start.w)
+	};
+
+#if defined(Q_MATH_FAST)
+	QMT_REAL squared = QMT_HELPER(sq)(lerp.x) + QMT_HELPER(sq)(lerp.y) + QMT_HELPER(sq)(lerp.z) + QMT_HELPER(sq)(lerp.w);
+	if (squared == 0.0f)
+	{
+		return lerp;
+	}
+
+	QMT_REAL inv = QMT_HELPER(invsqrt)(squared);
+	QMT_TYPE(quaternion) result = { // qmQuaternionScale(lerp, inv)
+		lerp.x * inv,
+		lerp.y * inv,
+		lerp.z * inv,
+		lerp.w * inv
+	};
+	return result;
+#else
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(lerp.x) + QMT_HELPER(sq)(lerp.y) + QMT_HELPER(sq)(lerp.z) + QMT_HELPER(sq)(lerp.w)); // qmQuaternionLength(lerp)
+	if (length == 0.0f)
+	{
+		return lerp;
+	}
+
+	QMT_TYPE(quaternion) result = { // qmQuaternionScale(lerp, 1 / length)
+		lerp.x / length,
+		lerp.y / length,
+		lerp.z / length,
+		lerp.w / length
+	};
+	return result;
+#endif /* Q_MATH_FAST */
+#endif /* QMT_SIMD */
+}
+
+// Spherical linear interpolation function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, Slerp)(QMT_REAL value, QMT_TYPE(quaternion) start, QMT_TYPE(quaternion) end)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE from = QMT_SIMD_OP(load)(start);
+	QMT_SIMD_TYPE to = QMT_SIMD_OP(load)(end);
+
+	QMT_REAL cosHalf = QMT_SIMD_OP(dot)(from, to);
+	if (cosHalf < 0.0f)
+	{
+		to = QMT_SIMD_OP(mul)(to, QMT_SIMD_OP(splat)(-1.0f)); // qmQuaternionScale(end, -1)
+		cosHalf *= -1.0f;
+	}
+	if (QMT_MATH(fabs)(cosHalf) >= 1.0f)
+	{
+		return start;
+	}
+
+	QMT_REAL half = QMT_HELPER(arccosine)(cosHalf);
+	QMT_REAL sinHalf = QMT_MATH(sqrt)(1.0f - QMT_HELPER(sq)(cosHalf));
+	if (QMT_MATH(fabs)(sinHalf) < QMT_EPSILON)
+	{
+		return QMT_SIMD_OP(store)(QMT_SIMD_OP(mul)(QMT_SIMD_OP(add)(from, to), QMT_SIMD_OP(splat)(0.5f))); // qmQuaternionLerp(0.5, start, end)
+	}
+
+	QMT_REAL ra = QMT_HELPER(sine)((1.0f - value) * half) / sinHalf;
+	QMT_REAL rb = QMT_HELPER(sine)(value * half) / sinHalf;
+	return QMT_SIMD_OP(store)(QMT_SIMD_OP(add)(QMT_SIMD_OP(mul)(from, QMT_SIMD_OP(splat)(ra)), QMT_SIMD_OP(mul)(to, QMT_SIMD_OP(splat)(rb))));
+#else
+	QMT_REAL cosHalf = start.x * end.x + start.y * end.y + start.z * end.z + start.w * end.w;
+	if (cosHalf < 0.0f)
+	{
+		// qmQuaternionScale(end, -1)
+		end.x *= -1.0f;
+		end.y *= -1.0f;
+		end.z *= -1.0f;
+		end.w *= -1.0f;
+
+		cosHalf *= -1.0f;
+	}
+	if (QMT_MATH(fabs)(cosHalf) >= 1.0f)
+	{
+		return start;
+	}
+
+	QMT_REAL half = QMT_HELPER(arccosine)(cosHalf);
+	QMT_REAL sinHalf = QMT_MATH(sqrt)(1.0f - QMT_HELPER(sq)(cosHalf));
+	if (QMT_MATH(fabs)(sinHalf) < QMT_EPSILON)
+	{
+		QMT_TYPE(quaternion) result = { // qmQuaternionLerp(0.5, start, end)
+			(start.x + end.x) * 0.5f,
+			(start.y + end.y) * 0.5f,
+			(start.z + end.z) * 0.5f,
+			(start.w + end.w) * 0.5f
+		};
+		return result;
+	}
+	else
+	{
+		QMT_REAL ra = QMT_HELPER(sine)((1.0f - value) * half) / sinHalf;
+		QMT_REAL rb = QMT_HELPER(sine)(value * half) / sinHalf;
+		QMT_TYPE(quaternion) result = {
+			start.x * ra + end.x * rb,
+			start.y * ra + end.y * rb,
+			start.z * ra + end.z * rb,
+			start.w * ra + end.w * rb
+		};
+		return result;
+	}
+#endif /* QMT_SIMD */
+}
+
+// Length function
+QM_API QMT_REAL QMT_FUNCTION(Quaternion, Length)(QMT_TYPE(quaternion) quat)
+{
+#if defined(QMT_SIMD)
+	QMT_SIMD_TYPE reg = QMT_SIMD_OP(load)(quat);
+	return QMT_MATH(sqrt)(QMT_SIMD_OP(dot)(reg, reg));
+#else
+	return QMT_MATH(sqrt)(QMT_HELPER(sq)(quat.x) + QMT_HELPER(sq)(quat.y) + QMT_HELPER(sq)(quat.z) + QMT_HELPER(sq)(quat.w));
+#endif /* QMT_SIMD */
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(Quaternion, Equal)(QMT_TYPE(quaternion) left, QMT_TYPE(quaternion) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.x, right.x) &&
+		QMT_HELPER(equal)(left.y, right.y) &&
+		QMT_HELPER(equal)(left.z, right.z) &&
+		QMT_HELPER(equal)(left.w, right.w)
+	);
+}
+
+// From axis and angle function
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, FromAxisAngle)(QMT_TYPE(vector3) axis, QMT_REAL angle)
+{
+	QMT_REAL alen = QMT_MATH(sqrt)(QMT_HELPER(sq)(axis.x) + QMT_HELPER(sq)(axis.y) + QMT_HELPER(sq)(axis.z)); // qmVector3Length(axis)
+	if (alen == 0.0f)
+	{
+		return QMT_FUNCTION(Quaternion, Identity)();
+	}
+
+	QMT_REAL s, c;
+	QMT_HELPER(sinecosine)(angle * 0.5f, &s, &c);
+	s /= alen;
+
+	QMT_TYPE(quaternion) result = { axis.x * s, axis.y * s, axis.z * s, c };
+	return result;
+}
+
+// From Euler angles function, rotating about x, then y, then z like
+// qmMatrix44RotateZ(angle.z) * qmMatrix44RotateY(angle.y) * qmMatrix44RotateX(angle.x)
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, FromEuler)(QMT_TYPE(vector3) angle)
+{
+	QMT_REAL sx, cx, sy, cy, sz, cz;
+	QMT_HELPER(sinecosine)(angle.x * 0.5f, &sx, &cx);
+	QMT_HELPER(sinecosine)(angle.y * 0.5f, &sy, &cy);
+	QMT_HELPER(sinecosine)(angle.z * 0.5f, &sz, &cz);
+
+	QMT_TYPE(quaternion) result = {
+		sx * cy * cz - cx * sy * sz,
+		cx * sy * cz + sx * cy * sz,
+		cx * cy * sz - sx * sy * cz,
+		cx * cy * cz + sx * sy * sz
+	};
+	return result;
+}
+
+// From rotation matrix function, reading the upper 3x3 of a matrix without scale
+QM_API QMT_TYPE(quaternion) QMT_FUNCTION(Quaternion, FromMatrix44)(QMT_TYPE(matrix44) mat)
+{
+	// Solve for the largest component first, so the division below stays well conditioned
+	QMT_TYPE(quaternion) result;
+	QMT_REAL trace = mat.m0 + mat.m5 + mat.m10;
+	if (trace > 0.0f)
+	{
+		QMT_REAL s = 0.5f / QMT_MATH(sqrt)(trace + 1.0f);
+		result.x = (mat.m6 - mat.m9) * s;
+		result.y = (mat.m8 - mat.m2) * s;
+		result.z = (mat.m1 - mat.m4) * s;
+		result.w = 0.25f / s;
+	}
+	else if (mat.m0 > mat.m5 && mat.m0 > mat.m10)
+	{
+		QMT_REAL s = 0.5f / QMT_MATH(sqrt)(1.0f + mat.m0 - mat.m5 - mat.m10);
+		result.x = 0.25f / s;
+		result.y = (mat.m4 + mat.m1) * s;
+		result.z = (mat.m8 + mat.m2) * s;
+		result.w = (mat.m6 - mat.m9) * s;
+	}
+	else if (mat.m5 > mat.m10)
+	{
+		QMT_REAL s = 0.5f / QMT_MATH(sqrt)(1.0f + mat.m5 - mat.m0 - mat.m10);
+		result.x = (mat.m4 + mat.m1) * s;
+		result.y = 0.25f / s;
+		result.z = (mat.m9 + mat.m6) * s;
+		result.w = (mat.m8 - mat.m2) * s;
+	}
+	else
+	{
+		QMT_REAL s = 0.5f / QMT_MATH(sqrt)(1.0f + mat.m10 - mat.m0 - mat.m5);
+		result.x = (mat.m8 + mat.m2) * s;
+		result.y = (mat.m9 + mat.m6) * s;
+		result.z = 0.25f / s;
+		result.w = (mat.m1 - mat.m4) * s;
+	}
+	return result;
+}
+
+// To rotation matrix function
+QM_API QMT_TYPE(matrix44) QMT_FUNCTION(Quaternion, ToMatrix44)(QMT_TYPE(quaternion) quat)
+{
+	QMT_REAL x2 = quat.x + quat.x, y2 = quat.y + quat.y, z2 = quat.z + quat.z;
+	QMT_REAL xx = quat.x * x2, yy = quat.y * y2, zz = quat.z * z2;
+	QMT_REAL xy = quat.x * y2, xz = quat.x * z2, yz = quat.y * z2;
+	QMT_REAL wx = quat.w * x2, wy = quat.w * y2, wz = quat.w * z2;
+
+	QMT_TYPE(matrix44) result = {
+		1.0f - yy - zz, xy - wz, xz + wy, 0.0f,
+		xy + wz, 1.0f - xx - zz, yz - wx, 0.0f,
+		xz - wy, yz + wx, 1.0f - xx - yy, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f
+	};
+	return result;
+}
+
+// Rotate Vector3 function, for unit quaternions, as v + 2w(q x v) + 2q x (q x v)
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Quaternion, RotateVector3)(QMT_TYPE(quaternion) quat, QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(vector3) t = { // qmVector3Scale(qmVector3CrossProduct(quat, vec), 2)
+		2.0f * (quat.y * vec.z - quat.z * vec.y),
+		2.0f * (quat.z * vec.x - quat.x * vec.z),
+		2.0f * (quat.x * vec.y - quat.y * vec.x)
+	};
+
+	QMT_TYPE(vector3) result = {
+		vec.x + quat.w * t.x + quat.y * t.z - quat.z * t.y,
+		vec.y + quat.w * t.y + quat.z * t.x - quat.x * t.z,
+		vec.z + quat.w * t.z + quat.x * t.y - quat.y * t.x
+	};
+	return result;
+}
+
+//// Dual quaternion functions ////
+
+// Identity function
+QM_API QMT_TYPE(dualquat) QMT_FUNCTION(DualQuat, Identity)(q_void)
+{
+	QMT_TYPE(dualquat) result = {
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+		{ 0.0f, 0.0f, 0.0f, 0.0f }
+	};
+	return result;
+}
+
+// Rotation then translation function, from a unit rotation
+QM_API QMT_TYPE(dualquat) QMT_FUNCTION(DualQuat, FromRotationTranslation)(QMT_TYPE(quaternion) rotation, QMT_TYPE(vector3) translation)
+{
+	QMT_TYPE(quaternion) t = { translation.x * 0.5f, translation.y * 0.5f, translation.z * 0.5f, 0.0f };
+
+	QMT_TYPE(dualquat) result = { rotation, QMT_HELPER(quatmul)(t, rotation) };
+	return result;
+}
+
+// Translation function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(DualQuat, Translation)(QMT_TYPE(dualquat) dq)
+{
+	// Vector part of 2 * dual * conjugate(real)
+	QMT_TYPE(quaternion) r = dq.real;
+	QMT_TYPE(quaternion) d = dq.dual;
+
+	QMT_TYPE(vector3) result = {
+		2.0f * (r.w * d.x - d.w * r.x + r.y * d.z - r.z * d.y),
+		2.0f * (r.w * d.y - d.w * r.y + r.z * d.x - r.x * d.z),
+		2.0f * (r.w * d.z - d.w * r.z + r.x * d.y - r.y * d.x)
+	};
+	return result;
+}
+
+// Multiply function, applying right before left
+QM_API QMT_TYPE(dualquat) QMT_FUNCTION(DualQuat, Multiply)(QMT_TYPE(dualquat) left, QMT_TYPE(dualquat) right)
+{
+	QMT_TYPE(quaternion) a = QMT_HELPER(quatmul)(left.real, right.dual);
+	QMT_TYPE(quaternion) b = QMT_HELPER(quatmul)(left.dual, right.real);
+
+	QMT_TYPE(dualquat) result = {
+		QMT_HELPER(quatmul)(left.real, right.real),
+		{ a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }
+	};
+	return result;
+}
+
+// Conjugate function, the inverse of a unit dual quaternion
+QM_API QMT_TYPE(dualquat) QMT_FUNCTION(DualQuat, Conjugate)(QMT_TYPE(dualquat) dq)
+{
+	QMT_TYPE(dualquat) result = {
+		{ -dq.real.x, -dq.real.y, -dq.real.z, dq.real.w },
+		{ -dq.dual.x, -dq.dual.y, -dq.dual.z, dq.dual.w }
+	};
+	return result;
+}
+
+// Normalize function, which also makes the dual part orthogonal to the real part
+QM_API QMT_TYPE(dualquat) QMT_FUNCTION(DualQuat, Normalize)(QMT_TYPE(dualquat) dq)
+{
+	QMT_TYPE(quaternion) r = dq.real;
+	QMT_TYPE(quaternion) d = dq.dual;
+	QMT_REAL squared = QMT_HELPER(sq)(r.x) + QMT_HELPER(sq)(r.y) + QMT_HELPER(sq)(r.z) + QMT_HELPER(sq)(r.w);
+	if (squared == 0.0f)
+	{
+		return dq;
+	}
+
+	QMT_REAL inv = QMT_HELPER(invsqrt)(squared);
+	QMT_REAL dot = (r.x * d.x + r.y * d.y + r.z * d.z + r.w * d.w) * inv * inv;
+
+	QMT_TYPE(dualquat) result = {
+		{ r.x * inv, r.y * inv, r.z * inv, r.w * inv },
+		{ (d.x - r.x * dot) * inv, (d.y - r.y * dot) * inv, (d.z - r.z * dot) * inv, (d.w - r.w * dot) * inv }
+	};
+	return result;
+}
+
+// Transform point function, for a unit dual quaternion
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(DualQuat, TransformPoint)(QMT_TYPE(dualquat) dq, QMT_TYPE(vector3) vec)
+{
+	QMT_TYPE(quaternion) r = dq.real;
+	QMT_TYPE(quaternion) d = dq.dual;
+
+	// Rotation as vec + 2 * cross(r, cross(r, vec) + w * vec)
+	QMT_TYPE(vector3) c = {
+		r.y * vec.z - r.z * vec.y + r.w * vec.x,
+		r.z * vec.x - r.x * vec.z + r.w * vec.y,
+		r.x * vec.y - r.y * vec.x + r.w * vec.z
+	};
+
+	QMT_TYPE(vector3) result = { // qmDualQuatTranslation(dq) added
+		vec.x + 2.0f * (r.y * c.z - r.z * c.y + r.w * d.x - d.w * r.x + r.y * d.z - r.z * d.y),
+		vec.y + 2.0f * (r.z * c.x - r.x * c.z + r.w * d.y - d.w * r.y + r.z * d.x - r.x * d.z),
+		vec.z + 2.0f * (r.x * c.y - r.y * c.x + r.w * d.z - d.w * r.z + r.x * d.y - r.y * d.x)
+	};
+	return result;
+}
+
+// Screw linear interpolation function, for unit dual quaternions
+QM_API QMT_TYPE(dualquat) QMT_FUNCTION(DualQuat, ScLerp)(QMT_REAL value, QMT_TYPE(dualquat) start, QMT_TYPE(dualquat) end)
+{
+	// Shortest path, as q and -q are the same transform
+	if (start.real.x * end.real.x + start.real.y * end.real.y + start.real.z * end.real.z + start.real.w * end.real.w < 0.0f)
+	{
+		end.real.x = -end.real.x;
+		end.real.y = -end.real.y;
+		end.real.z = -end.real.z;
+		end.real.w = -end.real.w;
+		end.dual.x = -end.dual.x;
+		end.dual.y = -end.dual.y;
+		end.dual.z = -end.dual.z;
+		end.dual.w = -end.dual.w;
+	}
+
+	// Relative transform from start to end
+	QMT_TYPE(quaternion) sr = { -start.real.x, -start.real.y, -start.real.z, start.real.w };
+	QMT_TYPE(quaternion) sd = { -start.dual.x, -start.dual.y, -start.dual.z, start.dual.w };
+	QMT_TYPE(quaternion) r = QMT_HELPER(quatmul)(sr, end.real);
+	QMT_TYPE(quaternion) a = QMT_HELPER(quatmul)(sr, end.dual);
+	QMT_TYPE(quaternion) b = QMT_HELPER(quatmul)(sd, end.real);
+	QMT_TYPE(quaternion) d = { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w };
+
+	// Raise it to value through its screw parameters: angle, pitch, axis and moment
+	QMT_TYPE(dualquat) power;
+	QMT_REAL s = QMT_MATH(sqrt)(QMT_HELPER(sq)(r.x) + QMT_HELPER(sq)(r.y) + QMT_HELPER(sq)(r.z));
+	if (s < QMT_EPSILON)
+	{
+		// Pure translation interpolates linearly
+		QMT_TYPE(dualquat) translation = {
+			{ 0.0f, 0.0f, 0.0f, 1.0f },
+			{ d.x * value, d.y * value, d.z * value, 0.0f }
+		};
+		power = translation;
+	}
+	else
+	{
+		QMT_REAL half = QMT_MATH(atan2)(s, r.w);
+		QMT_REAL pitch = -2.0f * d.w / s;
+		QMT_TYPE(vector3) axis = { r.x / s, r.y / s, r.z / s };
+		QMT_TYPE(vector3) moment = {
+			(d.x - axis.x * pitch * 0.5f * r.w) / s,
+			(d.y - axis.y * pitch * 0.5f * r.w) / s,
+			(d.z - axis.z * pitch * 0.5f * r.w) / s
+		};
+
+		QMT_REAL sine, cosine;
+		QMT_HELPER(sinecosine)(half * value, &sine, &cosine);
+		pitch *= value;
+
+		QMT_TYPE(dualquat) screw = {
+			{ axis.x * sine, axis.y * sine, axis.z * sine, cosine },
+			{
+				moment.x * sine + axis.x * pitch * 0.5f * cosine,
+				moment.y * sine + axis.y * pitch * 0.5f * cosine,
+				moment.z * sine + axis.z * pitch * 0.5f * cosine,
+				-pitch * 0.5f * sine
+			}
+		};
+		power = screw;
+	}
+
+	a = QMT_HELPER(quatmul)(start.real, power.dual);
+	b = QMT_HELPER(quatmul)(start.dual, power.real);
+	QMT_TYPE(dualquat) result = { // qmDualQuatMultiply(start, power)
+		QMT_HELPER(quatmul)(start.real, power.real),
+		{ a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }
+	};
+	return result;
+}
+
+// Equal function
+QM_API q_bool QMT_FUNCTION(DualQuat, Equal)(QMT_TYPE(dualquat) left, QMT_TYPE(dualquat) right)
+{
+	return Q_BOOL(
+		QMT_HELPER(equal)(left.real.x, right.real.x) &&
+		QMT_HELPER(equal)(left.real.y, right.real.y) &&
+		QMT_HELPER(equal)(left.real.z, right.real.z) &&
+		QMT_HELPER(equal)(left.real.w, right.real.w) &&
+		QMT_HELPER(equal)(left.dual.x, right.dual.x) &&
+		QMT_HELPER(equal)(left.dual.y, right.dual.y) &&
+		QMT_HELPER(equal)(left.dual.z, right.dual.z) &&
+		QMT_HELPER(equal)(left.dual.w, right.dual.w)
+	);
+}
+
+//// Plane functions ////
+
+// Plane through point with normal function
+QM_API QMT_TYPE(plane) QMT_FUNCTION(Plane, FromPointNormal)(QMT_TYPE(vector3) point, QMT_TYPE(vector3) normal)
+{
+	QMT_TYPE(plane) result = {
+		normal.x,
+		normal.y,
+		normal.z,
+		-(normal.x * point.x + normal.y * point.y + normal.z * point.z)
+	};
+	return result;
+}
+
+// Normalize function, scaling the plane so its normal is unit length
+QM_API QMT_TYPE(plane) QMT_FUNCTION(Plane, Normalize)(QMT_TYPE(plane) plane)
+{
+	QMT_REAL length = QMT_MATH(sqrt)(QMT_HELPER(sq)(plane.x) + QMT_HELPER(sq)(plane.y) + QMT_HELPER(sq)(plane.z));
+	if (length == 0.0f)
+	{
+		return plane;
+	}
+
+	QMT_TYPE(plane) result = {
+		plane.x / length,
+		plane.y / length,
+		plane.z / length,
+		plane.w / length
+	};
+	return result;
+}
+
+// Signed distance function, scaled by the normal length unless the plane is normalized
+QM_API QMT_REAL QMT_FUNCTION(Plane, Distance)(QMT_TYPE(plane) plane, QMT_TYPE(vector3) point)
+{
+	return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+}
+
+//// Frustum functions ////
+
+// Frustum of a projection or combined view-projection matrix, with normalized planes
+QM_API QMT_TYPE(frustum) QMT_FUNCTION(Frustum, FromMatrix44)(QMT_TYPE(matrix44) mat)
+{
+	// Clip space is bounded by -w <= x, y, z <= w, as the projection functions produce
+	QMT_TYPE(vector4) row0 = { mat.m0, mat.m4, mat.m8, mat.m12 };
+	QMT_TYPE(vector4) row1 = { mat.m1, mat.m5, mat.m9, mat.m13 };
+	QMT_TYPE(vector4) row2 = { mat.m2, mat.m6, mat.m10, mat.m14 };
+	QMT_TYPE(vector4) row3 = { mat.m3, mat.m7, mat.m11, mat.m15 };
+
+	QMT_TYPE(frustum) result = { {
+		QMT_FUNCTION(Plane, Normalize)(QMT_FUNCTION(Vector4, Add)(row3, row0)),
+		QMT_FUNCTION(Plane, Normalize)(QMT_FUNCTION(Vector4, Subtract)(row3, row0)),
+		QMT_FUNCTION(Plane, Normalize)(QMT_FUNCTION(Vector4, Add)(row3, row1)),
+		QMT_FUNCTION(Plane, Normalize)(QMT_FUNCTION(Vector4, Subtract)(row3, row1)),
+		QMT_FUNCTION(Plane, Normalize)(QMT_FUNCTION(Vector4, Add)(row3, row2)),
+		QMT_FUNCTION(Plane, Normalize)(QMT_FUNCTION(Vector4, Subtract)(row3, row2))
+	} };
+	return result;
+}
+
+// Sphere intersection function, conservative near the edges and corners of the frustum
+QM_API q_bool QMT_FUNCTION(Frustum, IntersectsSphere)(QMT_TYPE(frustum) frustum, QMT_TYPE(vector3) center, QMT_REAL radius)
+{
+	for (q_uint i = 0; i < 6; i++)
+	{
+		if (QMT_FUNCTION(Plane, Distance)(frustum.plane[i], center) < -radius)
+		{
+			return q_false;
+		}
+	}
+	return q_true;
+}
+
+// Axis-aligned box intersection function, from its center and half extent, conservative as above
+QM_API q_bool QMT_FUNCTION(Frustum, IntersectsAabb)(QMT_TYPE(frustum) frustum, QMT_TYPE(vector3) center, QMT_TYPE(vector3) extent)
+{
+	for (q_uint i = 0; i < 6; i++)
+	{
+		QMT_TYPE(plane) p = frustum.plane[i];
+		QMT_REAL radius = QMT_MATH(fabs)(p.x) * extent.x + QMT_MATH(fabs)(p.y) * extent.y + QMT_MATH(fabs)(p.z) * extent.z;
+		if (QMT_FUNCTION(Plane, Distance)(p, center) < -radius)
+		{
+			return q_false;
+		}
+	}
+	return q_true;
+}
+
+//// Axis-aligned box functions ////
+
+// Empty function, which qmAabbMerge and qmAabbExpand treat as no box
+QM_API QMT_TYPE(aabb) QMT_FUNCTION(Aabb, Empty)(q_void)
+{
+	QMT_TYPE(aabb) result = {
+		{ INFINITY, INFINITY, INFINITY },
+		{ -INFINITY, -INFINITY, -INFINITY }
+	};
+	return result;
+}
+
+// From points function, empty when count is zero
+QM_API QMT_TYPE(aabb) QMT_FUNCTION(Aabb, FromPoints)(const QMT_TYPE(vector3) *points, q_uint count)
+{
+	QMT_TYPE(aabb) result = QMT_FUNCTION(Aabb, Empty)();
+	for (q_uint i = 0; i < count; i++)
+	{
+		result.min = QMT_FUNCTION(Vector3, Min)(result.min, points[i]);
+		result.max = QMT_FUNCTION(Vector3, Max)(result.max, points[i]);
+	}
+	return result;
+}
+
+// From center and half extent function
+QM_API QMT_TYPE(aabb) QMT_FUNCTION(Aabb, FromCenterExtent)(QMT_TYPE(vector3) center, QMT_TYPE(vector3) extent)
+{
+	QMT_TYPE(aabb) result = {
+		{ center.x - extent.x, center.y - extent.y, center.z - extent.z },
+		{ center.x + extent.x, center.y + extent.y, center.z + extent.z }
+	};
+	return result;
+}
+
+// Center function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Aabb, Center)(QMT_TYPE(aabb) aabb)
+{
+	QMT_TYPE(vector3) result = {
+		(aabb.min.x + aabb.max.x) * 0.5f,
+		(aabb.min.y + aabb.max.y) * 0.5f,
+		(aabb.min.z + aabb.max.z) * 0.5f
+	};
+	return result;
+}
+
+// Half extent function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Aabb, Extent)(QMT_TYPE(aabb) aabb)
+{
+	QMT_TYPE(vector3) result = {
+		(aabb.max.x - aabb.min.x) * 0.5f,
+		(aabb.max.y - aabb.min.y) * 0.5f,
+		(aabb.max.z - aabb.min.z) * 0.5f
+	};
+	return result;
+}
+
+// Surface area function, the cost measure of bounding volume hierarchies
+QM_API QMT_REAL QMT_FUNCTION(Aabb, SurfaceArea)(QMT_TYPE(aabb) aabb)
+{
+	QMT_REAL x = aabb.max.x - aabb.min.x;
+	QMT_REAL y = aabb.max.y - aabb.min.y;
+	QMT_REAL z = aabb.max.z - aabb.min.z;
+	return (x * y + y * z + z * x) * 2.0f;
+}
+
+// Merge function
+QM_API QMT_TYPE(aabb) QMT_FUNCTION(Aabb, Merge)(QMT_TYPE(aabb) left, QMT_TYPE(aabb) right)
+{
+	QMT_TYPE(aabb) result = {
+		QMT_FUNCTION(Vector3, Min)(left.min, right.min),
+		QMT_FUNCTION(Vector3, Max)(left.max, right.max)
+	};
+	return result;
+}
+
+// Expand to point function
+QM_API QMT_TYPE(aabb) QMT_FUNCTION(Aabb, Expand)(QMT_TYPE(aabb) aabb, QMT_TYPE(vector3) point)
+{
+	QMT_TYPE(aabb) result = {
+		QMT_FUNCTION(Vector3, Min)(aabb.min, point),
+		QMT_FUNCTION(Vector3, Max)(aabb.max, point)
+	};
+	return result;
+}
+
+// Transform function, enclosing the box after an affine transform
+QM_API QMT_TYPE(aabb) QMT_FUNCTION(Aabb, Transform)(QMT_TYPE(aabb) aabb, QMT_TYPE(matrix44) mat)
+{
+	if (aabb.min.x > aabb.max.x || aabb.min.y > aabb.max.y || aabb.min.z > aabb.max.z)
+	{
+		return aabb;
+	}
+
+	// Transformed center, and the half extent projected onto each axis by the absolute matrix
+	QMT_TYPE(vector3) c = QMT_FUNCTION(Aabb, Center)(aabb);
+	QMT_TYPE(vector3) e = QMT_FUNCTION(Aabb, Extent)(aabb);
+	QMT_TYPE(vector3) center = {
+		mat.m0 * c.x + mat.m4 * c.y + mat.m8 * c.z + mat.m12,
+		mat.m1 * c.x + mat.m5 * c.y + mat.m9 * c.z + mat.m13,
+		mat.m2 * c.x + mat.m6 * c.y + mat.m10 * c.z + mat.m14
+	};
+	QMT_TYPE(vector3) extent = {
+		QMT_MATH(fabs)(mat.m0) * e.x + QMT_MATH(fabs)(mat.m4) * e.y + QMT_MATH(fabs)(mat.m8) * e.z,
+		QMT_MATH(fabs)(mat.m1) * e.x + QMT_MATH(fabs)(mat.m5) * e.y + QMT_MATH(fabs)(mat.m9) * e.z,
+		QMT_MATH(fabs)(mat.m2) * e.x + QMT_MATH(fabs)(mat.m6) * e.y + QMT_MATH(fabs)(mat.m10) * e.z
+	};
+	return QMT_FUNCTION(Aabb, FromCenterExtent)(center, extent);
+}
+
+// Contains point function
+QM_API q_bool QMT_FUNCTION(Aabb, ContainsPoint)(QMT_TYPE(aabb) aabb, QMT_TYPE(vector3) point)
+{
+	return Q_BOOL(
+		point.x >= aabb.min.x && point.x <= aabb.max.x &&
+		point.y >= aabb.min.y && point.y <= aabb.max.y &&
+		point.z >= aabb.min.z && point.z <= aabb.max.z
+	);
+}
+
+// Box intersection function, where touching boxes intersect
+QM_API q_bool QMT_FUNCTION(Aabb, IntersectsAabb)(QMT_TYPE(aabb) left, QMT_TYPE(aabb) right)
+{
+	return Q_BOOL(
+		left.min.x <= right.max.x && right.min.x <= left.max.x &&
+		left.min.y <= right.max.y && right.min.y <= left.max.y &&
+		left.min.z <= right.max.z && right.min.z <= left.max.z
+	);
+}
+
+// Closest point function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Aabb, ClosestPoint)(QMT_TYPE(aabb) aabb, QMT_TYPE(vector3) point)
+{
+	return QMT_FUNCTION(Vector3, Clamp)(point, aabb.min, aabb.max);
+}
+
+//// Sphere functions ////
+
+// From points function, using Ritter's method which encloses the points without being minimal.
+// A zero count gives a zero radius at the origin.
+QM_API QMT_TYPE(sphere) QMT_FUNCTION(Sphere, FromPoints)(const QMT_TYPE(vector3) *points, q_uint count)
+{
+	QMT_TYPE(sphere) result = { { 0.0f, 0.0f, 0.0f }, 0.0f };
+	if (count == 0)
+	{
+		return result;
+	}
+
+	// Start from the two points furthest apart along the furthest direction from the first
+	QMT_TYPE(vector3) x = points[0];
+	QMT_TYPE(vector3) y = points[0];
+	QMT_REAL furthest = 0.0f;
+	for (q_uint i = 0; i < count; i++)
+	{
+		QMT_REAL d = QMT_FUNCTION(Vector3, DistanceSq)(points[0], points[i]);
+		if (d > furthest)
+		{
+			furthest = d;
+			x = points[i];
+		}
+	}
+	furthest = 0.0f;
+	for (q_uint i = 0; i < count; i++)
+	{
+		QMT_REAL d = QMT_FUNCTION(Vector3, DistanceSq)(x, points[i]);
+		if (d > furthest)
+		{
+			furthest = d;
+			y = points[i];
+		}
+	}
+
+	result.center = QMT_FUNCTION(Vector3, Lerp)(0.5f, x, y);
+	result.radius = QMT_MATH(sqrt)(furthest) * 0.5f;
+
+	// Grow toward each point still outside, keeping the far side of the sphere in place
+	for (q_uint i = 0; i < count; i++)
+	{
+		QMT_REAL d = QMT_FUNCTION(Vector3, Distance)(result.center, points[i]);
+		if (d > result.radius)
+		{
+			QMT_REAL radius = (result.radius + d) * 0.5f;
+			result.center = QMT_FUNCTION(Vector3, Lerp)((radius - result.radius) / d, result.center, points[i]);
+			result.radius = radius;
+		}
+	}
+
+	// Growing rounds the radius down as often as up, so take it again from the final center,
+	// padded past the rounding of the square root and of containment tests
+	furthest = 0.0f;
+	for (q_uint i = 0; i < count; i++)
+	{
+		QMT_REAL d = QMT_FUNCTION(Vector3, DistanceSq)(result.center, points[i]);
+		furthest = d > furthest ? d : furthest;
+	}
+	result.radius = QMT_MATH(sqrt)(furthest) * (1.0f + 4.0f * QMT_EPSILON);
+	return result;
+}
+
+// Transform function, scaling the radius by the largest axis scale of an affine transform
+QM_API QMT_TYPE(sphere) QMT_FUNCTION(Sphere, Transform)(QMT_TYPE(sphere) sphere, QMT_TYPE(matrix44) mat)
+{
+	QMT_TYPE(vector3) c = sphere.center;
+	QMT_REAL sx = QMT_HELPER(sq)(mat.m0) + QMT_HELPER(sq)(mat.m1) + QMT_HELPER(sq)(mat.m2);
+	QMT_REAL sy = QMT_HELPER(sq)(mat.m4) + QMT_HELPER(sq)(mat.m5) + QMT_HELPER(sq)(mat.m6);
+	QMT_REAL sz = QMT_HELPER(sq)(mat.m8) + QMT_HELPER(sq)(mat.m9) + QMT_HELPER(sq)(mat.m10);
+
+	QMT_TYPE(sphere) result = {
+		{
+			mat.m0 * c.x + mat.m4 * c.y + mat.m8 * c.z + mat.m12,
+			mat.m1 * c.x + mat.m5 * c.y + mat.m9 * c.z + mat.m13,
+			mat.m2 * c.x + mat.m6 * c.y + mat.m10 * c.z + mat.m14
+		},
+		sphere.radius * QMT_MATH(sqrt)(QMT_MATH(fmax)(QMT_MATH(fmax)(sx, sy), sz))
+	};
+	return result;
+}
+
+// Merge function
+QM_API QMT_TYPE(sphere) QMT_FUNCTION(Sphere, Merge)(QMT_TYPE(sphere) left, QMT_TYPE(sphere) right)
+{
+	QMT_REAL d = QMT_FUNCTION(Vector3, Distance)(left.center, right.center);
+	if (d + right.radius <= left.radius)
+	{
+		return left;
+	}
+	if (d + left.radius <= right.radius)
+	{
+		return right;
+	}
+
+	// Neither contains the other, so the centers differ
+	QMT_REAL radius = (d + left.radius + right.radius) * 0.5f;
+	QMT_TYPE(sphere) result = {
+		QMT_FUNCTION(Vector3, Lerp)((radius - left.radius) / d, left.center, right.center),
+		radius
+	};
+	return result;
+}
+
+// Contains point function
+QM_API q_bool QMT_FUNCTION(Sphere, ContainsPoint)(QMT_TYPE(sphere) sphere, QMT_TYPE(vector3) point)
+{
+	return Q_BOOL(QMT_FUNCTION(Vector3, DistanceSq)(sphere.center, point) <= QMT_HELPER(sq)(sphere.radius));
+}
+
+// Sphere intersection function
+QM_API q_bool QMT_FUNCTION(Sphere, IntersectsSphere)(QMT_TYPE(sphere) left, QMT_TYPE(sphere) right)
+{
+	return Q_BOOL(QMT_FUNCTION(Vector3, DistanceSq)(left.center, right.center) <= QMT_HELPER(sq)(left.radius + right.radius));
+}
+
+// Axis-aligned box intersection function
+QM_API q_bool QMT_FUNCTION(Sphere, IntersectsAabb)(QMT_TYPE(sphere) sphere, QMT_TYPE(aabb) aabb)
+{
+	QMT_TYPE(vector3) closest = QMT_FUNCTION(Aabb, ClosestPoint)(aabb, sphere.center);
+	return Q_BOOL(QMT_FUNCTION(Vector3, DistanceSq)(sphere.center, closest) <= QMT_HELPER(sq)(sphere.radius));
+}
+
+//// Oriented box functions ////
+
+// Transform function, for affine transforms without shear
+QM_API QMT_TYPE(obb) QMT_FUNCTION(Obb, Transform)(QMT_TYPE(obb) obb, QMT_TYPE(matrix44) mat)
+{
+	QMT_TYPE(vector3) c = obb.center;
+	QMT_TYPE(obb) result = {
+		{
+			mat.m0 * c.x + mat.m4 * c.y + mat.m8 * c.z + mat.m12,
+			mat.m1 * c.x + mat.m5 * c.y + mat.m9 * c.z + mat.m13,
+			mat.m2 * c.x + mat.m6 * c.y + mat.m10 * c.z + mat.m14
+		},
+		{ obb.axis[0], obb.axis[1], obb.axis[2] },
+		{ 0.0f, 0.0f, 0.0f }
+	};
+
+	// Scale moves from the transformed axes into the extent
+	QMT_REAL extent[3] = { obb.extent.x, obb.extent.y, obb.extent.z };
+	QMT_REAL length[3];
+	for (q_uint i = 0; i < 3; i++)
+	{
+		QMT_TYPE(vector3) a = obb.axis[i];
+		QMT_TYPE(vector3) v = {
+			mat.m0 * a.x + mat.m4 * a.y + mat.m8 * a.z,
+			mat.m1 * a.x + mat.m5 * a.y + mat.m9 * a.z,
+			mat.m2 * a.x + mat.m6 * a.y + mat.m10 * a.z
+		};
+		length[i] = QMT_FUNCTION(Vector3, Length)(v);
+		result.axis[i] = length[i] > 0.0f ? QMT_FUNCTION(Vector3, DivideScalar)(v, length[i]) : a;
+		extent[i] *= length[i];
+	}
+	result.extent.x = extent[0];
+	result.extent.y = extent[1];
+	result.extent.z = extent[2];
+	return result;
+}
+
+// From axis-aligned box function, as the box after an affine transform without shear
+QM_API QMT_TYPE(obb) QMT_FUNCTION(Obb, FromAabb)(QMT_TYPE(aabb) aabb, QMT_TYPE(matrix44) mat)
+{
+	QMT_TYPE(obb) obb = {
+		QMT_FUNCTION(Aabb, Center)(aabb),
+		{ { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+		QMT_FUNCTION(Aabb, Extent)(aabb)
+	};
+	return QMT_FUNCTION(Obb, Transform)(obb, mat);
+}
+
+// Contains point function
+QM_API q_bool QMT_FUNCTION(Obb, ContainsPoint)(QMT_TYPE(obb) obb, QMT_TYPE(vector3) point)
+{
+	QMT_TYPE(vector3) d = QMT_FUNCTION(Vector3, Subtract)(point, obb.center);
+	return Q_BOOL(
+		QMT_MATH(fabs)(QMT_FUNCTION(Vector3, DotProduct)(d, obb.axis[0])) <= obb.extent.x &&
+		QMT_MATH(fabs)(QMT_FUNCTION(Vector3, DotProduct)(d, obb.axis[1])) <= obb.extent.y &&
+		QMT_MATH(fabs)(QMT_FUNCTION(Vector3, DotProduct)(d, obb.axis[2])) <= obb.extent.z
+	);
+}
+
+// Oriented box intersection function, a separating axis test over the face normals of both
+// boxes and the cross products of their axes
+QM_API q_bool QMT_FUNCTION(Obb, IntersectsObb)(QMT_TYPE(obb) left, QMT_TYPE(obb) right)
+{
+	QMT_REAL le[3] = { left.extent.x, left.extent.y, left.extent.z };
+	QMT_REAL re[3] = { right.extent.x, right.extent.y, right.extent.z };
+
+	// Right axes and the center offset in the frame of left, with epsilon keeping the cross
+	// products of near-parallel axes from separating boxes that touch
+	QMT_REAL r[3][3], a[3][3], t[3];
+	QMT_TYPE(vector3) d = QMT_FUNCTION(Vector3, Subtract)(right.center, left.center);
+	for (q_uint i = 0; i < 3; i++)
+	{
+		for (q_uint j = 0; j < 3; j++)
+		{
+			r[i][j] = QMT_FUNCTION(Vector3, DotProduct)(left.axis[i], right.axis[j]);
+			a[i][j] = QMT_MATH(fabs)(r[i][j]) + QMT_EPSILON;
+		}
+		t[i] = QMT_FUNCTION(Vector3, DotProduct)(d, left.axis[i]);
+	}
+
+	for (q_uint i = 0; i < 3; i++)
+	{
+		if (QMT_MATH(fabs)(t[i]) > le[i] + re[0] * a[i][0] + re[1] * a[i][1] + re[2] * a[i][2])
+		{
+			return q_false;
+		}
+	}
+
+	for (q_uint j = 0; j < 3; j++)
+	{
+		QMT_REAL s = t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j];
+		if (QMT_MATH(fabs)(s) > le[0] * a[0][j] + le[1] * a[1][j] + le[2] * a[2][j] + re[j])
+		{
+			return q_false;
+		}
+	}
+
+	for (q_uint i = 0; i < 3; i++)
+	{
+		q_uint i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+		for (q_uint j = 0; j < 3; j++)
+		{
+			q_uint j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			QMT_REAL s = t[i2] * r[i1][j] - t[i1] * r[i2][j];
+			QMT_REAL radius = le[i1] * a[i2][j] + le[i2] * a[i1][j] + re[j1] * a[i][j2] + re[j2] * a[i][j1];
+			if (QMT_MATH(fabs)(s) > radius)
+			{
+				return q_false;
+			}
+		}
+	}
+	return q_true;
+}
+
+//// Ray functions ////
+
+// Point at distance function
+QM_API QMT_TYPE(vector3) QMT_FUNCTION(Ray, At)(QMT_TYPE(ray) ray, QMT_REAL t)
+{
+	QMT_TYPE(vector3) result = {
+		ray.origin.x + ray.direction.x * t,
+		ray.origin.y + ray.direction.y * t,
+		ray.origin.z + ray.direction.z * t
+	};
+	return result;
+}
+
+// Axis-aligned box intersection function, the slab test. When it hits and distance is set, it
+// receives the entry distance in units of the direction, zero from inside. A ray parallel to a
+// face that starts in the plane of that face may miss.
+QM_API q_bool QMT_FUNCTION(Ray, IntersectsAabb)(QMT_TYPE(ray) ray, QMT_TYPE(aabb) aabb, QMT_REAL *distance)
+{
+	QMT_REAL o[3] = { ray.origin.x, ray.origin.y, ray.origin.z };
+	QMT_REAL v[3] = { ray.direction.x, ray.direction.y, ray.direction.z };
+	QMT_REAL lo[3] = { aabb.min.x, aabb.min.y, aabb.min.z };
+	QMT_REAL hi[3] = { aabb.max.x, aabb.max.y, aabb.max.z };
+
+	// Zero direction components divide to infinities, which put the slab everywhere or nowhere
+	QMT_REAL near = 0.0f, far = INFINITY;
+	for (q_uint k = 0; k < 3; k++)
+	{
+		QMT_REAL inv = 1.0f / v[k];
+		QMT_REAL t0 = (lo[k] - o[k]) * inv;
+		QMT_REAL t1 = (hi[k] - o[k]) * inv;
+		QMT_REAL enter = t0 < t1 ? t0 : t1;
+		QMT_REAL exit = t0 < t1 ? t1 : t0;
+		near = enter > near ? enter : near;
+		far = exit < far ? exit : far;
+	}
+
+	if (near > far)
+	{
+		return q_false;
+	}
+	if (distance != q_null)
+	{
+		*distance = near;
+	}
+	return q_true;
+}
+
+// Sphere intersection function, setting distance as above
+QM_API q_bool QMT_FUNCTION(Ray, IntersectsSphere)(QMT_TYPE(ray) ray, QMT_TYPE(sphere) sphere, QMT_REAL *distance)
+{
+	QMT_TYPE(vector3) m = QMT_FUNCTION(Vector3, Subtract)(ray.origin, sphere.center);
+	QMT_REAL a = QMT_FUNCTION(Vector3, LengthSq)(ray.direction);
+	QMT_REAL b = QMT_FUNCTION(Vector3, DotProduct)(m, ray.direction);
+	QMT_REAL c = QMT_FUNCTION(Vector3, LengthSq)(m) - QMT_HELPER(sq)(sphere.radius);
+
+	// Outside and pointing away, or passing the sphere by
+	QMT_REAL discriminant = b * b - a * c;
+	if ((c > 0.0f && b > 0.0f) || discriminant < 0.0f || a == 0.0f)
+	{
+		return q_false;
+	}
+	if (distance != q_null)
+	{
+		QMT_REAL t = (-b - QMT_MATH(sqrt)(discriminant)) / a;
+		*distance = t > 0.0f ? t : 0.0f;
+	}
+	return q_true;
+}
+
+// Plane intersection function, setting distance as above. Rays in the plane miss it.
+QM_API q_bool QMT_FUNCTION(Ray, IntersectsPlane)(QMT_TYPE(ray) ray, QMT_TYPE(plane) plane, QMT_REAL *distance)
+{
+	QMT_REAL d = plane.x * ray.direction.x + plane.y * ray.direction.y + plane.z * ray.direction.z;
+	if (d == 0.0f)
+	{
+		return q_false;
+	}
+
+	QMT_REAL t = -QMT_FUNCTION(Plane, Distance)(plane, ray.origin) / d;
+	if (t < 0.0f)
+	{
+		return q_false;
+	}
+	if (distance != q_null)
+	{
+		*distance = t;
+	}
+	return q_true;
+}
+
+//// Pointer functions ////
+
+// Pointer functions read their operands through const pointers and write through a result
+// pointer that must not overlap them, so large types are not copied across calls that are not
+// inlined. In place functions update their first operand, which the others may alias.
+
+// Add pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, AddPtr)(QMT_TYPE(matrix33) *QM_RESTRICT result, const QMT_TYPE(matrix33) *left, const QMT_TYPE(matrix33) *right)
+{
+	*result = QMT_FUNCTION(Matrix33, Add)(*left, *right);
+}
+
+// Subtract pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, SubtractPtr)(QMT_TYPE(matrix33) *QM_RESTRICT result, const QMT_TYPE(matrix33) *left, const QMT_TYPE(matrix33) *right)
+{
+	*result = QMT_FUNCTION(Matrix33, Subtract)(*left, *right);
+}
+
+// Multiply Vector3 pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, MultiplyVector3Ptr)(QMT_TYPE(vector3) *QM_RESTRICT result, const QMT_TYPE(matrix33) *mat, const QMT_TYPE(vector3) *vec)
+{
+	*result = QMT_FUNCTION(Matrix33, MultiplyVector3)(*mat, *vec);
+}
+
+// Multiply Matrix33 pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, MultiplyMatrix33Ptr)(QMT_TYPE(matrix33) *QM_RESTRICT result, const QMT_TYPE(matrix33) *left, const QMT_TYPE(matrix33) *right)
+{
+	*result = QMT_FUNCTION(Matrix33, MultiplyMatrix33)(*left, *right);
+}
+
+// Transpose pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, TransposePtr)(QMT_TYPE(matrix33) *QM_RESTRICT result, const QMT_TYPE(matrix33) *mat)
+{
+	*result = QMT_FUNCTION(Matrix33, Transpose)(*mat);
+}
+
+// Inverse pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, InversePtr)(QMT_TYPE(matrix33) *QM_RESTRICT result, const QMT_TYPE(matrix33) *mat)
+{
+	*result = QMT_FUNCTION(Matrix33, Inverse)(*mat);
+}
+
+// Add in place function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, AddInPlace)(QMT_TYPE(matrix33) *mat, const QMT_TYPE(matrix33) *right)
+{
+	*mat = QMT_FUNCTION(Matrix33, Add)(*mat, *right);
+}
+
+// Multiply Matrix33 in place function, as mat = mat * right
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, MultiplyMatrix33InPlace)(QMT_TYPE(matrix33) *mat, const QMT_TYPE(matrix33) *right)
+{
+	*mat = QMT_FUNCTION(Matrix33, MultiplyMatrix33)(*mat, *right);
+}
+
+// Transpose in place function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, TransposeInPlace)(QMT_TYPE(matrix33) *mat)
+{
+	*mat = QMT_FUNCTION(Matrix33, Transpose)(*mat);
+}
+
+// Inverse in place function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix33, InverseInPlace)(QMT_TYPE(matrix33) *mat)
+{
+	*mat = QMT_FUNCTION(Matrix33, Inverse)(*mat);
+}
+
+// Add pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, AddPtr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *left, const QMT_TYPE(matrix44) *right)
+{
+	*result = QMT_FUNCTION(Matrix44, Add)(*left, *right);
+}
+
+// Subtract pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, SubtractPtr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *left, const QMT_TYPE(matrix44) *right)
+{
+	*result = QMT_FUNCTION(Matrix44, Subtract)(*left, *right);
+}
+
+// Multiply Vector4 pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, MultiplyVector4Ptr)(QMT_TYPE(vector4) *QM_RESTRICT result, const QMT_TYPE(matrix44) *mat, const QMT_TYPE(vector4) *vec)
+{
+	*result = QMT_FUNCTION(Matrix44, MultiplyVector4)(*mat, *vec);
+}
+
+// Multiply Matrix44 pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, MultiplyMatrix44Ptr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *left, const QMT_TYPE(matrix44) *right)
+{
+	*result = QMT_FUNCTION(Matrix44, MultiplyMatrix44)(*left, *right);
+}
+
+// Transpose pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, TransposePtr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *mat)
+{
+	*result = QMT_FUNCTION(Matrix44, Transpose)(*mat);
+}
+
+// Inverse pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, InversePtr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *mat)
+{
+	*result = QMT_FUNCTION(Matrix44, Inverse)(*mat);
+}
+
+// Affine inverse pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, InverseAffinePtr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *mat)
+{
+	*result = QMT_FUNCTION(Matrix44, InverseAffine)(*mat);
+}
+
+// Rigid inverse pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, InverseRigidPtr)(QMT_TYPE(matrix44) *QM_RESTRICT result, const QMT_TYPE(matrix44) *mat)
+{
+	*result = QMT_FUNCTION(Matrix44, InverseRigid)(*mat);
+}
+
+// Add in place function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, AddInPlace)(QMT_TYPE(matrix44) *mat, const QMT_TYPE(matrix44) *right)
+{
+	*mat = QMT_FUNCTION(Matrix44, Add)(*mat, *right);
+}
+
+// Multiply Matrix44 in place function, as mat = mat * right
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, MultiplyMatrix44InPlace)(QMT_TYPE(matrix44) *mat, const QMT_TYPE(matrix44) *right)
+{
+	*mat = QMT_FUNCTION(Matrix44, MultiplyMatrix44)(*mat, *right);
+}
+
+// Transpose in place function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, TransposeInPlace)(QMT_TYPE(matrix44) *mat)
+{
+	*mat = QMT_FUNCTION(Matrix44, Transpose)(*mat);
+}
+
+// Inverse in place function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Matrix44, InverseInPlace)(QMT_TYPE(matrix44) *mat)
+{
+	*mat = QMT_FUNCTION(Matrix44, Inverse)(*mat);
+}
+
+// Quaternion multiply pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Quaternion, MultiplyPtr)(QMT_TYPE(quaternion) *QM_RESTRICT result, const QMT_TYPE(quaternion) *left, const QMT_TYPE(quaternion) *right)
+{
+	*result = QMT_FUNCTION(Quaternion, Multiply)(*left, *right);
+}
+
+// Quaternion multiply in place function, as quat = quat * right
+QM_API QM_FLATTEN q_void QMT_FUNCTION(Quaternion, MultiplyInPlace)(QMT_TYPE(quaternion) *quat, const QMT_TYPE(quaternion) *right)
+{
+	*quat = QMT_FUNCTION(Quaternion, Multiply)(*quat, *right);
+}
+
+// Dual quaternion multiply pointer function
+QM_API QM_FLATTEN q_void QMT_FUNCTION(DualQuat, MultiplyPtr)(QMT_TYPE(dualquat) *QM_RESTRICT result, const QMT_TYPE(dualquat) *left, const QMT_TYPE(dualquat) *right)
+{
+	*result = QMT_FUNCTION(DualQuat, Multiply)(*left, *right);
+}
+
+// Dual quaternion multiply in place function, as quat = quat * right
+QM_API QM_FLATTEN q_void QMT_FUNCTION(DualQuat, MultiplyInPlace)(QMT_TYPE(dualquat) *quat, const QMT_TYPE(dualquat) *right)
+{
+	*quat = QMT_FUNCTION(DualQuat, Multiply)(*quat, *right);
+}
+
+#undef QMT_REAL
+#undef QMT_TYPE
+#undef QMT_FUNCTION
+#undef QMT_SCALAR_FUNCTION
+#undef QMT_HELPER
+#undef QMT_MATH
+#undef QMT_EPSILON
+#undef QMT_SIMD
+#undef QMT_SIMD_TYPE
+#undef QMT_SIMD_OP
+#undef QMT_SWIZZLE
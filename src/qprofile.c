@@ -0,0 +1,477 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qprofile.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdatomic.h> // atomic_load_explicit, atomic_store_explicit, atomic_fetch_add_explicit
+#include <stdint.h> // uintptr_t
+#include <string.h> // strlen, memcmp
+#include "qprofile.h"
+#include "qutils.h"
+
+#if defined(_WIN32)
+	#include <windows.h> // QueryPerformanceCounter, QueryPerformanceFrequency
+#else
+	#include <time.h> // clock_gettime
+#endif /* defined(_WIN32) */
+
+// Time stamp counter is the cheapest clock where available
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h> // __rdtsc
+	#define Q_PROFILE_TSC
+#elif defined(_M_X64) || defined(_M_IX86)
+	#include <intrin.h> // __rdtsc
+	#define Q_PROFILE_TSC
+#endif /* defined(__x86_64__) || defined(__i386__) */
+
+// Name table of a binary trace, must be a power of two, holding up to half as many distinct names
+#define Q_PROFILE_NAME_CAPACITY 4096
+
+//// Internal types ////
+
+// Completed zone
+typedef struct q_profile_event
+{
+	q_str name;
+	q_ulong start;
+	q_ulong duration;
+} q_profile_event;
+
+// Open zone
+typedef struct q_profile_frame
+{
+	q_str name;
+	q_ulong start;
+} q_profile_frame;
+
+// Per-thread zones, written only by their thread and published through count
+typedef struct q_profile_buffer
+{
+	struct q_profile_buffer *next;
+	_Atomic q_ulong count;
+	_Atomic q_ulong dropped;
+	_Atomic q_str name;
+	q_uint thread;
+	q_uint depth;
+	q_profile_frame stack[Q_PROFILE_MAX_DEPTH];
+	q_profile_event events[Q_PROFILE_BUFFER_EVENTS];
+} q_profile_buffer;
+
+//// Global variables ////
+
+static q_profile_buffer *_Atomic qp_buffers = q_null;
+static _Atomic q_uint qp_threads = 0;
+static _Atomic q_bool qp_started = q_false;
+static _Atomic q_ulong qp_origin_ticks = 0;
+static _Atomic q_ulong qp_origin_time = 0;
+static _Atomic q_ulong qp_unnamed = 0;
+static _Thread_local q_profile_buffer *qp_local = q_null;
+
+//// Clock ////
+
+// Get monotonic time in nanoseconds
+static q_ulong qpTime(q_void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (q_ulong)((q_double)counter.QuadPart * 1e9 / (q_double)frequency.QuadPart);
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (q_ulong)now.tv_sec * 1000000000ull + (q_ulong)now.tv_nsec;
+#endif /* defined(_WIN32) */
+}
+
+// Get zone timestamp
+static inline q_ulong qpTicks(q_void)
+{
+#if defined(Q_PROFILE_TSC)
+	return __rdtsc();
+#else
+	return qpTime();
+#endif /* Q_PROFILE_TSC */
+}
+
+// Get ticks per nanosecond, measured against the monotonic clock since the first zone
+static q_double qpTickRate(q_void)
+{
+#if defined(Q_PROFILE_TSC)
+	q_ulong originTicks = atomic_load_explicit(&qp_origin_ticks, memory_order_acquire);
+	q_ulong originTime = atomic_load_explicit(&qp_origin_time, memory_order_acquire);
+
+	// A short interval would make the rate imprecise
+	q_ulong time = qpTime();
+	while (time - originTime < 10000000)
+	{
+		time = qpTime();
+	}
+	return (q_double)(qpTicks() - originTicks) / (q_double)(time - originTime);
+#else
+	return 1.0;
+#endif /* Q_PROFILE_TSC */
+}
+
+//// Buffers ////
+
+// Create buffer of calling thread, kept until process exit so its zones can be exported
+static q_profile_buffer *qpBuffer(q_void)
+{
+	q_profile_buffer *buffer = Q_CALLOC(1, sizeof(q_profile_buffer));
+	if (buffer == q_null)
+	{
+		return q_null;
+	}
+	buffer->thread = atomic_fetch_add_explicit(&qp_threads, 1, memory_order_relaxed) + 1;
+
+	q_bool started = q_false;
+	if (atomic_compare_exchange_strong_explicit(&qp_started, &started, q_true, memory_order_relaxed, memory_order_relaxed))
+	{
+		atomic_store_explicit(&qp_origin_time, qpTime(), memory_order_release);
+		atomic_store_explicit(&qp_origin_ticks, qpTicks(), memory_order_release);
+	}
+
+	buffer->next = atomic_load_explicit(&qp_buffers, memory_order_relaxed);
+	while (!atomic_compare_exchange_weak_explicit(&qp_buffers, &buffer->next, buffer, memory_order_release, memory_order_relaxed))
+	{
+	}
+
+	qp_local = buffer;
+	return buffer;
+}
+
+//// Zone recording ////
+
+// Open zone on calling thread
+Q_API q_void qpBegin(q_str name)
+{
+	q_profile_buffer *buffer = qp_local ? qp_local : qpBuffer();
+	if (buffer == q_null)
+	{
+		return;
+	}
+
+	if (buffer->depth < Q_PROFILE_MAX_DEPTH)
+	{
+		buffer->stack[buffer->depth].name = name;
+		buffer->stack[buffer->depth].start = qpTicks();
+	}
+	buffer->depth++;
+}
+
+// Close innermost zone on calling thread
+Q_API q_void qpEnd(q_void)
+{
+	q_ulong end = qpTicks();
+	q_profile_buffer *buffer = qp_local;
+	if (buffer == q_null || buffer->depth == 0)
+	{
+		return;
+	}
+
+	buffer->depth--;
+	if (buffer->depth >= Q_PROFILE_MAX_DEPTH)
+	{
+		return;
+	}
+
+	q_ulong count = atomic_load_explicit(&buffer->count, memory_order_relaxed);
+	if (count >= Q_PROFILE_BUFFER_EVENTS)
+	{
+		atomic_store_explicit(&buffer->dropped, atomic_load_explicit(&buffer->dropped, memory_order_relaxed) + 1, memory_order_relaxed);
+		return;
+	}
+
+	q_profile_frame *frame = &buffer->stack[buffer->depth];
+	q_profile_event *event = &buffer->events[count];
+	event->name = frame->name;
+	event->start = frame->start;
+	event->duration = end - frame->start;
+	atomic_store_explicit(&buffer->count, count + 1, memory_order_release);
+}
+
+// Close zone opened by Q_PROFILE_SCOPE
+Q_API q_void qpScopeEnd(q_int *scope)
+{
+	(q_void)scope;
+	qpEnd();
+}
+
+// Name calling thread in exported traces
+Q_API q_void qpThreadName(q_str name)
+{
+	q_profile_buffer *buffer = qp_local ? qp_local : qpBuffer();
+	if (buffer != q_null)
+	{
+		atomic_store_explicit(&buffer->name, name, memory_order_release);
+	}
+}
+
+//// Trace management ////
+
+// Get number of zones dropped because a thread buffer was full, or left out of the last binary
+// export because its name table was full
+Q_API q_ulong qpDropped(q_void)
+{
+	q_ulong result = atomic_load_explicit(&qp_unnamed, memory_order_relaxed);
+	for (q_profile_buffer *buffer = atomic_load_explicit(&qp_buffers, memory_order_acquire); buffer != q_null; buffer = buffer->next)
+	{
+		result += atomic_load_explicit(&buffer->dropped, memory_order_relaxed);
+	}
+	return result;
+}
+
+// Discard recorded zones, only while no thread is recording
+Q_API q_void qpReset(q_void)
+{
+	for (q_profile_buffer *buffer = atomic_load_explicit(&qp_buffers, memory_order_acquire); buffer != q_null; buffer = buffer->next)
+	{
+		atomic_store_explicit(&buffer->count, 0, memory_order_relaxed);
+		atomic_store_explicit(&buffer->dropped, 0, memory_order_relaxed);
+	}
+	atomic_store_explicit(&qp_unnamed, 0, memory_order_relaxed);
+}
+
+// Write string as JSON
+static q_void qpWriteString(FILE *output, q_str text)
+{
+	fputc('"', output);
+	for (; *text; text++)
+	{
+		if (*text == '"' || *text == '\\')
+		{
+			fputc('\\', output);
+			fputc(*text, output);
+		}
+		else if ((q_uchar)*text < 0x20)
+		{
+			fprintf(output, "\\u%04x", (q_uint)(q_uchar)*text);
+		}
+		else
+		{
+			fputc(*text, output);
+		}
+	}
+	fputc('"', output);
+}
+
+// Write thread name as Chrome trace metadata event
+static q_void qpWriteThread(FILE *output, q_bool *first, q_uint thread, q_str name)
+{
+	fprintf(output, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", *first ? "" : ",", thread);
+	qpWriteString(output, name);
+	fprintf(output, "}}");
+	*first = q_false;
+}
+
+// Write zone as Chrome trace complete event, with ticks relative to the origin
+static q_void qpWriteZone(FILE *output, q_bool *first, q_uint thread, q_str name, q_long start, q_ulong duration, q_double rate)
+{
+	fprintf(output, "%s\n{\"name\":", *first ? "" : ",");
+	qpWriteString(output, name);
+	fprintf(output, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", thread, (q_double)start / rate / 1000.0, (q_double)duration / rate / 1000.0);
+	*first = q_false;
+}
+
+// Export recorded zones as Chrome trace event JSON
+Q_API q_bool qpExportChrome(FILE *output)
+{
+	q_double rate = qpTickRate();
+	q_ulong origin = atomic_load_explicit(&qp_origin_ticks, memory_order_acquire);
+	q_bool first = q_true;
+
+	fprintf(output, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	for (q_profile_buffer *buffer = atomic_load_explicit(&qp_buffers, memory_order_acquire); buffer != q_null; buffer = buffer->next)
+	{
+		q_str name = atomic_load_explicit(&buffer->name, memory_order_acquire);
+		if (name != q_null)
+		{
+			qpWriteThread(output, &first, buffer->thread, name);
+		}
+
+		q_ulong count = atomic_load_explicit(&buffer->count, memory_order_acquire);
+		for (q_ulong i = 0; i < count; i++)
+		{
+			const q_profile_event *event = &buffer->events[i];
+			qpWriteZone(output, &first, buffer->thread, event->name, (q_long)(event->start - origin), event->duration, rate);
+		}
+	}
+	fprintf(output, "\n]}\n");
+	return !ferror(output);
+}
+
+// Export recorded zones in compact binary form, with each name written once. Zones with names
+// past the table are left out and counted by qpDropped until the next export or reset.
+Q_API q_bool qpExportBinary(FILE *output)
+{
+	q_str *names = Q_CALLOC(Q_PROFILE_NAME_CAPACITY, sizeof(q_str));
+	if (names == q_null)
+	{
+		return q_false;
+	}
+
+	q_double rate = qpTickRate();
+	q_ulong origin = atomic_load_explicit(&qp_origin_ticks, memory_order_acquire);
+	fwrite(Q_PROFILE_BINARY_MAGIC, 1, sizeof(Q_PROFILE_BINARY_MAGIC) - 1, output);
+	fwrite(&rate, sizeof(q_double), 1, output);
+
+	q_uint mask = Q_PROFILE_NAME_CAPACITY - 1;
+	q_uint used = 0;
+	q_ulong unnamed = 0;
+	for (q_profile_buffer *buffer = atomic_load_explicit(&qp_buffers, memory_order_acquire); buffer != q_null; buffer = buffer->next)
+	{
+		q_str threadName = atomic_load_explicit(&buffer->name, memory_order_acquire);
+		if (threadName != q_null)
+		{
+			q_uint length = (q_uint)strlen(threadName);
+			fputc('T', output);
+			fwrite(&buffer->thread, sizeof(q_uint), 1, output);
+			fwrite(&length, sizeof(q_uint), 1, output);
+			fwrite(threadName, 1, length, output);
+		}
+
+		q_ulong count = atomic_load_explicit(&buffer->count, memory_order_acquire);
+		for (q_ulong i = 0; i < count; i++)
+		{
+			const q_profile_event *event = &buffer->events[i];
+
+			// Identifiers are table positions, found by probing from the pointer hash
+			q_uint id = (q_uint)(((uintptr_t)event->name >> 3) * 2654435761u) & mask;
+			while (names[id] != q_null && names[id] != event->name)
+			{
+				id = (id + 1) & mask;
+			}
+			if (names[id] == q_null)
+			{
+				if (used * 2 >= mask)
+				{
+					unnamed++;
+					continue;
+				}
+				names[id] = event->name;
+				used++;
+
+				q_uint length = (q_uint)strlen(event->name);
+				fputc('N', output);
+				fwrite(&id, sizeof(q_uint), 1, output);
+				fwrite(&length, sizeof(q_uint), 1, output);
+				fwrite(event->name, 1, length, output);
+			}
+
+			q_long start = (q_long)(event->start - origin);
+			fputc('E', output);
+			fwrite(&buffer->thread, sizeof(q_uint), 1, output);
+			fwrite(&id, sizeof(q_uint), 1, output);
+			fwrite(&start, sizeof(q_long), 1, output);
+			fwrite(&event->duration, sizeof(q_ulong), 1, output);
+		}
+	}
+
+	atomic_store_explicit(&qp_unnamed, unnamed, memory_order_relaxed);
+	Q_FREE(names);
+	return !ferror(output);
+}
+
+// Read length-prefixed string written by the binary export
+static q_char *qpReadString(FILE *input)
+{
+	q_uint length;
+	if (fread(&length, sizeof(q_uint), 1, input) != 1 || length > 65536)
+	{
+		return q_null;
+	}
+
+	q_char *result = Q_MALLOC(length + 1);
+	if (result == q_null || fread(result, 1, length, input) != length)
+	{
+		Q_FREE(result);
+		return q_null;
+	}
+	result[length] = 0;
+	return result;
+}
+
+// Convert binary trace into Chrome trace event JSON
+Q_API q_bool qpDecode(FILE *input, FILE *output)
+{
+	q_char magic[sizeof(Q_PROFILE_BINARY_MAGIC) - 1];
+	q_double rate;
+	if (fread(magic, 1, sizeof(magic), input) != sizeof(magic) || memcmp(magic, Q_PROFILE_BINARY_MAGIC, sizeof(magic)) != 0 ||
+		fread(&rate, sizeof(q_double), 1, input) != 1)
+	{
+		return q_false;
+	}
+
+	q_char **names = Q_CALLOC(Q_PROFILE_NAME_CAPACITY, sizeof(q_char *));
+	if (names == q_null)
+	{
+		return q_false;
+	}
+
+	q_bool result = q_true;
+	q_bool first = q_true;
+	q_int tag;
+	fprintf(output, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	while (result && (tag = fgetc(input)) != EOF)
+	{
+		q_uint id;
+		if (fread(&id, sizeof(q_uint), 1, input) != 1)
+		{
+			result = q_false;
+		}
+		else if (tag == 'N' && id < Q_PROFILE_NAME_CAPACITY)
+		{
+			Q_FREE(names[id]);
+			names[id] = qpReadString(input);
+			result = names[id] != q_null;
+		}
+		else if (tag == 'T')
+		{
+			q_char *name = qpReadString(input);
+			if (name != q_null)
+			{
+				qpWriteThread(output, &first, id, (q_str)name);
+			}
+			result = name != q_null;
+			Q_FREE(name);
+		}
+		else if (tag == 'E')
+		{
+			q_uint name;
+			q_long start;
+			q_ulong duration;
+			result = fread(&name, sizeof(q_uint), 1, input) == 1 && fread(&start, sizeof(q_long), 1, input) == 1 &&
+				fread(&duration, sizeof(q_ulong), 1, input) == 1 && name < Q_PROFILE_NAME_CAPACITY && names[name] != q_null;
+			if (result)
+			{
+				qpWriteZone(output, &first, id, (q_str)names[name], start, duration, rate);
+			}
+		}
+		else
+		{
+			result = q_false;
+		}
+	}
+	fprintf(output, "\n]}\n");
+
+	for (q_uint i = 0; i < Q_PROFILE_NAME_CAPACITY; i++)
+	{
+		Q_FREE(names[i]);
+	}
+	Q_FREE(names);
+	return result;
+}
@@ -0,0 +1,91 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qprofile.h
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef QPROFILE_H
+#define QPROFILE_H
+
+#if defined(_MSC_VER) && (_MSC_VER > 1000)
+#pragma once
+#endif /* defined(_MSC_VER) && (_MSC_VER > 1000) */
+
+#include <stdio.h> // FILE
+#include "quite.h"
+
+//// Profiling zones ////
+
+// Zones each thread can record before further ones are dropped
+#ifndef Q_PROFILE_BUFFER_EVENTS
+	#define Q_PROFILE_BUFFER_EVENTS 16384
+#endif /* Q_PROFILE_BUFFER_EVENTS */
+
+// Deepest nesting recorded, deeper zones are skipped
+#ifndef Q_PROFILE_MAX_DEPTH
+	#define Q_PROFILE_MAX_DEPTH 64
+#endif /* Q_PROFILE_MAX_DEPTH */
+
+#define Q_PROFILE_BINARY_MAGIC "QPRF1"
+
+// Zone names must outlive the export, string literals are the intended use
+#if defined(Q_ENABLE_PROFILING)
+	#define Q_PROFILE_BEGIN(n) qpBegin(n)
+	#define Q_PROFILE_END() qpEnd()
+	#define Q_PROFILE_THREAD(n) qpThreadName(n)
+	#define Q_PROFILE_JOIN(a, b) a##b
+	#define Q_PROFILE_NAME(a, b) Q_PROFILE_JOIN(a, b)
+
+	// Zone ending with the enclosing block, which needs the cleanup attribute of GCC or Clang.
+	// Other compilers stop at its use rather than at the header, so files using only
+	// Q_PROFILE_BEGIN and Q_PROFILE_END still build.
+	#if defined(__GNUC__) || defined(__clang__)
+		#define Q_PROFILE_SCOPE(n) __attribute__((cleanup(qpScopeEnd))) q_int Q_PROFILE_NAME(q_profile_scope_, __LINE__) = (qpBegin(n), 0)
+	#else
+		#define Q_PROFILE_SCOPE(n) _Static_assert(0, "Q_PROFILE_SCOPE needs the cleanup attribute of GCC or Clang, use Q_PROFILE_BEGIN and Q_PROFILE_END")
+	#endif /* defined(__GNUC__) || defined(__clang__) */
+#else
+	#define Q_PROFILE_BEGIN(n) (q_void)0
+	#define Q_PROFILE_END() (q_void)0
+	#define Q_PROFILE_THREAD(n) (q_void)0
+	#define Q_PROFILE_SCOPE(n)
+#endif /* Q_ENABLE_PROFILING */
+
+//// Functions ////
+
+// Prevent function name mangling
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+// Zone recording
+Q_API q_void qpBegin(q_str name);
+Q_API q_void qpEnd(q_void);
+Q_API q_void qpScopeEnd(q_int *scope);
+Q_API q_void qpThreadName(q_str name);
+
+// Trace management
+Q_API q_ulong qpDropped(q_void);
+Q_API q_void qpReset(q_void);
+Q_API q_bool qpExportChrome(FILE *output);
+Q_API q_bool qpExportBinary(FILE *output);
+Q_API q_bool qpDecode(FILE *input, FILE *output);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* QPROFILE_H */
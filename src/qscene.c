@@ -0,0 +1,597 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qscene.c
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+// Keep private copies of the inline functions unless the caller asked for external ones
+#if !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE)
+	#define Q_MATH_STATIC_INLINE
+#endif /* !defined(Q_MATH_IMPLEMENTATION) && !defined(Q_MATH_STATIC_INLINE) */
+
+// World updates use the SIMD helpers the target supports
+#if !defined(Q_MATH_SIMD)
+	#define Q_MATH_SIMD
+#endif /* Q_MATH_SIMD */
+
+#include <string.h> // memchr, memcpy, memmove, memset
+#include "qscene.h"
+#include "qutils.h"
+
+// Slot arrays start on cache lines
+#define Q_SCENE_ALIGNMENT 64
+
+//// Internal types ////
+
+// Arrays indexed by slot, each entry is (name, type)
+#define QS_SLOT_ARRAYS(X) \
+	X(tx, q_float) \
+	X(ty, q_float) \
+	X(tz, q_float) \
+	X(rx, q_float) \
+	X(ry, q_float) \
+	X(rz, q_float) \
+	X(rw, q_float) \
+	X(sx, q_float) \
+	X(sy, q_float) \
+	X(sz, q_float) \
+	X(parent, q_uint) \
+	X(size, q_uint) \
+	X(id, q_uint) \
+	X(stamp, q_uint) \
+	X(dirty, q_uchar) \
+	X(world, q_matrix44)
+
+struct q_scene
+{
+	// Local transforms and hierarchy in depth-first order, where parent and size are in slots
+	#define QS_MEMBER(name, type) type *name;
+	QS_SLOT_ARRAYS(QS_MEMBER)
+	#undef QS_MEMBER
+
+	// Slot of each node id, or the next free id while the id is unused
+	q_uint *slot;
+	q_uint ids;
+	q_uint free;
+
+	q_uint count;
+	q_uint capacity;
+	q_uint pass;
+};
+
+//// Slot management ////
+
+// Grow every array to hold capacity nodes
+static q_bool qsReserve(q_scene *scene, q_uint capacity)
+{
+	if (capacity <= scene->capacity)
+	{
+		return q_true;
+	}
+
+	#define QS_GROW(name, type) \
+		{ \
+			type *grown = quReallocAligned(scene->name, (q_ulong)capacity * sizeof(type), Q_SCENE_ALIGNMENT); \
+			if (grown == q_null) \
+			{ \
+				return q_false; \
+			} \
+			scene->name = grown; \
+		}
+	QS_SLOT_ARRAYS(QS_GROW)
+	QS_GROW(slot, q_uint)
+	#undef QS_GROW
+
+	scene->capacity = capacity;
+	return q_true;
+}
+
+// Move count slots from one position to another, which may overlap
+static q_void qsMove(q_scene *scene, q_uint to, q_uint from, q_uint count)
+{
+	#define QS_MOVE(name, type) memmove(scene->name + to, scene->name + from, (q_ulong)count * sizeof(type));
+	QS_SLOT_ARRAYS(QS_MOVE)
+	#undef QS_MOVE
+}
+
+// Swap the slot ranges [first, middle) and [middle, last), staging the shorter one in scratch
+static q_bool qsRotate(q_scene *scene, q_uint first, q_uint middle, q_uint last)
+{
+	q_uint left = middle - first;
+	q_uint right = last - middle;
+	q_uint staged = left < right ? left : right;
+	q_handle scratch = quAlloc((q_ulong)staged * sizeof(q_matrix44));
+	if (scratch == q_null)
+	{
+		return q_false;
+	}
+
+	#define QS_ROTATE(name, type) \
+		if (left <= right) \
+		{ \
+			memcpy(scratch, scene->name + first, (q_ulong)left * sizeof(type)); \
+			memmove(scene->name + first, scene->name + middle, (q_ulong)right * sizeof(type)); \
+			memcpy(scene->name + first + right, scratch, (q_ulong)left * sizeof(type)); \
+		} \
+		else \
+		{ \
+			memcpy(scratch, scene->name + middle, (q_ulong)right * sizeof(type)); \
+			memmove(scene->name + first + right, scene->name + first, (q_ulong)left * sizeof(type)); \
+			memcpy(scene->name + first, scratch, (q_ulong)right * sizeof(type)); \
+		}
+	QS_SLOT_ARRAYS(QS_ROTATE)
+	#undef QS_ROTATE
+
+	quFree(scratch);
+	return q_true;
+}
+
+// Add count to the subtree size of slot and each of its ancestors
+static q_void qsGrowAncestors(q_scene *scene, q_uint slot, q_uint count)
+{
+	for (; slot != Q_SCENE_NONE; slot = scene->parent[slot])
+	{
+		scene->size[slot] += count;
+	}
+}
+
+// Subtract count from the subtree size of slot and each of its ancestors
+static q_void qsShrinkAncestors(q_scene *scene, q_uint slot, q_uint count)
+{
+	for (; slot != Q_SCENE_NONE; slot = scene->parent[slot])
+	{
+		scene->size[slot] -= count;
+	}
+}
+
+// Rebuild parent slots and the id map from first onwards, after sizes and order have changed
+static q_void qsReindex(q_scene *scene, q_uint first)
+{
+	for (q_uint i = first; i < scene->count; i++)
+	{
+		// Nearest earlier slot whose subtree still covers this one
+		q_uint parent = i > 0 ? i - 1 : Q_SCENE_NONE;
+		while (parent != Q_SCENE_NONE && parent + scene->size[parent] <= i)
+		{
+			parent = scene->parent[parent];
+		}
+
+		scene->parent[i] = parent;
+		scene->slot[scene->id[i]] = i;
+	}
+}
+
+//// Scene management ////
+
+// Create scene with room for capacity nodes, zero for default
+Q_API q_scene *qsCreate(q_uint capacity)
+{
+	q_scene *scene = Q_MALLOC(sizeof(q_scene));
+	if (scene == q_null)
+	{
+		return q_null;
+	}
+
+	memset(scene, 0, sizeof(q_scene));
+	scene->free = Q_SCENE_NONE;
+	if (!qsReserve(scene, capacity ? capacity : Q_SCENE_CAPACITY))
+	{
+		qsDestroy(scene);
+		return q_null;
+	}
+	return scene;
+}
+
+// Destroy scene
+Q_API q_void qsDestroy(q_scene *scene)
+{
+	if (scene == q_null)
+	{
+		return;
+	}
+
+	#define QS_FREE(name, type) quFreeAligned(scene->name);
+	QS_SLOT_ARRAYS(QS_FREE)
+	QS_FREE(slot, q_uint)
+	#undef QS_FREE
+
+	Q_FREE(scene);
+}
+
+// Remove every node while keeping the arrays
+Q_API q_void qsClear(q_scene *scene)
+{
+	scene->count = 0;
+	scene->ids = 0;
+	scene->free = Q_SCENE_NONE;
+}
+
+// Get node count
+Q_API q_uint qsCount(const q_scene *scene)
+{
+	return scene->count;
+}
+
+//// Hierarchy editing ////
+
+// Add node as the last child of parent, or as the last root when parent is Q_SCENE_NONE
+Q_API q_uint qsAdd(q_scene *scene, q_uint parent)
+{
+	if (scene->count == scene->capacity && !qsReserve(scene, scene->capacity * 2))
+	{
+		return Q_SCENE_NONE;
+	}
+
+	// Reuse a removed id before handing out a new one
+	q_uint node = scene->free;
+	if (node != Q_SCENE_NONE)
+	{
+		scene->free = scene->slot[node];
+	}
+	else
+	{
+		node = scene->ids++;
+	}
+
+	// Nodes added in depth-first order land at the end and move nothing
+	q_uint position = scene->count;
+	if (parent != Q_SCENE_NONE)
+	{
+		q_uint above = scene->slot[parent];
+		position = above + scene->size[above];
+		qsGrowAncestors(scene, above, 1);
+	}
+	qsMove(scene, position + 1, position, scene->count - position);
+	scene->count++;
+
+	scene->tx[position] = scene->ty[position] = scene->tz[position] = 0.0f;
+	scene->rx[position] = scene->ry[position] = scene->rz[position] = 0.0f;
+	scene->rw[position] = 1.0f;
+	scene->sx[position] = scene->sy[position] = scene->sz[position] = 1.0f;
+	scene->size[position] = 1;
+	scene->id[position] = node;
+	scene->stamp[position] = 0;
+	scene->dirty[position] = 1;
+
+	qsReindex(scene, position);
+	return node;
+}
+
+// Remove node along with its subtree
+Q_API q_void qsRemove(q_scene *scene, q_uint node)
+{
+	q_uint first = scene->slot[node];
+	q_uint count = scene->size[first];
+	qsShrinkAncestors(scene, scene->parent[first], count);
+
+	for (q_uint i = first; i < first + count; i++)
+	{
+		scene->slot[scene->id[i]] = scene->free;
+		scene->free = scene->id[i];
+	}
+
+	qsMove(scene, first, first + count, scene->count - first - count);
+	scene->count -= count;
+	qsReindex(scene, first);
+}
+
+// Move node and its subtree under parent, failing if parent lies inside that subtree
+Q_API q_bool qsSetParent(q_scene *scene, q_uint node, q_uint parent)
+{
+	q_uint first = scene->slot[node];
+	q_uint count = scene->size[first];
+	q_uint target = parent != Q_SCENE_NONE ? scene->slot[parent] : Q_SCENE_NONE;
+	if (target != Q_SCENE_NONE && target >= first && target < first + count)
+	{
+		return q_false;
+	}
+
+	// Sizes travel with their slots, so fix them while parent slots are still the old ones
+	q_uint previous = scene->parent[first];
+	q_uint position = target != Q_SCENE_NONE ? target + scene->size[target] : scene->count;
+	qsShrinkAncestors(scene, previous, count);
+	qsGrowAncestors(scene, target, count);
+
+	// Subtree is taken out and placed after the last child of its new parent
+	q_uint moved = first;
+	q_bool rotated = q_true;
+	if (position > first + count)
+	{
+		moved = position - count;
+		rotated = qsRotate(scene, first, first + count, position);
+	}
+	else if (position < first)
+	{
+		moved = position;
+		rotated = qsRotate(scene, position, first, first + count);
+	}
+
+	if (!rotated)
+	{
+		qsShrinkAncestors(scene, target, count);
+		qsGrowAncestors(scene, previous, count);
+		return q_false;
+	}
+
+	qsReindex(scene, moved < first ? moved : first);
+	scene->dirty[moved] = 1;
+	return q_true;
+}
+
+//// Hierarchy queries ////
+
+// Get parent of node
+Q_API q_uint qsParent(const q_scene *scene, q_uint node)
+{
+	q_uint parent = scene->parent[scene->slot[node]];
+	return parent != Q_SCENE_NONE ? scene->id[parent] : Q_SCENE_NONE;
+}
+
+// Get first child of node
+Q_API q_uint qsFirstChild(const q_scene *scene, q_uint node)
+{
+	if (node == Q_SCENE_NONE)
+	{
+		return scene->count ? scene->id[0] : Q_SCENE_NONE;
+	}
+
+	q_uint slot = scene->slot[node];
+	return scene->size[slot] > 1 ? scene->id[slot + 1] : Q_SCENE_NONE;
+}
+
+// Get sibling after node
+Q_API q_uint qsNextSibling(const q_scene *scene, q_uint node)
+{
+	q_uint slot = scene->slot[node];
+	q_uint parent = scene->parent[slot];
+	q_uint next = slot + scene->size[slot];
+	q_uint end = parent != Q_SCENE_NONE ? parent + scene->size[parent] : scene->count;
+	return next < end ? scene->id[next] : Q_SCENE_NONE;
+}
+
+// Get node count of subtree, including node
+Q_API q_uint qsSubtreeSize(const q_scene *scene, q_uint node)
+{
+	return scene->size[scene->slot[node]];
+}
+
+//// Local transforms ////
+
+// Set translation
+Q_API q_void qsSetTranslation(q_scene *scene, q_uint node, q_vector3 translation)
+{
+	q_uint slot = scene->slot[node];
+	scene->tx[slot] = translation.x;
+	scene->ty[slot] = translation.y;
+	scene->tz[slot] = translation.z;
+	scene->dirty[slot] = 1;
+}
+
+// Set rotation, which should be a unit quaternion
+Q_API q_void qsSetRotation(q_scene *scene, q_uint node, q_quaternion rotation)
+{
+	q_uint slot = scene->slot[node];
+	scene->rx[slot] = rotation.x;
+	scene->ry[slot] = rotation.y;
+	scene->rz[slot] = rotation.z;
+	scene->rw[slot] = rotation.w;
+	scene->dirty[slot] = 1;
+}
+
+// Set scale
+Q_API q_void qsSetScale(q_scene *scene, q_uint node, q_vector3 scale)
+{
+	q_uint slot = scene->slot[node];
+	scene->sx[slot] = scale.x;
+	scene->sy[slot] = scale.y;
+	scene->sz[slot] = scale.z;
+	scene->dirty[slot] = 1;
+}
+
+// Get translation
+Q_API q_vector3 qsGetTranslation(const q_scene *scene, q_uint node)
+{
+	q_uint slot = scene->slot[node];
+	q_vector3 result = { scene->tx[slot], scene->ty[slot], scene->tz[slot] };
+	return result;
+}
+
+// Get rotation
+Q_API q_quaternion qsGetRotation(const q_scene *scene, q_uint node)
+{
+	q_uint slot = scene->slot[node];
+	q_quaternion result = { scene->rx[slot], scene->ry[slot], scene->rz[slot], scene->rw[slot] };
+	return result;
+}
+
+// Get scale
+Q_API q_vector3 qsGetScale(const q_scene *scene, q_uint node)
+{
+	q_uint slot = scene->slot[node];
+	q_vector3 result = { scene->sx[slot], scene->sy[slot], scene->sz[slot] };
+	return result;
+}
+
+// Get world transform, which moves when the hierarchy is edited
+Q_API const q_matrix44 *qsWorld(const q_scene *scene, q_uint node)
+{
+	return scene->world + scene->slot[node];
+}
+
+//// World updates ////
+
+#if defined(QM_SIMD)
+// Store register into a matrix row
+static inline q_void qsStoreRow(q_float *row, q_simd reg)
+{
+#if defined(Q_MATH_SSE)
+	_mm_storeu_ps(row, reg);
+#else
+	vst1q_f32(row, reg);
+#endif /* defined(Q_MATH_SSE) */
+}
+
+// Sum local rows weighted by one parent row
+static inline q_simd qsCombineRows(q_float x, q_float y, q_float z, q_float w, q_simd row0, q_simd row1, q_simd row2, q_simd row3)
+{
+	q_simd result = simdmul(simdsplat(x), row0);
+	result = simdadd(result, simdmul(simdsplat(y), row1));
+	result = simdadd(result, simdmul(simdsplat(z), row2));
+	result = simdadd(result, simdmul(simdsplat(w), row3));
+	return result;
+}
+#endif /* QM_SIMD */
+
+// Recompute world transforms of every slot in [first, last), in order since parents come first
+static q_void qsComputeSlots(q_scene *scene, q_uint first, q_uint last)
+{
+	q_uint pass = scene->pass;
+	for (q_uint i = first; i < last; i++)
+	{
+		q_uint parent = scene->parent[i];
+
+		// Scaled rotation columns and translation, as qmQuaternionToMatrix44 with scale applied first
+		q_float x = scene->rx[i], y = scene->ry[i], z = scene->rz[i], w = scene->rw[i];
+		q_float x2 = x + x, y2 = y + y, z2 = z + z;
+		q_float xx = x * x2, yy = y * y2, zz = z * z2;
+		q_float xy = x * y2, xz = x * z2, yz = y * z2;
+		q_float wx = w * x2, wy = w * y2, wz = w * z2;
+		q_float sx = scene->sx[i], sy = scene->sy[i], sz = scene->sz[i];
+
+#if defined(QM_SIMD)
+		// Rows are contiguous in memory, so each world row is a sum of local rows
+		q_simd local0 = simdset((1.0f - yy - zz) * sx, (xy - wz) * sy, (xz + wy) * sz, scene->tx[i]);
+		q_simd local1 = simdset((xy + wz) * sx, (1.0f - xx - zz) * sy, (yz - wx) * sz, scene->ty[i]);
+		q_simd local2 = simdset((xz - wy) * sx, (yz + wx) * sy, (1.0f - xx - yy) * sz, scene->tz[i]);
+		q_simd local3 = simdset(0.0f, 0.0f, 0.0f, 1.0f);
+		q_matrix44 *r = scene->world + i;
+
+		if (parent == Q_SCENE_NONE)
+		{
+			qsStoreRow(&r->m0, local0);
+			qsStoreRow(&r->m1, local1);
+			qsStoreRow(&r->m2, local2);
+		}
+		else
+		{
+			// World transforms are affine, so the bottom row of the product is known
+			const q_matrix44 *p = scene->world + parent;
+			qsStoreRow(&r->m0, qsCombineRows(p->m0, p->m4, p->m8, p->m12, local0, local1, local2, local3));
+			qsStoreRow(&r->m1, qsCombineRows(p->m1, p->m5, p->m9, p->m13, local0, local1, local2, local3));
+			qsStoreRow(&r->m2, qsCombineRows(p->m2, p->m6, p->m10, p->m14, local0, local1, local2, local3));
+		}
+		qsStoreRow(&r->m3, local3);
+#else
+		q_matrix44 local = {
+			(1.0f - yy - zz) * sx, (xy - wz) * sy, (xz + wy) * sz, scene->tx[i],
+			(xy + wz) * sx, (1.0f - xx - zz) * sy, (yz - wx) * sz, scene->ty[i],
+			(xz - wy) * sx, (yz + wx) * sy, (1.0f - xx - yy) * sz, scene->tz[i],
+			0.0f, 0.0f, 0.0f, 1.0f
+		};
+
+		if (parent == Q_SCENE_NONE)
+		{
+			scene->world[i] = local;
+		}
+		else
+		{
+			// World transforms are affine, so the bottom row of the product is known
+			const q_matrix44 *p = scene->world + parent;
+			q_matrix44 *r = scene->world + i;
+			r->m0 = p->m0 * local.m0 + p->m4 * local.m1 + p->m8 * local.m2;
+			r->m1 = p->m1 * local.m0 + p->m5 * local.m1 + p->m9 * local.m2;
+			r->m2 = p->m2 * local.m0 + p->m6 * local.m1 + p->m10 * local.m2;
+			r->m4 = p->m0 * local.m4 + p->m4 * local.m5 + p->m8 * local.m6;
+			r->m5 = p->m1 * local.m4 + p->m5 * local.m5 + p->m9 * local.m6;
+			r->m6 = p->m2 * local.m4 + p->m6 * local.m5 + p->m10 * local.m6;
+			r->m8 = p->m0 * local.m8 + p->m4 * local.m9 + p->m8 * local.m10;
+			r->m9 = p->m1 * local.m8 + p->m5 * local.m9 + p->m9 * local.m10;
+			r->m10 = p->m2 * local.m8 + p->m6 * local.m9 + p->m10 * local.m10;
+			r->m12 = p->m0 * local.m12 + p->m4 * local.m13 + p->m8 * local.m14 + p->m12;
+			r->m13 = p->m1 * local.m12 + p->m5 * local.m13 + p->m9 * local.m14 + p->m13;
+			r->m14 = p->m2 * local.m12 + p->m6 * local.m13 + p->m10 * local.m14 + p->m14;
+			r->m3 = r->m7 = r->m11 = 0.0f;
+			r->m15 = 1.0f;
+		}
+#endif /* QM_SIMD */
+
+		scene->stamp[i] = pass;
+	}
+	memset(scene->dirty + first, 0, last - first);
+}
+
+// Recompute world transforms of changed slots in [first, last). A slot changes when its local
+// transform did or its parent changed in this pass, and every slot under a changed one changes
+// with it, so clean slots are skipped a run at a time and changed subtrees are recomputed whole.
+// Only the first slot can have its parent outside the range.
+static q_uint qsUpdateSlots(q_scene *scene, q_uint first, q_uint last)
+{
+	q_uint updated = 0;
+	q_uint i = first;
+	if (first < last)
+	{
+		q_uint parent = scene->parent[first];
+		if (!scene->dirty[first] && parent != Q_SCENE_NONE && scene->stamp[parent] == scene->pass)
+		{
+			i = first + scene->size[first] < last ? first + scene->size[first] : last;
+			qsComputeSlots(scene, first, i);
+			updated = i - first;
+		}
+	}
+
+	while (i < last)
+	{
+		const q_uchar *dirty = memchr(scene->dirty + i, 1, last - i);
+		if (dirty == q_null)
+		{
+			break;
+		}
+
+		i = (q_uint)(dirty - scene->dirty);
+		q_uint end = i + scene->size[i] < last ? i + scene->size[i] : last;
+		qsComputeSlots(scene, i, end);
+		updated += end - i;
+		i = end;
+	}
+	return updated;
+}
+
+// Update every node
+Q_API q_uint qsUpdate(q_scene *scene)
+{
+	qsUpdateBegin(scene);
+	return qsUpdateSlots(scene, 0, scene->count);
+}
+
+// Start an update pass
+Q_API q_void qsUpdateBegin(q_scene *scene)
+{
+	// Stamps of zero mark nodes never updated, so the pass skips it when wrapping
+	scene->pass = scene->pass + 1 ? scene->pass + 1 : 1;
+}
+
+// Update node alone, for splitting the levels above independent subtrees
+Q_API q_uint qsUpdateNode(q_scene *scene, q_uint node)
+{
+	q_uint slot = scene->slot[node];
+	return qsUpdateSlots(scene, slot, slot + 1);
+}
+
+// Update node and its subtree
+Q_API q_uint qsUpdateSubtree(q_scene *scene, q_uint node)
+{
+	q_uint slot = scene->slot[node];
+	return qsUpdateSlots(scene, slot, slot + scene->size[slot]);
+}
@@ -0,0 +1,91 @@
+// Quite - Programming library for C applications
+// Copyright (C) 2024 Nicholas Ng
+//
+// src/qscene.h
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef QSCENE_H
+#define QSCENE_H
+
+#if defined(_MSC_VER) && (_MSC_VER > 1000)
+#pragma once
+#endif /* defined(_MSC_VER) && (_MSC_VER > 1000) */
+
+#include "qmath.h"
+
+//// Transform hierarchy ////
+
+// Nodes are kept in depth-first order, so parents precede their children and every subtree
+// is one contiguous range of slots. Node ids stay valid until the node is removed.
+typedef struct q_scene q_scene;
+
+// Parent of root nodes, and the id returned when a node cannot be added
+#define Q_SCENE_NONE 0xFFFFFFFFu
+
+#ifndef Q_SCENE_CAPACITY
+	#define Q_SCENE_CAPACITY 256
+#endif /* Q_SCENE_CAPACITY */
+
+//// Functions ////
+
+// Prevent function name mangling
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+// Scene management
+Q_API q_scene *qsCreate(q_uint capacity);
+Q_API q_void qsDestroy(q_scene *scene);
+Q_API q_void qsClear(q_scene *scene);
+Q_API q_uint qsCount(const q_scene *scene);
+
+// Hierarchy editing, which costs up to a move of every later slot unless nodes are
+// appended in depth-first order
+Q_API q_uint qsAdd(q_scene *scene, q_uint parent);
+Q_API q_void qsRemove(q_scene *scene, q_uint node);
+Q_API q_bool qsSetParent(q_scene *scene, q_uint node, q_uint parent);
+
+// Hierarchy queries, where qsFirstChild of Q_SCENE_NONE is the first root
+Q_API q_uint qsParent(const q_scene *scene, q_uint node);
+Q_API q_uint qsFirstChild(const q_scene *scene, q_uint node);
+Q_API q_uint qsNextSibling(const q_scene *scene, q_uint node);
+Q_API q_uint qsSubtreeSize(const q_scene *scene, q_uint node);
+
+// Local transforms, applied as scale, then rotation, then translation
+Q_API q_void qsSetTranslation(q_scene *scene, q_uint node, q_vector3 translation);
+Q_API q_void qsSetRotation(q_scene *scene, q_uint node, q_quaternion rotation);
+Q_API q_void qsSetScale(q_scene *scene, q_uint node, q_vector3 scale);
+Q_API q_vector3 qsGetTranslation(const q_scene *scene, q_uint node);
+Q_API q_quaternion qsGetRotation(const q_scene *scene, q_uint node);
+Q_API q_vector3 qsGetScale(const q_scene *scene, q_uint node);
+
+// World transforms, current as of the last update that covered the node
+Q_API const q_matrix44 *qsWorld(const q_scene *scene, q_uint node);
+
+// World updates recompute changed nodes and their descendants, returning how many were.
+// qsUpdate covers the whole scene. Otherwise qsUpdateBegin starts a pass, after which
+// qsUpdateNode and qsUpdateSubtree may run on disjoint subtrees from different threads,
+// once the ancestors of each have been updated in the same pass.
+Q_API q_uint qsUpdate(q_scene *scene);
+Q_API q_void qsUpdateBegin(q_scene *scene);
+Q_API q_uint qsUpdateNode(q_scene *scene, q_uint node);
+Q_API q_uint qsUpdateSubtree(q_scene *scene, q_uint node);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* QSCENE_H */
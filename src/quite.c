@@ -19,3 +19,6 @@
 #include "quite.h"
 #include "qutils.h"
 #include "qmath.h"
+#include "qprofile.h"
+#include "qscene.h"
+#include "qbvh.h"
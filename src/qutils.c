@@ -17,83 +17,1617 @@
 // along with this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include <stdarg.h> // va_list, va_start, va_end
-#include <stdio.h> // stdout, vprintf
-#include <string.h> // strcpy, strcat
+#include <stdatomic.h> // atomic_load_explicit, atomic_compare_exchange_weak_explicit
+#include <stddef.h> // ptrdiff_t, max_align_t
+#include <stdint.h> // uintptr_t, intmax_t, UINTPTR_MAX, SIZE_MAX
+#include <stdio.h> // stdout, vprintf, snprintf, fwrite, fread
+#include <string.h> // strcpy, strcat, memcpy, memset
 #include "qutils.h"
 
+#if defined(_WIN32)
+	#include <windows.h> // CreateThread, WaitForSingleObject, CloseHandle, Sleep, SwitchToThread, FlsAlloc
+#else
+	#include <pthread.h> // pthread_create, pthread_join, pthread_key_create, pthread_once
+	#include <sched.h> // sched_yield
+	#include <time.h> // nanosleep
+#endif /* defined(_WIN32) */
+
+// Library definitions of the allocation functions, not the call-site macros
+#undef quAlloc
+#undef quRealloc
+
+//// Internal types ////
+
+// Arena chunk, followed by its data
+struct q_arena_chunk
+{
+	q_arena_chunk *next;
+	q_ulong size;
+	q_ulong used;
+};
+
+// Arena with chunks reused after rewinding
+struct q_arena
+{
+	q_arena_chunk *first;
+	q_arena_chunk *current;
+	q_ulong chunkSize;
+};
+
+// Pool slab header, padded so objects keep allocator alignment
+typedef union q_pool_slab
+{
+	union q_pool_slab *next;
+	q_ldouble align;
+} q_pool_slab;
+
+// Pool with a plain free list, or a tagged-pointer lock-free stack when shared
+struct q_pool
+{
+	q_handle free;
+	_Atomic q_ulong head;
+	_Atomic uintptr_t slabs;
+	q_ulong size;
+	q_uint count;
+	q_bool shared;
+};
+
+#if defined(Q_ENABLE_ALLOC_STATS)
+// Header in front of every quAlloc block, padded so data keeps allocator alignment
+typedef union q_alloc_header
+{
+	struct
+	{
+		q_ulong size;
+		q_uint site;
+	} info;
+	q_ldouble align;
+} q_alloc_header;
+
+// Call site registered once and shared by every thread
+typedef struct q_alloc_site_entry
+{
+	_Atomic q_uint state;
+	q_str file;
+	q_uint line;
+} q_alloc_site_entry;
+
+// Counters written only by their owning thread and summed when queried
+typedef struct q_alloc_counters
+{
+	struct q_alloc_counters *next;
+	_Atomic q_bool active;
+	_Atomic q_long pending;
+	_Atomic q_ulong allocs;
+	_Atomic q_ulong reallocs;
+	_Atomic q_ulong frees;
+	_Atomic q_ulong histogram[Q_ALLOC_STATS_CLASSES];
+	_Atomic q_ulong siteCount[Q_ALLOC_STATS_SITES];
+	_Atomic q_long siteBytes[Q_ALLOC_STATS_SITES];
+} q_alloc_counters;
+#endif /* Q_ENABLE_ALLOC_STATS */
+
+// Log record slot, published to the consumer through its sequence number.
+// Deferred records keep the format string and hold packed arguments in text.
+typedef struct q_log_slot
+{
+	_Atomic q_ulong sequence;
+	q_str format;
+	q_int level;
+	q_uint length;
+	q_char text[Q_LOG_MAX_LENGTH];
+} q_log_slot;
+
+// Parsed printf conversion specification
+typedef struct q_log_spec
+{
+	q_uint length;
+	q_uint stars;
+	q_char modifier;
+	q_char conversion;
+} q_log_spec;
+
+// Bounded multi-producer single-consumer log ring drained by a background thread
+typedef struct q_log_ring
+{
+	_Atomic q_ulong tail;
+	_Atomic q_ulong head;
+	_Atomic q_ulong written;
+	_Atomic q_ulong dropped;
+	_Atomic q_bool running;
+	q_ulong mask;
+	q_log_overflow overflow;
+	q_log_mode mode;
+	q_str *formats;
+	q_uint formatCount;
+	q_uint formatMask;
+#if defined(_WIN32)
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif /* defined(_WIN32) */
+	q_log_slot *slots;
+} q_log_ring;
+
 //// Global variables ////
 
-static q_int qu_log_level = Q_LOG_INFO;
+Q_API q_char qu_log_thresholds[Q_LOG_CATEGORY_COUNT];
+static q_log_ring *_Atomic qu_log_ring = q_null;
+static _Atomic q_ulong qu_log_dropped = 0;
+
+#if defined(Q_ENABLE_ALLOC_STATS)
+static q_alloc_site_entry qu_alloc_sites[Q_ALLOC_STATS_SITES];
+static q_alloc_counters *_Atomic qu_alloc_threads = q_null;
+static _Atomic q_long qu_alloc_live = 0;
+static _Atomic q_long qu_alloc_peak = 0;
+static _Thread_local q_alloc_counters *qu_alloc_local = q_null;
+#if defined(_WIN32)
+static INIT_ONCE qu_alloc_once = INIT_ONCE_STATIC_INIT;
+static DWORD qu_alloc_key = FLS_OUT_OF_INDEXES;
+#else
+static pthread_once_t qu_alloc_once = PTHREAD_ONCE_INIT;
+static pthread_key_t qu_alloc_key;
+#endif /* defined(_WIN32) */
+#endif /* Q_ENABLE_ALLOC_STATS */
+
+//// Threads ////
+
+// Yield processor to other threads
+static q_void quThreadYield(q_void)
+{
+#if defined(_WIN32)
+	SwitchToThread();
+#else
+	sched_yield();
+#endif /* defined(_WIN32) */
+}
+
+// Sleep for given microseconds
+static q_void quThreadSleep(q_uint us)
+{
+#if defined(_WIN32)
+	Sleep(us / 1000 ? us / 1000 : 1);
+#else
+	struct timespec duration = { us / 1000000, (us % 1000000) * 1000 };
+	nanosleep(&duration, q_null);
+#endif /* defined(_WIN32) */
+}
 
 //// Log management ////
 
+// Log level prefix
+static q_str quLogPrefix(q_int level)
+{
+	switch (level)
+	{
+	case Q_LOG_TRACE:
+		return "trace: ";
+	case Q_LOG_DEBUG:
+		return "debug: ";
+	case Q_LOG_INFO:
+		return "info: ";
+	case Q_LOG_WARN:
+		return "warn: ";
+	case Q_LOG_ERROR:
+		return "error: ";
+	}
+	return "";
+}
+
+// Parse conversion specification starting at percent sign
+static q_void quLogSpec(q_str format, q_log_spec *spec)
+{
+	q_uint i = 1;
+	spec->stars = 0;
+	spec->modifier = 0;
+
+	while (format[i] && strchr("-+ #0'", format[i]))
+	{
+		i++;
+	}
+	for (q_int pass = 0; pass < 2; pass++)
+	{
+		if (pass == 1)
+		{
+			if (format[i] != '.')
+			{
+				break;
+			}
+			i++;
+		}
+		if (format[i] == '*')
+		{
+			spec->stars++;
+			i++;
+		}
+		while (format[i] >= '0' && format[i] <= '9')
+		{
+			i++;
+		}
+	}
+
+	// Long modifiers are folded into one character: H for hh, Q for ll, D for L
+	if ((format[i] == 'h' || format[i] == 'l') && format[i + 1] == format[i])
+	{
+		spec->modifier = format[i] == 'h' ? 'H' : 'Q';
+		i += 2;
+	}
+	else if (format[i] && strchr("hljztL", format[i]))
+	{
+		spec->modifier = format[i] == 'L' ? 'D' : format[i];
+		i++;
+	}
+
+	spec->conversion = format[i];
+	spec->length = format[i] ? i + 1 : i;
+}
+
+// Pack arguments for format into payload, returning packed length
+static q_uint quLogPack(q_ucharp payload, q_uint capacity, q_str format, va_list args)
+{
+	q_uint used = 0;
+	for (q_str f = strchr(format, '%'); f != q_null; f = strchr(f, '%'))
+	{
+		if (f[1] == '%')
+		{
+			f += 2;
+			continue;
+		}
+
+		q_log_spec spec;
+		quLogSpec(f, &spec);
+		f += spec.length;
+
+		for (q_uint i = 0; i < spec.stars; i++)
+		{
+			q_long star = va_arg(args, int);
+			if (used + sizeof(q_long) > capacity)
+			{
+				return used;
+			}
+			memcpy(payload + used, &star, sizeof(q_long));
+			used += sizeof(q_long);
+		}
+
+		q_long integer = 0;
+		q_double real = 0.0;
+		switch (spec.conversion)
+		{
+		case 'd': case 'i': case 'o': case 'u': case 'x': case 'X': case 'c':
+			switch (spec.modifier)
+			{
+			case 'l':
+				integer = va_arg(args, long);
+				break;
+			case 'Q':
+				integer = va_arg(args, long long);
+				break;
+			case 'j':
+				integer = va_arg(args, intmax_t);
+				break;
+			case 'z':
+				integer = (q_long)va_arg(args, size_t);
+				break;
+			case 't':
+				integer = va_arg(args, ptrdiff_t);
+				break;
+			default:
+				integer = va_arg(args, int);
+				break;
+			}
+			break;
+		case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+			real = spec.modifier == 'D' ? (q_double)va_arg(args, long double) : va_arg(args, double);
+			memcpy(&integer, &real, sizeof(q_long));
+			break;
+		case 'p':
+			integer = (q_long)(uintptr_t)va_arg(args, q_voidp);
+			break;
+		case 'n':
+			(q_void)va_arg(args, q_voidp);
+			continue;
+		case 's':
+		{
+			// Strings are copied, as the caller may release them before the record is formatted
+			q_str string = va_arg(args, q_str);
+			string = string ? string : "(null)";
+			if (used + sizeof(q_ushort) > capacity)
+			{
+				return used;
+			}
+
+			// Clamp before narrowing, so long strings are truncated rather than wrapped
+			size_t room = capacity - used - sizeof(q_ushort);
+			size_t full = strlen(string);
+			q_ushort length = (q_ushort)(full < room ? full : room);
+			memcpy(payload + used, &length, sizeof(q_ushort));
+			memcpy(payload + used + sizeof(q_ushort), string, length);
+			used += sizeof(q_ushort) + length;
+			continue;
+		}
+		default:
+			// Arguments after an unknown conversion cannot be located
+			return used;
+		}
+
+		if (used + sizeof(q_long) > capacity)
+		{
+			return used;
+		}
+		memcpy(payload + used, &integer, sizeof(q_long));
+		used += sizeof(q_long);
+	}
+	return used;
+}
+
+// Format packed payload with format into text, returning text length
+static q_uint quLogFormat(q_char *text, q_uint capacity, q_str format, const q_uchar *payload, q_uint length)
+{
+	q_uint written = 0;
+	q_uint used = 0;
+	while (*format && written + 1 < capacity)
+	{
+		if (*format != '%' || format[1] == '%')
+		{
+			text[written++] = *format;
+			format += *format == '%' ? 2 : 1;
+			continue;
+		}
+
+		q_log_spec spec;
+		quLogSpec(format, &spec);
+
+		q_char part[32];
+		if (spec.length >= sizeof(part))
+		{
+			break;
+		}
+		memcpy(part, format, spec.length);
+		part[spec.length] = 0;
+		format += spec.length;
+
+		q_int star[2] = { 0, 0 };
+		for (q_uint i = 0; i < spec.stars; i++)
+		{
+			q_long value;
+			if (used + sizeof(q_long) > length)
+			{
+				text[written] = 0;
+				return written;
+			}
+			memcpy(&value, payload + used, sizeof(q_long));
+			used += sizeof(q_long);
+			star[i] = (q_int)value;
+		}
+
+		q_char *out = (q_char *)text + written;
+		size_t room = capacity - written;
+		q_int result = 0;
+
+		#define Q_LOG_EMIT(v) ( \
+			spec.stars == 0 ? snprintf((char *)out, room, (char *)part, v) : \
+			spec.stars == 1 ? snprintf((char *)out, room, (char *)part, star[0], v) : \
+			snprintf((char *)out, room, (char *)part, star[0], star[1], v))
+
+		if (spec.conversion == 'n')
+		{
+			continue;
+		}
+		if (spec.conversion == 's')
+		{
+			q_ushort size;
+			if (used + sizeof(q_ushort) > length)
+			{
+				break;
+			}
+			memcpy(&size, payload + used, sizeof(q_ushort));
+			used += sizeof(q_ushort);
+
+			q_char string[Q_LOG_MAX_LENGTH];
+			size = size < sizeof(string) - 1 ? size : sizeof(string) - 1;
+			memcpy(string, payload + used, size);
+			string[size] = 0;
+			used += size;
+			result = Q_LOG_EMIT((char *)string);
+		}
+		else
+		{
+			q_long value;
+			if (used + sizeof(q_long) > length)
+			{
+				break;
+			}
+			memcpy(&value, payload + used, sizeof(q_long));
+			used += sizeof(q_long);
+
+			q_double real;
+			memcpy(&real, &value, sizeof(q_double));
+			switch (spec.conversion)
+			{
+			case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+				result = spec.modifier == 'D' ? Q_LOG_EMIT((long double)real) : Q_LOG_EMIT(real);
+				break;
+			case 'p':
+				result = Q_LOG_EMIT((q_voidp)(uintptr_t)value);
+				break;
+			default:
+				switch (spec.modifier)
+				{
+				case 'l':
+					result = Q_LOG_EMIT((long)value);
+					break;
+				case 'Q':
+					result = Q_LOG_EMIT((long long)value);
+					break;
+				case 'j':
+					result = Q_LOG_EMIT((intmax_t)value);
+					break;
+				case 'z':
+					result = Q_LOG_EMIT((size_t)value);
+					break;
+				case 't':
+					result = Q_LOG_EMIT((ptrdiff_t)value);
+					break;
+				default:
+					result = Q_LOG_EMIT((int)value);
+					break;
+				}
+				break;
+			}
+		}
+
+		#undef Q_LOG_EMIT
+
+		if (result < 0)
+		{
+			break;
+		}
+		written += (q_uint)result < room ? (q_uint)result : (q_uint)room - 1;
+	}
+
+	text[written] = 0;
+	return written;
+}
+
+// Render deferred record as a text line with prefix and newline
+static q_uint quLogRender(q_char *line, q_int level, q_str format, const q_uchar *payload, q_uint length)
+{
+	q_uint prefix = strlen(strcpy((char *)line, quLogPrefix(level)));
+	q_uint result = prefix + quLogFormat(line + prefix, Q_LOG_MAX_LENGTH - prefix - 1, format, payload, length);
+	line[result++] = '\n';
+	return result;
+}
+
+// Write binary record, emitting its format string the first time it is seen
+static q_void quLogEmit(q_log_ring *ring, q_log_slot *slot)
+{
+	q_uint slotIndex = (q_uint)(((uintptr_t)slot->format >> 3) * 2654435761u) & ring->formatMask;
+	while (ring->formats[slotIndex] != q_null && ring->formats[slotIndex] != slot->format)
+	{
+		slotIndex = (slotIndex + 1) & ring->formatMask;
+	}
+
+	// Identifiers are table positions, so they stay stable while the table is not regrown
+	if (ring->formats[slotIndex] == q_null)
+	{
+		// A full table keeps probes short, so records with new formats are counted as dropped
+		if (ring->formatCount * 2 >= ring->formatMask)
+		{
+			atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+			return;
+		}
+
+		ring->formats[slotIndex] = slot->format;
+		ring->formatCount++;
+
+		q_uint length = strlen(slot->format);
+		fputc('F', stdout);
+		fwrite(&slotIndex, sizeof(q_uint), 1, stdout);
+		fwrite(&length, sizeof(q_uint), 1, stdout);
+		fwrite(slot->format, 1, length, stdout);
+	}
+
+	q_uchar level = (q_uchar)slot->level;
+	fputc('R', stdout);
+	fwrite(&level, 1, 1, stdout);
+	fwrite(&slotIndex, sizeof(q_uint), 1, stdout);
+	fwrite(&slot->length, sizeof(q_uint), 1, stdout);
+	fwrite(slot->text, 1, slot->length, stdout);
+}
+
+// Claim ring slot, or return null when full and dropping
+static q_log_slot *quLogClaim(q_log_ring *ring)
+{
+	q_ulong position = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	for (;;)
+	{
+		q_log_slot *slot = &ring->slots[position & ring->mask];
+		q_ulong sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		q_long diff = (q_long)(sequence - position);
+		if (diff == 0)
+		{
+			if (atomic_compare_exchange_weak_explicit(&ring->tail, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+			{
+				return slot;
+			}
+		}
+		else if (diff < 0)
+		{
+			if (ring->overflow == Q_LOG_OVERFLOW_DROP)
+			{
+				atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+				return q_null;
+			}
+			quThreadYield();
+			position = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+		}
+		else
+		{
+			position = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+		}
+	}
+}
+
+// Write published records in batches until stopped and drained
+#if defined(_WIN32)
+static DWORD WINAPI quLogConsume(LPVOID param)
+#else
+static q_voidp quLogConsume(q_voidp param)
+#endif /* defined(_WIN32) */
+{
+	q_log_ring *ring = param;
+	q_ulong head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+	for (;;)
+	{
+		q_bool running = atomic_load_explicit(&ring->running, memory_order_acquire);
+		q_ulong start = head;
+		for (;;)
+		{
+			q_log_slot *slot = &ring->slots[head & ring->mask];
+			if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != head + 1)
+			{
+				break;
+			}
+
+			if (slot->format == q_null)
+			{
+				fwrite(slot->text, 1, slot->length, stdout);
+			}
+			else if (ring->mode == Q_LOG_MODE_BINARY)
+			{
+				quLogEmit(ring, slot);
+			}
+			else
+			{
+				q_char line[Q_LOG_MAX_LENGTH];
+				fwrite(line, 1, quLogRender(line, slot->level, slot->format, (q_ucharp)slot->text, slot->length), stdout);
+			}
+			atomic_store_explicit(&slot->sequence, head + ring->mask + 1, memory_order_release);
+			head++;
+		}
+
+		if (head != start)
+		{
+			fflush(stdout);
+			atomic_store_explicit(&ring->head, head, memory_order_relaxed);
+			atomic_store_explicit(&ring->written, head, memory_order_release);
+		}
+		else if (!running)
+		{
+			break;
+		}
+		else
+		{
+			quThreadSleep(Q_LOG_ASYNC_IDLE_US);
+		}
+	}
+	return 0;
+}
+
+// Check that level names a single message level
+static q_bool quLogCheck(q_int level)
+{
+	if (level == Q_LOG_NONE || level == Q_LOG_ALL)
+	{
+		q_str name = level == Q_LOG_ALL ? "all" : "none";
+		quLogWrite(Q_LOG_WARN, "cannot log with level %s", name);
+		return q_false;
+	}
+	return q_true;
+}
+
+// Write message with its arguments
+static q_void quLogMessage(q_int level, q_str message, va_list args)
+{
+	// Format into a ring slot for the background thread when asynchronous
+	q_log_ring *ring = atomic_load_explicit(&qu_log_ring, memory_order_acquire);
+	if (ring != q_null)
+	{
+		q_log_slot *slot = quLogClaim(ring);
+		if (slot != q_null && ring->mode != Q_LOG_MODE_TEXT)
+		{
+			// Only copy the arguments, leaving conversion to the consumer
+			slot->format = message;
+			slot->level = level;
+			slot->length = quLogPack((q_ucharp)slot->text, Q_LOG_MAX_LENGTH, message, args);
+
+			q_ulong position = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+			atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+		}
+		else if (slot != q_null)
+		{
+			slot->format = q_null;
+
+			// Leave room for the newline, truncating like the synchronous path
+			q_uint prefix = strlen(strcpy((char *)slot->text, quLogPrefix(level)));
+			q_uint room = Q_LOG_MAX_LENGTH - prefix - 2;
+			q_int length = vsnprintf((char *)slot->text + prefix, room + 1, message, args);
+			slot->length = prefix + (length < 0 ? 0 : (q_uint)length < room ? (q_uint)length : room);
+			slot->text[slot->length++] = '\n';
+
+			q_ulong position = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+			atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+		}
+
+		return;
+	}
+
+	// Print message
+	q_char buffer[Q_LOG_MAX_LENGTH] = { 0 };
+	strcpy((char *)buffer, quLogPrefix(level));
+
+	q_uint length = strlen(message);
+	memcpy(buffer + strlen((char *)buffer), message, length < Q_LOG_MAX_LENGTH - 10 ? length : Q_LOG_MAX_LENGTH - 10);
+	strcat((char *)buffer, "\n");
+	vprintf((char *)buffer, args);
+	fflush(stdout);
+}
+
+
 // Log message
 Q_API q_void quLog(q_int level, q_str message, ...)
 {
 	// Check log level
-	if (level == Q_LOG_NONE || level == Q_LOG_ALL)
+	if (!quLogCheck(level) || !Q_LOG_ENABLED(0, level))
 	{
-		q_str name = level == Q_LOG_ALL ? "all" : "none";
-		return quLog(Q_LOG_WARN, "cannot log with level %s", name);
+		return;
 	}
-	if (level < qu_log_level)
+
+	va_list args;
+	va_start(args, message);
+	quLogMessage(level, message, args);
+	va_end(args);
+}
+
+// Log message that already passed the level check at the call site
+Q_API q_void quLogWrite(q_int level, q_str message, ...)
+{
+	if (!quLogCheck(level))
 	{
 		return;
 	}
 
-	// Start processing arguments
 	va_list args;
 	va_start(args, message);
+	quLogMessage(level, message, args);
+	va_end(args);
+}
 
-	// Print message
-	q_char buffer[Q_LOG_MAX_LENGTH] = { 0 };
-	switch (level)
+// Set runtime log level of category
+Q_API q_void quLogSetLevel(q_uint category, q_int level)
+{
+	if (category < Q_LOG_CATEGORY_COUNT)
 	{
-	case Q_LOG_TRACE:
-		strcpy(buffer, "trace: ");
-		break;
-	case Q_LOG_DEBUG:
-		strcpy(buffer, "debug: ");
-		break;
-	case Q_LOG_INFO:
-		strcpy(buffer, "info: ");
-		break;
-	case Q_LOG_WARN:
-		strcpy(buffer, "warn: ");
-		break;
-	case Q_LOG_ERROR:
-		strcpy(buffer, "error: ");
-		break;
+		qu_log_thresholds[category] = (q_char)(level - Q_LOG_INFO);
 	}
+}
 
-	q_uint length = strlen(message);
-	memcpy(buffer + strlen(buffer), message, length < Q_LOG_MAX_LENGTH - 10 ? length : Q_LOG_MAX_LENGTH - 10);
-	strcat(buffer, "\n");
-	vprintf(buffer, args);
-	fflush(stdout);
+// Get runtime log level of category
+Q_API q_int quLogGetLevel(q_uint category)
+{
+	return category < Q_LOG_CATEGORY_COUNT ? qu_log_thresholds[category] + Q_LOG_INFO : Q_LOG_NONE;
+}
 
-	// Stop processing arguments
-	va_end(args);
+// Start asynchronous logging with ring capacity rounded up to a power of two
+Q_API q_bool quLogStartAsync(q_uint capacity, q_log_overflow overflow, q_log_mode mode)
+{
+	if (atomic_load_explicit(&qu_log_ring, memory_order_acquire) != q_null)
+	{
+		return q_false;
+	}
+
+	q_ulong size = 1;
+	while (size < (capacity ? capacity : Q_LOG_ASYNC_CAPACITY))
+	{
+		size <<= 1;
+	}
+
+	q_log_ring *ring = Q_MALLOC(sizeof(q_log_ring));
+	q_log_slot *slots = Q_MALLOC(sizeof(q_log_slot) * size);
+	q_str *formats = Q_CALLOC(Q_LOG_FORMAT_CAPACITY, sizeof(q_str));
+	if (ring == q_null || slots == q_null || formats == q_null)
+	{
+		Q_FREE(ring);
+		Q_FREE(slots);
+		Q_FREE(formats);
+		return q_false;
+	}
+
+	for (q_ulong i = 0; i < size; i++)
+	{
+		atomic_init(&slots[i].sequence, i);
+	}
+	atomic_init(&ring->tail, 0);
+	atomic_init(&ring->head, 0);
+	atomic_init(&ring->written, 0);
+	atomic_init(&ring->dropped, 0);
+	atomic_init(&ring->running, q_true);
+	ring->mask = size - 1;
+	ring->overflow = overflow;
+	ring->mode = mode;
+	ring->formats = formats;
+	ring->formatCount = 0;
+	ring->formatMask = Q_LOG_FORMAT_CAPACITY - 1;
+	ring->slots = slots;
+
+	if (mode == Q_LOG_MODE_BINARY)
+	{
+		fwrite(Q_LOG_BINARY_MAGIC, 1, sizeof(Q_LOG_BINARY_MAGIC) - 1, stdout);
+	}
+
+#if defined(_WIN32)
+	ring->thread = CreateThread(q_null, 0, quLogConsume, ring, 0, q_null);
+	q_bool started = Q_BOOL(ring->thread != q_null);
+#else
+	q_bool started = Q_BOOL(pthread_create(&ring->thread, q_null, quLogConsume, ring) == 0);
+#endif /* defined(_WIN32) */
+	if (!started)
+	{
+		Q_FREE(slots);
+		Q_FREE(formats);
+		Q_FREE(ring);
+		return q_false;
+	}
+
+	atomic_store_explicit(&qu_log_ring, ring, memory_order_release);
+	return q_true;
+}
+
+// Wait until every message logged before this call has been written
+Q_API q_void quLogFlush(q_void)
+{
+	q_log_ring *ring = atomic_load_explicit(&qu_log_ring, memory_order_acquire);
+	if (ring == q_null)
+	{
+		return;
+	}
+
+	q_ulong target = atomic_load_explicit(&ring->tail, memory_order_acquire);
+	while (atomic_load_explicit(&ring->written, memory_order_acquire) < target)
+	{
+		quThreadYield();
+	}
+}
+
+// Flush and stop asynchronous logging, once no other thread is logging
+Q_API q_void quLogStopAsync(q_void)
+{
+	q_log_ring *ring = atomic_exchange_explicit(&qu_log_ring, q_null, memory_order_acq_rel);
+	if (ring == q_null)
+	{
+		return;
+	}
+
+	atomic_store_explicit(&ring->running, q_false, memory_order_release);
+#if defined(_WIN32)
+	WaitForSingleObject(ring->thread, INFINITE);
+	CloseHandle(ring->thread);
+#else
+	pthread_join(ring->thread, q_null);
+#endif /* defined(_WIN32) */
+
+	atomic_fetch_add_explicit(&qu_log_dropped, atomic_load_explicit(&ring->dropped, memory_order_relaxed), memory_order_relaxed);
+	Q_FREE(ring->slots);
+	Q_FREE(ring->formats);
+	Q_FREE(ring);
+}
+
+// Count messages dropped by full asynchronous rings
+Q_API q_ulong quLogDropped(q_void)
+{
+	q_ulong result = atomic_load_explicit(&qu_log_dropped, memory_order_relaxed);
+	q_log_ring *ring = atomic_load_explicit(&qu_log_ring, memory_order_acquire);
+	if (ring != q_null)
+	{
+		result += atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+	}
+	return result;
+}
+
+// Decode binary log stream into text lines
+Q_API q_bool quLogDecode(FILE *input, FILE *output)
+{
+	q_char magic[sizeof(Q_LOG_BINARY_MAGIC) - 1];
+	if (fread(magic, 1, sizeof(magic), input) != sizeof(magic) || memcmp(magic, Q_LOG_BINARY_MAGIC, sizeof(magic)) != 0)
+	{
+		return q_false;
+	}
+
+	q_char **formats = Q_CALLOC(Q_LOG_FORMAT_CAPACITY, sizeof(q_char *));
+	if (formats == q_null)
+	{
+		return q_false;
+	}
+
+	q_bool result = q_true;
+	q_int tag;
+	while ((tag = fgetc(input)) != EOF)
+	{
+		q_uchar level = 0;
+		q_uint id;
+		q_uint length;
+		if ((tag == 'R' && fread(&level, 1, 1, input) != 1) ||
+			fread(&id, sizeof(q_uint), 1, input) != 1 ||
+			fread(&length, sizeof(q_uint), 1, input) != 1 ||
+			id >= Q_LOG_FORMAT_CAPACITY)
+		{
+			result = q_false;
+			break;
+		}
+
+		if (tag == 'F')
+		{
+			Q_FREE(formats[id]);
+			formats[id] = Q_MALLOC(length + 1);
+			if (formats[id] == q_null || fread(formats[id], 1, length, input) != length)
+			{
+				result = q_false;
+				break;
+			}
+			formats[id][length] = 0;
+		}
+		else if (tag == 'R')
+		{
+			q_uchar payload[Q_LOG_MAX_LENGTH];
+			if (formats[id] == q_null || length > sizeof(payload) || fread(payload, 1, length, input) != length)
+			{
+				result = q_false;
+				break;
+			}
+
+			q_char line[Q_LOG_MAX_LENGTH];
+			fwrite(line, 1, quLogRender(line, level, (q_str)formats[id], payload, length), output);
+		}
+		else
+		{
+			result = q_false;
+			break;
+		}
+	}
+
+	for (q_uint i = 0; i < Q_LOG_FORMAT_CAPACITY; i++)
+	{
+		Q_FREE(formats[i]);
+	}
+	Q_FREE(formats);
+	return result;
+}
+
+
+//// Allocation statistics ////
+
+#if defined(Q_ENABLE_ALLOC_STATS)
+// Add to counter owned by the calling thread, which needs no read-modify-write
+#define Q_ALLOC_ADD(c, v) atomic_store_explicit(&(c), atomic_load_explicit(&(c), memory_order_relaxed) + (v), memory_order_relaxed)
+
+// Move pending live bytes of counters into the global count and peak
+static q_void quAllocPublish(q_alloc_counters *counters)
+{
+	q_long pending = atomic_load_explicit(&counters->pending, memory_order_relaxed);
+	atomic_store_explicit(&counters->pending, 0, memory_order_relaxed);
+
+	q_long live = atomic_fetch_add_explicit(&qu_alloc_live, pending, memory_order_relaxed) + pending;
+	q_long peak = atomic_load_explicit(&qu_alloc_peak, memory_order_relaxed);
+	while (live > peak && !atomic_compare_exchange_weak_explicit(&qu_alloc_peak, &peak, live, memory_order_relaxed, memory_order_relaxed))
+	{
+	}
+}
+
+// Release counters of an exiting thread for reuse, keeping their totals
+#if defined(_WIN32)
+static VOID WINAPI quAllocRetire(PVOID value)
+#else
+static q_void quAllocRetire(q_void *value)
+#endif /* defined(_WIN32) */
+{
+	q_alloc_counters *counters = value;
+	if (counters == q_null)
+	{
+		return;
+	}
+
+	quAllocPublish(counters);
+	qu_alloc_local = q_null;
+	atomic_store_explicit(&counters->active, q_false, memory_order_release);
+}
+
+// Create thread exit hook
+#if defined(_WIN32)
+static BOOL CALLBACK quAllocKey(PINIT_ONCE once, PVOID parameter, PVOID *context)
+{
+	(q_void)once;
+	(q_void)parameter;
+	(q_void)context;
+	qu_alloc_key = FlsAlloc(quAllocRetire);
+	return TRUE;
+}
+#else
+static q_void quAllocKey(q_void)
+{
+	pthread_key_create(&qu_alloc_key, quAllocRetire);
+}
+#endif /* defined(_WIN32) */
+
+// Get counters of calling thread, claiming retired ones before creating more
+static q_alloc_counters *quAllocCounters(q_void)
+{
+	q_alloc_counters *counters = qu_alloc_local;
+	if (counters != q_null)
+	{
+		return counters;
+	}
+
+	for (counters = atomic_load_explicit(&qu_alloc_threads, memory_order_acquire); counters != q_null; counters = counters->next)
+	{
+		q_bool active = q_false;
+		if (atomic_compare_exchange_strong_explicit(&counters->active, &active, q_true, memory_order_acquire, memory_order_relaxed))
+		{
+			break;
+		}
+	}
+
+	if (counters == q_null)
+	{
+		counters = Q_CALLOC(1, sizeof(q_alloc_counters));
+		if (counters == q_null)
+		{
+			return q_null;
+		}
+
+		atomic_store_explicit(&counters->active, q_true, memory_order_relaxed);
+		counters->next = atomic_load_explicit(&qu_alloc_threads, memory_order_relaxed);
+		while (!atomic_compare_exchange_weak_explicit(&qu_alloc_threads, &counters->next, counters, memory_order_release, memory_order_relaxed))
+		{
+		}
+	}
+
+#if defined(_WIN32)
+	InitOnceExecuteOnce(&qu_alloc_once, quAllocKey, q_null, q_null);
+	FlsSetValue(qu_alloc_key, counters);
+#else
+	pthread_once(&qu_alloc_once, quAllocKey);
+	pthread_setspecific(qu_alloc_key, counters);
+#endif /* defined(_WIN32) */
+
+	qu_alloc_local = counters;
+	return counters;
+}
+
+// Get identifier of call site, or 0 when unknown or the table is full
+static q_uint quAllocSite(q_str file, q_uint line)
+{
+	if (file == q_null)
+	{
+		return 0;
+	}
+
+	q_uint mask = Q_ALLOC_STATS_SITES - 1;
+	q_uint index = (q_uint)(((uintptr_t)file >> 3) * 2654435761u ^ line * 40503u) & mask;
+	for (q_uint probe = 0; probe < Q_ALLOC_STATS_SITES; probe++, index = (index + 1) & mask)
+	{
+		// Slot 0 is kept for unknown sites
+		if (index == 0)
+		{
+			continue;
+		}
+
+		q_alloc_site_entry *entry = &qu_alloc_sites[index];
+		q_uint state = atomic_load_explicit(&entry->state, memory_order_acquire);
+		if (state == 0 && atomic_compare_exchange_strong_explicit(&entry->state, &state, 1, memory_order_acquire, memory_order_acquire))
+		{
+			entry->file = file;
+			entry->line = line;
+			atomic_store_explicit(&entry->state, 2, memory_order_release);
+			return index;
+		}
+
+		while (state == 1)
+		{
+			state = atomic_load_explicit(&entry->state, memory_order_acquire);
+		}
+		if (entry->file == file && entry->line == line)
+		{
+			return index;
+		}
+	}
+	return 0;
+}
+
+// Get power of two size class, where class k holds sizes up to 2^k
+static q_uint quAllocClass(q_ulong size)
+{
+	q_uint result = 0;
+	while (result < Q_ALLOC_STATS_CLASSES - 1 && (1ull << result) < size)
+	{
+		result++;
+	}
+	return result;
+}
+
+// Track change of live bytes at site
+static q_void quAllocTrack(q_alloc_counters *counters, q_uint site, q_long bytes)
+{
+	Q_ALLOC_ADD(counters->siteBytes[site], bytes);
+
+	q_long pending = atomic_load_explicit(&counters->pending, memory_order_relaxed) + bytes;
+	atomic_store_explicit(&counters->pending, pending, memory_order_relaxed);
+	if (pending > Q_ALLOC_STATS_FLUSH || pending < -Q_ALLOC_STATS_FLUSH)
+	{
+		quAllocPublish(counters);
+	}
+}
+
+// Order sites by live bytes, largest first
+static int quAllocCompareSites(const void *left, const void *right)
+{
+	q_long l = ((const q_alloc_site *)left)->bytes;
+	q_long r = ((const q_alloc_site *)right)->bytes;
+	return (l < r) - (l > r);
+}
+#endif /* Q_ENABLE_ALLOC_STATS */
+
+// Take snapshot of allocation statistics, summing every thread's counters
+Q_API q_void quAllocStats(q_alloc_stats *stats)
+{
+	memset(stats, 0, sizeof(q_alloc_stats));
+
+#if defined(Q_ENABLE_ALLOC_STATS)
+	stats->enabled = q_true;
+
+	q_long live = atomic_load_explicit(&qu_alloc_live, memory_order_relaxed);
+	for (q_alloc_counters *counters = atomic_load_explicit(&qu_alloc_threads, memory_order_acquire); counters != q_null; counters = counters->next)
+	{
+		live += atomic_load_explicit(&counters->pending, memory_order_relaxed);
+		stats->allocCount += atomic_load_explicit(&counters->allocs, memory_order_relaxed);
+		stats->reallocCount += atomic_load_explicit(&counters->reallocs, memory_order_relaxed);
+		stats->freeCount += atomic_load_explicit(&counters->frees, memory_order_relaxed);
+		for (q_uint i = 0; i < Q_ALLOC_STATS_CLASSES; i++)
+		{
+			stats->histogram[i] += atomic_load_explicit(&counters->histogram[i], memory_order_relaxed);
+		}
+		for (q_uint i = 0; i < Q_ALLOC_STATS_SITES; i++)
+		{
+			stats->sites[i].count += atomic_load_explicit(&counters->siteCount[i], memory_order_relaxed);
+			stats->sites[i].bytes += atomic_load_explicit(&counters->siteBytes[i], memory_order_relaxed);
+		}
+	}
+
+	// Pending bytes of other threads may have moved while summing, so clamp
+	stats->liveBytes = live > 0 ? (q_ulong)live : 0;
+	q_long peak = atomic_load_explicit(&qu_alloc_peak, memory_order_relaxed);
+	stats->peakBytes = peak > live ? (q_ulong)peak : stats->liveBytes;
+
+	// Compact used sites in place, as each moves to an index no larger than its own
+	for (q_uint i = 0; i < Q_ALLOC_STATS_SITES; i++)
+	{
+		q_bool known = atomic_load_explicit(&qu_alloc_sites[i].state, memory_order_acquire) == 2;
+		if (!known && stats->sites[i].count == 0)
+		{
+			continue;
+		}
+
+		q_alloc_site site = stats->sites[i];
+		site.file = known ? qu_alloc_sites[i].file : "unknown";
+		site.line = known ? qu_alloc_sites[i].line : 0;
+		stats->sites[stats->siteCount++] = site;
+	}
+	qsort(stats->sites, stats->siteCount, sizeof(q_alloc_site), quAllocCompareSites);
+#endif /* Q_ENABLE_ALLOC_STATS */
 }
 
 //// Memory management ////
 
 // Allocate memory to handle
-Q_API q_handle quAlloc(q_uint size)
+Q_API q_handle quAlloc(q_ulong size)
 {
-	q_handle result = Q_CALLOC(size, 1);
-	return result;
+	return quAllocAt(size, q_null, 0);
 }
 
 // Reallocate memory in handle
-Q_API q_handle quRealloc(q_handle handle, q_uint size)
+Q_API q_handle quRealloc(q_handle handle, q_ulong size)
 {
-	q_handle result = Q_REALLOC(handle, size);
-    return result;
+	return quReallocAt(handle, size, q_null, 0);
 }
 
 // Free memory from handle
 Q_API q_void quFree(q_handle handle)
 {
-    Q_FREE(handle);
+#if defined(Q_ENABLE_ALLOC_STATS)
+	if (handle == q_null)
+	{
+		return;
+	}
+
+	q_alloc_header *header = (q_alloc_header *)handle - 1;
+	q_alloc_counters *counters = quAllocCounters();
+	if (counters != q_null)
+	{
+		Q_ALLOC_ADD(counters->frees, 1);
+		quAllocTrack(counters, header->info.site, -(q_long)header->info.size);
+	}
+	Q_FREE(header);
+#else
+	Q_FREE(handle);
+#endif /* Q_ENABLE_ALLOC_STATS */
+}
+
+// Allocate memory to handle on behalf of call site
+Q_API q_handle quAllocAt(q_ulong size, q_str file, q_uint line)
+{
+#if defined(Q_ENABLE_ALLOC_STATS)
+	if (size > SIZE_MAX - sizeof(q_alloc_header))
+	{
+		return q_null;
+	}
+
+	q_alloc_header *header = Q_CALLOC(sizeof(q_alloc_header) + size, 1);
+	if (header == q_null)
+	{
+		return q_null;
+	}
+	header->info.size = size;
+	header->info.site = quAllocSite(file, line);
+
+	q_alloc_counters *counters = quAllocCounters();
+	if (counters != q_null)
+	{
+		Q_ALLOC_ADD(counters->allocs, 1);
+		Q_ALLOC_ADD(counters->histogram[quAllocClass(size)], 1);
+		Q_ALLOC_ADD(counters->siteCount[header->info.site], 1);
+		quAllocTrack(counters, header->info.site, (q_long)size);
+	}
+	return header + 1;
+#else
+	(q_void)file;
+	(q_void)line;
+	q_handle result = Q_CALLOC(size, 1);
+	return result;
+#endif /* Q_ENABLE_ALLOC_STATS */
+}
+
+// Reallocate memory in handle on behalf of call site
+Q_API q_handle quReallocAt(q_handle handle, q_ulong size, q_str file, q_uint line)
+{
+#if defined(Q_ENABLE_ALLOC_STATS)
+	if (handle == q_null)
+	{
+		return quAllocAt(size, file, line);
+	}
+	if (size > SIZE_MAX - sizeof(q_alloc_header))
+	{
+		return q_null;
+	}
+
+	q_alloc_header *header = (q_alloc_header *)handle - 1;
+	q_ulong oldSize = header->info.size;
+	q_uint oldSite = header->info.site;
+
+	header = Q_REALLOC(header, sizeof(q_alloc_header) + size);
+	if (header == q_null)
+	{
+		return q_null;
+	}
+	header->info.size = size;
+	header->info.site = quAllocSite(file, line);
+
+	// Bytes move from the site that made the block to the one that resized it
+	q_alloc_counters *counters = quAllocCounters();
+	if (counters != q_null)
+	{
+		Q_ALLOC_ADD(counters->reallocs, 1);
+		Q_ALLOC_ADD(counters->siteCount[header->info.site], 1);
+		quAllocTrack(counters, oldSite, -(q_long)oldSize);
+		quAllocTrack(counters, header->info.site, (q_long)size);
+	}
+	return header + 1;
+#else
+	(q_void)file;
+	(q_void)line;
+	q_handle result = Q_REALLOC(handle, size);
+	return result;
+#endif /* Q_ENABLE_ALLOC_STATS */
+}
+
+#if !defined(Q_MALLOC_ALIGNED)
+// Header stored right before an aligned block carved out of a Q_MALLOC block
+typedef struct q_aligned_header
+{
+	q_handle block;
+	q_ulong size;
+} q_aligned_header;
+#endif /* Q_MALLOC_ALIGNED */
+
+// Allocate zeroed memory to handle with power of two alignment
+Q_API q_handle quAllocAligned(q_ulong size, q_ulong align)
+{
+	if (align == 0 || (align & (align - 1)))
+	{
+		return q_null;
+	}
+	align = align < sizeof(q_handle) ? sizeof(q_handle) : align;
+
+#if defined(Q_MALLOC_ALIGNED)
+	q_handle result = Q_MALLOC_ALIGNED(size, align);
+	if (result == q_null)
+	{
+		return q_null;
+	}
+#else
+	if (size > SIZE_MAX - align - sizeof(q_aligned_header))
+	{
+		return q_null;
+	}
+
+	q_handle block = Q_MALLOC(size + align - 1 + sizeof(q_aligned_header));
+	if (block == q_null)
+	{
+		return q_null;
+	}
+
+	uintptr_t start = ((uintptr_t)block + sizeof(q_aligned_header) + align - 1) & ~(uintptr_t)(align - 1);
+	q_handle result = (q_handle)start;
+
+	q_aligned_header header = { block, size };
+	memcpy((q_ucharp)result - sizeof(q_aligned_header), &header, sizeof(q_aligned_header));
+#endif /* Q_MALLOC_ALIGNED */
+
+	memset(result, 0, size);
+	return result;
+}
+
+// Reallocate memory in handle with power of two alignment
+Q_API q_handle quReallocAligned(q_handle handle, q_ulong size, q_ulong align)
+{
+	if (align == 0 || (align & (align - 1)))
+	{
+		return q_null;
+	}
+	align = align < sizeof(q_handle) ? sizeof(q_handle) : align;
+
+#if defined(Q_MALLOC_ALIGNED)
+	q_handle result = Q_REALLOC_ALIGNED(handle, size, align);
+	return result;
+#else
+	if (handle == q_null)
+	{
+		return quAllocAligned(size, align);
+	}
+
+	q_aligned_header header;
+	memcpy(&header, (q_ucharp)handle - sizeof(q_aligned_header), sizeof(q_aligned_header));
+
+	// The offset from the block start changes with alignment, so move into a fresh block
+	q_handle result = quAllocAligned(size, align);
+	if (result == q_null)
+	{
+		return q_null;
+	}
+
+	memcpy(result, handle, header.size < size ? header.size : size);
+	Q_FREE(header.block);
+	return result;
+#endif /* Q_MALLOC_ALIGNED */
+}
+
+// Free aligned memory from handle
+Q_API q_void quFreeAligned(q_handle handle)
+{
+#if defined(Q_MALLOC_ALIGNED)
+	Q_FREE_ALIGNED(handle);
+#else
+	if (handle == q_null)
+	{
+		return;
+	}
+
+	q_aligned_header header;
+	memcpy(&header, (q_ucharp)handle - sizeof(q_aligned_header), sizeof(q_aligned_header));
+	Q_FREE(header.block);
+#endif /* Q_MALLOC_ALIGNED */
+}
+
+//// Arena allocator ////
+
+// Allocate arena chunk with given data size
+static q_arena_chunk *quArenaChunk(q_ulong size)
+{
+	if (size > SIZE_MAX - sizeof(q_arena_chunk))
+	{
+		return q_null;
+	}
+
+	q_arena_chunk *chunk = Q_MALLOC(sizeof(q_arena_chunk) + size);
+	if (chunk == q_null)
+	{
+		return q_null;
+	}
+
+	chunk->next = q_null;
+	chunk->size = size;
+	chunk->used = 0;
+	return chunk;
+}
+
+// Bump allocate from chunk, or return null if it does not fit
+static q_handle quArenaBump(q_arena_chunk *chunk, q_ulong size, q_ulong align)
+{
+	uintptr_t base = (uintptr_t)(chunk + 1);
+	uintptr_t start = (base + chunk->used + align - 1) & ~(uintptr_t)(align - 1);
+	if (start - base > chunk->size || size > chunk->size - (start - base))
+	{
+		return q_null;
+	}
+
+	chunk->used = start - base + size;
+	return (q_handle)start;
+}
+
+// Create arena
+Q_API q_arena *quArenaCreate(q_ulong chunkSize)
+{
+	q_arena *arena = Q_MALLOC(sizeof(q_arena));
+	if (arena == q_null)
+	{
+		return q_null;
+	}
+
+	arena->chunkSize = chunkSize ? chunkSize : Q_ARENA_CHUNK_SIZE;
+	arena->first = arena->current = quArenaChunk(arena->chunkSize);
+	if (arena->first == q_null)
+	{
+		Q_FREE(arena);
+		return q_null;
+	}
+	return arena;
+}
+
+// Allocate uninitialized memory from arena with power of two alignment, zero for default
+Q_API q_handle quArenaAlloc(q_arena *arena, q_ulong size, q_ulong align)
+{
+	align = align ? align : Q_ARENA_ALIGNMENT;
+	if ((align & (align - 1)) || size > SIZE_MAX - align - sizeof(q_arena_chunk))
+	{
+		return q_null;
+	}
+
+	q_handle result = quArenaBump(arena->current, size, align);
+	while (result == q_null)
+	{
+		// Move into the next retained chunk, or insert a new one large enough for the request
+		q_arena_chunk *next = arena->current->next;
+		if (next == q_null || next->size < size + align - 1)
+		{
+			q_ulong chunkSize = size + align - 1 > arena->chunkSize ? size + align - 1 : arena->chunkSize;
+			q_arena_chunk *chunk = quArenaChunk(chunkSize);
+			if (chunk == q_null)
+			{
+				return q_null;
+			}
+
+			chunk->next = next;
+			arena->current->next = chunk;
+			next = chunk;
+		}
+
+		next->used = 0;
+		arena->current = next;
+		result = quArenaBump(next, size, align);
+	}
+	return result;
+}
+
+// Mark current arena position
+Q_API q_arena_mark quArenaMark(q_arena *arena)
+{
+	q_arena_mark result = { arena->current, arena->current->used };
+	return result;
+}
+
+// Rewind arena to marked position, releasing everything allocated since
+Q_API q_void quArenaRewind(q_arena *arena, q_arena_mark mark)
+{
+	arena->current = mark.chunk;
+	arena->current->used = mark.used;
+}
+
+// Reset arena, releasing all allocations while keeping its chunks
+Q_API q_void quArenaReset(q_arena *arena)
+{
+	arena->current = arena->first;
+	arena->current->used = 0;
+}
+
+// Destroy arena and its chunks
+Q_API q_void quArenaDestroy(q_arena *arena)
+{
+	if (arena == q_null)
+	{
+		return;
+	}
+
+	q_arena_chunk *chunk = arena->first;
+	while (chunk != q_null)
+	{
+		q_arena_chunk *next = chunk->next;
+		Q_FREE(chunk);
+		chunk = next;
+	}
+	Q_FREE(arena);
+}
+
+//// Pool allocator ////
+
+// Tags take the address bits user space never uses, guarding the shared free list against ABA
+#if UINTPTR_MAX > 0xFFFFFFFFu
+	#define Q_POOL_TAG_SHIFT 48
+#else
+	#define Q_POOL_TAG_SHIFT 32
+#endif /* UINTPTR_MAX > 0xFFFFFFFFu */
+
+#define Q_POOL_ADDRESS(v) ((uintptr_t)((v) & (((q_ulong)1 << Q_POOL_TAG_SHIFT) - 1)))
+#define Q_POOL_PACK(a, v) ((q_ulong)(a) | ((((v) >> Q_POOL_TAG_SHIFT) + 1) << Q_POOL_TAG_SHIFT))
+
+// Link of free object
+#define Q_POOL_NEXT(h) ((_Atomic uintptr_t *)(h))
+
+// Allocate slab and return its first object, with the rest chained from it
+static q_handle quPoolSlab(q_pool *pool)
+{
+	q_pool_slab *slab = Q_MALLOC(sizeof(q_pool_slab) + pool->size * pool->count);
+	if (slab == q_null)
+	{
+		return q_null;
+	}
+
+	uintptr_t slabs = atomic_load_explicit(&pool->slabs, memory_order_relaxed);
+	do
+	{
+		slab->next = (q_pool_slab *)slabs;
+	} while (!atomic_compare_exchange_weak_explicit(&pool->slabs, &slabs, (uintptr_t)slab, memory_order_release, memory_order_relaxed));
+
+	q_ucharp objects = (q_ucharp)(slab + 1);
+	for (q_uint i = 0; i + 1 < pool->count; i++)
+	{
+		atomic_store_explicit(Q_POOL_NEXT(objects + i * pool->size), (uintptr_t)(objects + (i + 1) * pool->size), memory_order_relaxed);
+	}
+	atomic_store_explicit(Q_POOL_NEXT(objects + (pool->count - 1) * pool->size), 0, memory_order_relaxed);
+	return objects;
+}
+
+// Create pool of objects with given size, allocated count per slab
+Q_API q_pool *quPoolCreate(q_ulong size, q_uint count, q_bool shared)
+{
+	q_pool *pool = Q_MALLOC(sizeof(q_pool));
+	if (pool == q_null)
+	{
+		return q_null;
+	}
+
+	// Objects hold the free list link while released, and every one keeps allocator alignment
+	size = size < sizeof(uintptr_t) ? sizeof(uintptr_t) : size;
+	pool->size = (size + _Alignof(max_align_t) - 1) & ~(q_ulong)(_Alignof(max_align_t) - 1);
+	pool->count = count ? count : Q_POOL_SLAB_COUNT;
+	pool->shared = shared;
+	pool->free = q_null;
+	atomic_init(&pool->head, 0);
+	atomic_init(&pool->slabs, 0);
+	return pool;
+}
+
+// Acquire object from pool
+Q_API q_handle quPoolAcquire(q_pool *pool)
+{
+	if (!pool->shared)
+	{
+		q_handle result = pool->free;
+		if (result == q_null)
+		{
+			result = quPoolSlab(pool);
+			if (result == q_null)
+			{
+				return q_null;
+			}
+		}
+
+		pool->free = (q_handle)atomic_load_explicit(Q_POOL_NEXT(result), memory_order_relaxed);
+		return result;
+	}
+
+	q_ulong head = atomic_load_explicit(&pool->head, memory_order_acquire);
+	for (;;)
+	{
+		q_handle result = (q_handle)Q_POOL_ADDRESS(head);
+		if (result == q_null)
+		{
+			break;
+		}
+
+		// A stale link read here is harmless, as the tag makes the exchange fail
+		uintptr_t next = atomic_load_explicit(Q_POOL_NEXT(result), memory_order_relaxed);
+		if (atomic_compare_exchange_weak_explicit(&pool->head, &head, Q_POOL_PACK(next, head), memory_order_acquire, memory_order_acquire))
+		{
+			return result;
+		}
+	}
+
+	// Keep the first object of a new slab and publish the rest in one exchange
+	q_handle result = quPoolSlab(pool);
+	if (result == q_null)
+	{
+		return q_null;
+	}
+
+	uintptr_t first = atomic_load_explicit(Q_POOL_NEXT(result), memory_order_relaxed);
+	if (first == 0)
+	{
+		return result;
+	}
+
+	q_ucharp last = (q_ucharp)result + (pool->count - 1) * pool->size;
+	head = atomic_load_explicit(&pool->head, memory_order_relaxed);
+	do
+	{
+		atomic_store_explicit(Q_POOL_NEXT(last), Q_POOL_ADDRESS(head), memory_order_relaxed);
+	} while (!atomic_compare_exchange_weak_explicit(&pool->head, &head, Q_POOL_PACK(first, head), memory_order_release, memory_order_relaxed));
+	return result;
+}
+
+// Release object back to pool
+Q_API q_void quPoolRelease(q_pool *pool, q_handle handle)
+{
+	if (handle == q_null)
+	{
+		return;
+	}
+
+	if (!pool->shared)
+	{
+		atomic_store_explicit(Q_POOL_NEXT(handle), (uintptr_t)pool->free, memory_order_relaxed);
+		pool->free = handle;
+		return;
+	}
+
+	q_ulong head = atomic_load_explicit(&pool->head, memory_order_relaxed);
+	do
+	{
+		atomic_store_explicit(Q_POOL_NEXT(handle), Q_POOL_ADDRESS(head), memory_order_relaxed);
+	} while (!atomic_compare_exchange_weak_explicit(&pool->head, &head, Q_POOL_PACK((uintptr_t)handle, head), memory_order_release, memory_order_relaxed));
+}
+
+// Destroy pool and every slab, including objects still acquired
+Q_API q_void quPoolDestroy(q_pool *pool)
+{
+	if (pool == q_null)
+	{
+		return;
+	}
+
+	q_pool_slab *slab = (q_pool_slab *)atomic_load_explicit(&pool->slabs, memory_order_acquire);
+	while (slab != q_null)
+	{
+		q_pool_slab *next = slab->next;
+		Q_FREE(slab);
+		slab = next;
+	}
+	Q_FREE(pool);
 }
@@ -23,6 +23,7 @@
 #pragma once
 #endif /* defined(_MSC_VER) && (_MSC_VER > 1000) */
 
+#include <stdio.h> // FILE
 #include <stdlib.h> // malloc, calloc, realloc, free
 #include "quite.h"
 
@@ -41,10 +42,60 @@ typedef enum
 	Q_LOG_ALL
 } q_log_level;
 
+typedef enum
+{
+	Q_LOG_OVERFLOW_DROP,
+	Q_LOG_OVERFLOW_BLOCK
+} q_log_overflow;
+
+typedef enum
+{
+	Q_LOG_MODE_TEXT,
+	Q_LOG_MODE_DEFERRED,
+	Q_LOG_MODE_BINARY
+} q_log_mode;
+
+#ifndef Q_LOG_ASYNC_CAPACITY
+	#define Q_LOG_ASYNC_CAPACITY 4096
+#endif /* Q_LOG_ASYNC_CAPACITY */
+
+#ifndef Q_LOG_ASYNC_IDLE_US
+	#define Q_LOG_ASYNC_IDLE_US 500
+#endif /* Q_LOG_ASYNC_IDLE_US */
+
+// Format table of a binary log stream, must be a power of two. The stream holds up to half
+// as many distinct format strings, and records with further formats count as dropped.
+#ifndef Q_LOG_FORMAT_CAPACITY
+	#define Q_LOG_FORMAT_CAPACITY 4096
+#endif /* Q_LOG_FORMAT_CAPACITY */
+
+#define Q_LOG_BINARY_MAGIC "QLOG1"
+
+// Levels below this are removed at compile time, must be a plain number
+#ifndef Q_LOG_COMPILE_LEVEL
+	#define Q_LOG_COMPILE_LEVEL 1
+#endif /* Q_LOG_COMPILE_LEVEL */
+
+// Number of runtime log categories, category 0 is the default
+#ifndef Q_LOG_CATEGORY_COUNT
+	#define Q_LOG_CATEGORY_COUNT 64
+#endif /* Q_LOG_CATEGORY_COUNT */
+
+// Category used by Q_LOG, define before including to tag a module
+#ifndef Q_LOG_CATEGORY
+	#define Q_LOG_CATEGORY 0
+#endif /* Q_LOG_CATEGORY */
+
+// Checked at the call site so disabled messages never evaluate their arguments.
+// Thresholds are stored relative to Q_LOG_INFO, the default for every category.
+#define Q_LOG_ENABLED(c, l) ((l) >= Q_LOG_COMPILE_LEVEL && (l) - Q_LOG_INFO >= qu_log_thresholds[c])
+
 #if defined(Q_ENABLE_LOGGING)
-	#define Q_LOG(l, ...) quLog(l, __VA_ARGS__)
+	#define Q_LOG(l, ...) Q_LOGC(Q_LOG_CATEGORY, l, __VA_ARGS__)
+	#define Q_LOGC(c, l, ...) (Q_LOG_ENABLED(c, l) ? quLogWrite(l, __VA_ARGS__) : (q_void)0)
 #else
 	#define Q_LOG(l, ...) (q_void)0
+	#define Q_LOGC(c, l, ...) (q_void)0
 #endif /* Q_ENABLE_LOGGING */
 
 //// Memory management ////
@@ -65,6 +116,87 @@ typedef enum
 	#define Q_FREE(p) free(p)
 #endif /* Q_FREE */
 
+// Aligned backends are replaced together; without one, alignment is carved out of Q_MALLOC blocks
+#if !defined(Q_MALLOC_ALIGNED) && defined(_WIN32)
+	#include <malloc.h> // _aligned_malloc, _aligned_realloc, _aligned_free
+	#define Q_MALLOC_ALIGNED(s, a) _aligned_malloc(s, a)
+	#define Q_REALLOC_ALIGNED(p, s, a) _aligned_realloc(p, s, a)
+	#define Q_FREE_ALIGNED(p) _aligned_free(p)
+#endif /* !defined(Q_MALLOC_ALIGNED) && defined(_WIN32) */
+
+#if defined(Q_MALLOC_ALIGNED) && (!defined(Q_REALLOC_ALIGNED) || !defined(Q_FREE_ALIGNED))
+	#error "Q_MALLOC_ALIGNED requires Q_REALLOC_ALIGNED and Q_FREE_ALIGNED"
+#endif /* defined(Q_MALLOC_ALIGNED) && (!defined(Q_REALLOC_ALIGNED) || !defined(Q_FREE_ALIGNED)) */
+
+#ifndef Q_PAGE_SIZE
+	#define Q_PAGE_SIZE 4096
+#endif /* Q_PAGE_SIZE */
+
+//// Arena allocator ////
+
+#ifndef Q_ARENA_CHUNK_SIZE
+	#define Q_ARENA_CHUNK_SIZE 65536
+#endif /* Q_ARENA_CHUNK_SIZE */
+
+#ifndef Q_ARENA_ALIGNMENT
+	#define Q_ARENA_ALIGNMENT 16
+#endif /* Q_ARENA_ALIGNMENT */
+
+typedef struct q_arena q_arena;
+typedef struct q_arena_chunk q_arena_chunk;
+
+typedef struct q_arena_mark
+{
+	q_arena_chunk *chunk;
+	q_ulong used;
+} q_arena_mark;
+
+//// Pool allocator ////
+
+#ifndef Q_POOL_SLAB_COUNT
+	#define Q_POOL_SLAB_COUNT 256
+#endif /* Q_POOL_SLAB_COUNT */
+
+typedef struct q_pool q_pool;
+
+//// Allocation statistics ////
+
+// Power of two size classes, the last one also counts everything larger
+#ifndef Q_ALLOC_STATS_CLASSES
+	#define Q_ALLOC_STATS_CLASSES 32
+#endif /* Q_ALLOC_STATS_CLASSES */
+
+// Distinct call sites tracked, must be a power of two
+#ifndef Q_ALLOC_STATS_SITES
+	#define Q_ALLOC_STATS_SITES 256
+#endif /* Q_ALLOC_STATS_SITES */
+
+// Bytes a thread may allocate or free before publishing them to the global live count
+#ifndef Q_ALLOC_STATS_FLUSH
+	#define Q_ALLOC_STATS_FLUSH 65536
+#endif /* Q_ALLOC_STATS_FLUSH */
+
+typedef struct q_alloc_site
+{
+	q_str file;
+	q_uint line;
+	q_ulong count;
+	q_long bytes;
+} q_alloc_site;
+
+typedef struct q_alloc_stats
+{
+	q_bool enabled;
+	q_ulong liveBytes;
+	q_ulong peakBytes;
+	q_ulong allocCount;
+	q_ulong reallocCount;
+	q_ulong freeCount;
+	q_ulong histogram[Q_ALLOC_STATS_CLASSES];
+	q_uint siteCount;
+	q_alloc_site sites[Q_ALLOC_STATS_SITES];
+} q_alloc_stats;
+
 //// Functions ////
 
 // Prevent function name mangling
@@ -73,16 +205,53 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+// Log thresholds
+extern Q_API q_char qu_log_thresholds[Q_LOG_CATEGORY_COUNT];
+
 // Log management
 Q_API q_void quLog(q_int level, q_str message, ...);
+Q_API q_void quLogWrite(q_int level, q_str message, ...);
+Q_API q_void quLogSetLevel(q_uint category, q_int level);
+Q_API q_int quLogGetLevel(q_uint category);
+Q_API q_bool quLogStartAsync(q_uint capacity, q_log_overflow overflow, q_log_mode mode);
+Q_API q_void quLogFlush(q_void);
+Q_API q_void quLogStopAsync(q_void);
+Q_API q_ulong quLogDropped(q_void);
+Q_API q_bool quLogDecode(FILE *input, FILE *output);
 
 // Memory management
-Q_API q_handle quAlloc(q_uint size);
-Q_API q_handle quRealloc(q_handle handle, q_uint size);
+Q_API q_handle quAlloc(q_ulong size);
+Q_API q_handle quRealloc(q_handle handle, q_ulong size);
 Q_API q_void quFree(q_handle handle);
+Q_API q_handle quAllocAt(q_ulong size, q_str file, q_uint line);
+Q_API q_handle quReallocAt(q_handle handle, q_ulong size, q_str file, q_uint line);
+Q_API q_void quAllocStats(q_alloc_stats *stats);
+Q_API q_handle quAllocAligned(q_ulong size, q_ulong align);
+Q_API q_handle quReallocAligned(q_handle handle, q_ulong size, q_ulong align);
+Q_API q_void quFreeAligned(q_handle handle);
+
+// Arena allocator
+Q_API q_arena *quArenaCreate(q_ulong chunkSize);
+Q_API q_handle quArenaAlloc(q_arena *arena, q_ulong size, q_ulong align);
+Q_API q_arena_mark quArenaMark(q_arena *arena);
+Q_API q_void quArenaRewind(q_arena *arena, q_arena_mark mark);
+Q_API q_void quArenaReset(q_arena *arena);
+Q_API q_void quArenaDestroy(q_arena *arena);
+
+// Pool allocator
+Q_API q_pool *quPoolCreate(q_ulong size, q_uint count, q_bool shared);
+Q_API q_handle quPoolAcquire(q_pool *pool);
+Q_API q_void quPoolRelease(q_pool *pool, q_handle handle);
+Q_API q_void quPoolDestroy(q_pool *pool);
 
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
 
+// Attribute allocations to their call site when statistics are enabled
+#if defined(Q_ENABLE_ALLOC_STATS)
+	#define quAlloc(s) quAllocAt(s, __FILE__, __LINE__)
+	#define quRealloc(h, s) quReallocAt(h, s, __FILE__, __LINE__)
+#endif /* Q_ENABLE_ALLOC_STATS */
+
 #endif /* QUTILS_H */